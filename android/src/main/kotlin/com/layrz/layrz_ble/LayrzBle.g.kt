@@ -332,20 +332,23 @@ data class BtManufacturerData (
 /** Generated class from Pigeon that represents data sent in messages. */
 data class BtServiceData (
   val uuid: Long,
-  val data: ByteArray? = null
+  val data: ByteArray? = null,
+  val fullUuid: String? = null
 )
  {
   companion object {
     fun fromList(pigeonVar_list: List<Any?>): BtServiceData {
       val uuid = pigeonVar_list[0] as Long
       val data = pigeonVar_list[1] as ByteArray?
-      return BtServiceData(uuid, data)
+      val fullUuid = pigeonVar_list[2] as String?
+      return BtServiceData(uuid, data, fullUuid)
     }
   }
   fun toList(): List<Any?> {
     return listOf(
       uuid,
       data,
+      fullUuid,
     )
   }
   override fun equals(other: Any?): Boolean {
@@ -356,13 +359,14 @@ data class BtServiceData (
       return true
     }
     val other = other as BtServiceData
-    return LayrzBlePigeonUtils.deepEquals(this.uuid, other.uuid) && LayrzBlePigeonUtils.deepEquals(this.data, other.data)
+    return LayrzBlePigeonUtils.deepEquals(this.uuid, other.uuid) && LayrzBlePigeonUtils.deepEquals(this.data, other.data) && LayrzBlePigeonUtils.deepEquals(this.fullUuid, other.fullUuid)
   }
 
   override fun hashCode(): Int {
     var result = javaClass.hashCode()
     result = 31 * result + LayrzBlePigeonUtils.deepHash(this.uuid)
     result = 31 * result + LayrzBlePigeonUtils.deepHash(this.data)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.fullUuid)
     return result
   }
 }
@@ -408,20 +412,23 @@ data class BtService (
 /** Generated class from Pigeon that represents data sent in messages. */
 data class BtCharacteristic (
   val uuid: String,
-  val properties: List<String>
+  val properties: List<String>,
+  val handle: Long? = null
 )
  {
   companion object {
     fun fromList(pigeonVar_list: List<Any?>): BtCharacteristic {
       val uuid = pigeonVar_list[0] as String
       val properties = pigeonVar_list[1] as List<String>
-      return BtCharacteristic(uuid, properties)
+      val handle = pigeonVar_list[2] as Long?
+      return BtCharacteristic(uuid, properties, handle)
     }
   }
   fun toList(): List<Any?> {
     return listOf(
       uuid,
       properties,
+      handle,
     )
   }
   override fun equals(other: Any?): Boolean {
@@ -432,13 +439,14 @@ data class BtCharacteristic (
       return true
     }
     val other = other as BtCharacteristic
-    return LayrzBlePigeonUtils.deepEquals(this.uuid, other.uuid) && LayrzBlePigeonUtils.deepEquals(this.properties, other.properties)
+    return LayrzBlePigeonUtils.deepEquals(this.uuid, other.uuid) && LayrzBlePigeonUtils.deepEquals(this.properties, other.properties) && LayrzBlePigeonUtils.deepEquals(this.handle, other.handle)
   }
 
   override fun hashCode(): Int {
     var result = javaClass.hashCode()
     result = 31 * result + LayrzBlePigeonUtils.deepHash(this.uuid)
     result = 31 * result + LayrzBlePigeonUtils.deepHash(this.properties)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.handle)
     return result
   }
 }
@@ -600,6 +608,437 @@ data class BtGattWriteRequest (
     return result
   }
 }
+/** Generated class from Pigeon that represents data sent in messages. */
+data class BtDeviceDelta (
+  val macAddress: String,
+  val changedFields: Long,
+  val name: String? = null,
+  val rssi: Long? = null,
+  val txPower: Long? = null,
+  val manufacturerData: List<BtManufacturerData>? = null,
+  val serviceData: List<BtServiceData>? = null,
+  val addressType: Long? = null
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): BtDeviceDelta {
+      val macAddress = pigeonVar_list[0] as String
+      val changedFields = pigeonVar_list[1] as Long
+      val name = pigeonVar_list[2] as String?
+      val rssi = pigeonVar_list[3] as Long?
+      val txPower = pigeonVar_list[4] as Long?
+      val manufacturerData = pigeonVar_list[5] as List<BtManufacturerData>?
+      val serviceData = pigeonVar_list[6] as List<BtServiceData>?
+      val addressType = pigeonVar_list[7] as Long?
+      return BtDeviceDelta(macAddress, changedFields, name, rssi, txPower, manufacturerData, serviceData, addressType)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      macAddress,
+      changedFields,
+      name,
+      rssi,
+      txPower,
+      manufacturerData,
+      serviceData,
+      addressType,
+    )
+  }
+  override fun equals(other: Any?): Boolean {
+    if (other == null || other.javaClass != javaClass) {
+      return false
+    }
+    if (this === other) {
+      return true
+    }
+    val other = other as BtDeviceDelta
+    return LayrzBlePigeonUtils.deepEquals(this.macAddress, other.macAddress) && LayrzBlePigeonUtils.deepEquals(this.changedFields, other.changedFields) && LayrzBlePigeonUtils.deepEquals(this.name, other.name) && LayrzBlePigeonUtils.deepEquals(this.rssi, other.rssi) && LayrzBlePigeonUtils.deepEquals(this.txPower, other.txPower) && LayrzBlePigeonUtils.deepEquals(this.manufacturerData, other.manufacturerData) && LayrzBlePigeonUtils.deepEquals(this.serviceData, other.serviceData) && LayrzBlePigeonUtils.deepEquals(this.addressType, other.addressType)
+  }
+
+  override fun hashCode(): Int {
+    var result = javaClass.hashCode()
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.macAddress)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.changedFields)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.name)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.rssi)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.txPower)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.manufacturerData)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.serviceData)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.addressType)
+    return result
+  }
+}
+/** Generated class from Pigeon that represents data sent in messages. */
+data class BtScanCacheStats (
+  val devices: Long,
+  val maxDevices: Long,
+  val deviceTtlMs: Long,
+  val evictedByTtl: Long,
+  val evictedByCapacity: Long,
+  val approximateBytes: Long,
+  val watcherDevices: Long
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): BtScanCacheStats {
+      val devices = pigeonVar_list[0] as Long
+      val maxDevices = pigeonVar_list[1] as Long
+      val deviceTtlMs = pigeonVar_list[2] as Long
+      val evictedByTtl = pigeonVar_list[3] as Long
+      val evictedByCapacity = pigeonVar_list[4] as Long
+      val approximateBytes = pigeonVar_list[5] as Long
+      val watcherDevices = pigeonVar_list[6] as Long
+      return BtScanCacheStats(devices, maxDevices, deviceTtlMs, evictedByTtl, evictedByCapacity, approximateBytes, watcherDevices)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      devices,
+      maxDevices,
+      deviceTtlMs,
+      evictedByTtl,
+      evictedByCapacity,
+      approximateBytes,
+      watcherDevices,
+    )
+  }
+  override fun equals(other: Any?): Boolean {
+    if (other == null || other.javaClass != javaClass) {
+      return false
+    }
+    if (this === other) {
+      return true
+    }
+    val other = other as BtScanCacheStats
+    return LayrzBlePigeonUtils.deepEquals(this.devices, other.devices) && LayrzBlePigeonUtils.deepEquals(this.maxDevices, other.maxDevices) && LayrzBlePigeonUtils.deepEquals(this.deviceTtlMs, other.deviceTtlMs) && LayrzBlePigeonUtils.deepEquals(this.evictedByTtl, other.evictedByTtl) && LayrzBlePigeonUtils.deepEquals(this.evictedByCapacity, other.evictedByCapacity) && LayrzBlePigeonUtils.deepEquals(this.approximateBytes, other.approximateBytes) && LayrzBlePigeonUtils.deepEquals(this.watcherDevices, other.watcherDevices)
+  }
+
+  override fun hashCode(): Int {
+    var result = javaClass.hashCode()
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.devices)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.maxDevices)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.deviceTtlMs)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.evictedByTtl)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.evictedByCapacity)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.approximateBytes)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.watcherDevices)
+    return result
+  }
+}
+/** Generated class from Pigeon that represents data sent in messages. */
+data class BtManufacturerDataFilter (
+  val companyId: Long,
+  val offset: Long,
+  val value: ByteArray,
+  val mask: ByteArray? = null,
+  val group: Long
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): BtManufacturerDataFilter {
+      val companyId = pigeonVar_list[0] as Long
+      val offset = pigeonVar_list[1] as Long
+      val value = pigeonVar_list[2] as ByteArray
+      val mask = pigeonVar_list[3] as ByteArray?
+      val group = pigeonVar_list[4] as Long
+      return BtManufacturerDataFilter(companyId, offset, value, mask, group)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      companyId,
+      offset,
+      value,
+      mask,
+      group,
+    )
+  }
+  override fun equals(other: Any?): Boolean {
+    if (other == null || other.javaClass != javaClass) {
+      return false
+    }
+    if (this === other) {
+      return true
+    }
+    val other = other as BtManufacturerDataFilter
+    return LayrzBlePigeonUtils.deepEquals(this.companyId, other.companyId) && LayrzBlePigeonUtils.deepEquals(this.offset, other.offset) && LayrzBlePigeonUtils.deepEquals(this.value, other.value) && LayrzBlePigeonUtils.deepEquals(this.mask, other.mask) && LayrzBlePigeonUtils.deepEquals(this.group, other.group)
+  }
+
+  override fun hashCode(): Int {
+    var result = javaClass.hashCode()
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.companyId)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.offset)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.value)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.mask)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.group)
+    return result
+  }
+}
+/** Generated class from Pigeon that represents data sent in messages. */
+data class BtScanMetrics (
+  val received: Long,
+  val dropped: Long,
+  val filtered: Long,
+  val duplicates: Long,
+  val merged: Long,
+  val coalesced: Long,
+  val encoded: Long,
+  val posted: Long,
+  val ingestLatencyBuckets: List<Long>,
+  val ingestLatencyMaxUs: Long,
+  val postLatencyBuckets: List<Long>,
+  val postLatencyMaxUs: Long
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): BtScanMetrics {
+      val received = pigeonVar_list[0] as Long
+      val dropped = pigeonVar_list[1] as Long
+      val filtered = pigeonVar_list[2] as Long
+      val duplicates = pigeonVar_list[3] as Long
+      val merged = pigeonVar_list[4] as Long
+      val coalesced = pigeonVar_list[5] as Long
+      val encoded = pigeonVar_list[6] as Long
+      val posted = pigeonVar_list[7] as Long
+      val ingestLatencyBuckets = pigeonVar_list[8] as List<Long>
+      val ingestLatencyMaxUs = pigeonVar_list[9] as Long
+      val postLatencyBuckets = pigeonVar_list[10] as List<Long>
+      val postLatencyMaxUs = pigeonVar_list[11] as Long
+      return BtScanMetrics(received, dropped, filtered, duplicates, merged, coalesced, encoded, posted, ingestLatencyBuckets, ingestLatencyMaxUs, postLatencyBuckets, postLatencyMaxUs)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      received,
+      dropped,
+      filtered,
+      duplicates,
+      merged,
+      coalesced,
+      encoded,
+      posted,
+      ingestLatencyBuckets,
+      ingestLatencyMaxUs,
+      postLatencyBuckets,
+      postLatencyMaxUs,
+    )
+  }
+  override fun equals(other: Any?): Boolean {
+    if (other == null || other.javaClass != javaClass) {
+      return false
+    }
+    if (this === other) {
+      return true
+    }
+    val other = other as BtScanMetrics
+    return LayrzBlePigeonUtils.deepEquals(this.received, other.received) && LayrzBlePigeonUtils.deepEquals(this.dropped, other.dropped) && LayrzBlePigeonUtils.deepEquals(this.filtered, other.filtered) && LayrzBlePigeonUtils.deepEquals(this.duplicates, other.duplicates) && LayrzBlePigeonUtils.deepEquals(this.merged, other.merged) && LayrzBlePigeonUtils.deepEquals(this.coalesced, other.coalesced) && LayrzBlePigeonUtils.deepEquals(this.encoded, other.encoded) && LayrzBlePigeonUtils.deepEquals(this.posted, other.posted) && LayrzBlePigeonUtils.deepEquals(this.ingestLatencyBuckets, other.ingestLatencyBuckets) && LayrzBlePigeonUtils.deepEquals(this.ingestLatencyMaxUs, other.ingestLatencyMaxUs) && LayrzBlePigeonUtils.deepEquals(this.postLatencyBuckets, other.postLatencyBuckets) && LayrzBlePigeonUtils.deepEquals(this.postLatencyMaxUs, other.postLatencyMaxUs)
+  }
+
+  override fun hashCode(): Int {
+    var result = javaClass.hashCode()
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.received)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.dropped)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.filtered)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.duplicates)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.merged)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.coalesced)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.encoded)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.posted)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.ingestLatencyBuckets)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.ingestLatencyMaxUs)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.postLatencyBuckets)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.postLatencyMaxUs)
+    return result
+  }
+}
+/** Generated class from Pigeon that represents data sent in messages. */
+data class BtScanQueueStats (
+  val policy: Long,
+  val capacity: Long,
+  val depth: Long,
+  val highWatermark: Long,
+  val queuedEvents: Long,
+  val deliveredEvents: Long,
+  val droppedEvents: Long,
+  val droppedDevices: Long,
+  val deferredFlushes: Long,
+  val pauses: Long,
+  val pausedAdvertisements: Long
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): BtScanQueueStats {
+      val policy = pigeonVar_list[0] as Long
+      val capacity = pigeonVar_list[1] as Long
+      val depth = pigeonVar_list[2] as Long
+      val highWatermark = pigeonVar_list[3] as Long
+      val queuedEvents = pigeonVar_list[4] as Long
+      val deliveredEvents = pigeonVar_list[5] as Long
+      val droppedEvents = pigeonVar_list[6] as Long
+      val droppedDevices = pigeonVar_list[7] as Long
+      val deferredFlushes = pigeonVar_list[8] as Long
+      val pauses = pigeonVar_list[9] as Long
+      val pausedAdvertisements = pigeonVar_list[10] as Long
+      return BtScanQueueStats(policy, capacity, depth, highWatermark, queuedEvents, deliveredEvents, droppedEvents, droppedDevices, deferredFlushes, pauses, pausedAdvertisements)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      policy,
+      capacity,
+      depth,
+      highWatermark,
+      queuedEvents,
+      deliveredEvents,
+      droppedEvents,
+      droppedDevices,
+      deferredFlushes,
+      pauses,
+      pausedAdvertisements,
+    )
+  }
+  override fun equals(other: Any?): Boolean {
+    if (other == null || other.javaClass != javaClass) {
+      return false
+    }
+    if (this === other) {
+      return true
+    }
+    val other = other as BtScanQueueStats
+    return LayrzBlePigeonUtils.deepEquals(this.policy, other.policy) && LayrzBlePigeonUtils.deepEquals(this.capacity, other.capacity) && LayrzBlePigeonUtils.deepEquals(this.depth, other.depth) && LayrzBlePigeonUtils.deepEquals(this.highWatermark, other.highWatermark) && LayrzBlePigeonUtils.deepEquals(this.queuedEvents, other.queuedEvents) && LayrzBlePigeonUtils.deepEquals(this.deliveredEvents, other.deliveredEvents) && LayrzBlePigeonUtils.deepEquals(this.droppedEvents, other.droppedEvents) && LayrzBlePigeonUtils.deepEquals(this.droppedDevices, other.droppedDevices) && LayrzBlePigeonUtils.deepEquals(this.deferredFlushes, other.deferredFlushes) && LayrzBlePigeonUtils.deepEquals(this.pauses, other.pauses) && LayrzBlePigeonUtils.deepEquals(this.pausedAdvertisements, other.pausedAdvertisements)
+  }
+
+  override fun hashCode(): Int {
+    var result = javaClass.hashCode()
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.policy)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.capacity)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.depth)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.highWatermark)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.queuedEvents)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.deliveredEvents)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.droppedEvents)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.droppedDevices)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.deferredFlushes)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.pauses)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.pausedAdvertisements)
+    return result
+  }
+}
+/** Generated class from Pigeon that represents data sent in messages. */
+data class BtAdvertisingInfo (
+  val extended: Boolean,
+  val primaryPhy: Long,
+  val secondaryPhy: Long,
+  val advertisingSid: Long,
+  val maxPayloadLength: Long
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): BtAdvertisingInfo {
+      val extended = pigeonVar_list[0] as Boolean
+      val primaryPhy = pigeonVar_list[1] as Long
+      val secondaryPhy = pigeonVar_list[2] as Long
+      val advertisingSid = pigeonVar_list[3] as Long
+      val maxPayloadLength = pigeonVar_list[4] as Long
+      return BtAdvertisingInfo(extended, primaryPhy, secondaryPhy, advertisingSid, maxPayloadLength)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      extended,
+      primaryPhy,
+      secondaryPhy,
+      advertisingSid,
+      maxPayloadLength,
+    )
+  }
+  override fun equals(other: Any?): Boolean {
+    if (other == null || other.javaClass != javaClass) {
+      return false
+    }
+    if (this === other) {
+      return true
+    }
+    val other = other as BtAdvertisingInfo
+    return LayrzBlePigeonUtils.deepEquals(this.extended, other.extended) && LayrzBlePigeonUtils.deepEquals(this.primaryPhy, other.primaryPhy) && LayrzBlePigeonUtils.deepEquals(this.secondaryPhy, other.secondaryPhy) && LayrzBlePigeonUtils.deepEquals(this.advertisingSid, other.advertisingSid) && LayrzBlePigeonUtils.deepEquals(this.maxPayloadLength, other.maxPayloadLength)
+  }
+
+  override fun hashCode(): Int {
+    var result = javaClass.hashCode()
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.extended)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.primaryPhy)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.secondaryPhy)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.advertisingSid)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.maxPayloadLength)
+    return result
+  }
+}
+/** Generated class from Pigeon that represents data sent in messages. */
+data class BtConnectTimings (
+  val resolveUs: Long,
+  val servicesUs: Long,
+  val characteristicsUs: Long,
+  val slowestServiceUs: Long,
+  val totalUs: Long,
+  val services: Long,
+  val characteristics: Long,
+  val failedServices: Long,
+  val concurrency: Long
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): BtConnectTimings {
+      val resolveUs = pigeonVar_list[0] as Long
+      val servicesUs = pigeonVar_list[1] as Long
+      val characteristicsUs = pigeonVar_list[2] as Long
+      val slowestServiceUs = pigeonVar_list[3] as Long
+      val totalUs = pigeonVar_list[4] as Long
+      val services = pigeonVar_list[5] as Long
+      val characteristics = pigeonVar_list[6] as Long
+      val failedServices = pigeonVar_list[7] as Long
+      val concurrency = pigeonVar_list[8] as Long
+      return BtConnectTimings(resolveUs, servicesUs, characteristicsUs, slowestServiceUs, totalUs, services, characteristics, failedServices, concurrency)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      resolveUs,
+      servicesUs,
+      characteristicsUs,
+      slowestServiceUs,
+      totalUs,
+      services,
+      characteristics,
+      failedServices,
+      concurrency,
+    )
+  }
+  override fun equals(other: Any?): Boolean {
+    if (other == null || other.javaClass != javaClass) {
+      return false
+    }
+    if (this === other) {
+      return true
+    }
+    val other = other as BtConnectTimings
+    return LayrzBlePigeonUtils.deepEquals(this.resolveUs, other.resolveUs) && LayrzBlePigeonUtils.deepEquals(this.servicesUs, other.servicesUs) && LayrzBlePigeonUtils.deepEquals(this.characteristicsUs, other.characteristicsUs) && LayrzBlePigeonUtils.deepEquals(this.slowestServiceUs, other.slowestServiceUs) && LayrzBlePigeonUtils.deepEquals(this.totalUs, other.totalUs) && LayrzBlePigeonUtils.deepEquals(this.services, other.services) && LayrzBlePigeonUtils.deepEquals(this.characteristics, other.characteristics) && LayrzBlePigeonUtils.deepEquals(this.failedServices, other.failedServices) && LayrzBlePigeonUtils.deepEquals(this.concurrency, other.concurrency)
+  }
+
+  override fun hashCode(): Int {
+    var result = javaClass.hashCode()
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.resolveUs)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.servicesUs)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.characteristicsUs)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.slowestServiceUs)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.totalUs)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.services)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.characteristics)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.failedServices)
+    result = 31 * result + LayrzBlePigeonUtils.deepHash(this.concurrency)
+    return result
+  }
+}
 private open class LayrzBlePigeonCodec : StandardMessageCodec() {
   override fun readValueOfType(type: Byte, buffer: ByteBuffer): Any? {
     return when (type) {
@@ -648,6 +1087,41 @@ private open class LayrzBlePigeonCodec : StandardMessageCodec() {
           BtGattWriteRequest.fromList(it)
         }
       }
+      138.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          BtDeviceDelta.fromList(it)
+        }
+      }
+      139.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          BtScanCacheStats.fromList(it)
+        }
+      }
+      140.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          BtManufacturerDataFilter.fromList(it)
+        }
+      }
+      141.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          BtScanMetrics.fromList(it)
+        }
+      }
+      142.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          BtScanQueueStats.fromList(it)
+        }
+      }
+      143.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          BtAdvertisingInfo.fromList(it)
+        }
+      }
+      144.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          BtConnectTimings.fromList(it)
+        }
+      }
       else -> super.readValueOfType(type, buffer)
     }
   }
@@ -689,6 +1163,34 @@ private open class LayrzBlePigeonCodec : StandardMessageCodec() {
         stream.write(137)
         writeValue(stream, value.toList())
       }
+      is BtDeviceDelta -> {
+        stream.write(138)
+        writeValue(stream, value.toList())
+      }
+      is BtScanCacheStats -> {
+        stream.write(139)
+        writeValue(stream, value.toList())
+      }
+      is BtManufacturerDataFilter -> {
+        stream.write(140)
+        writeValue(stream, value.toList())
+      }
+      is BtScanMetrics -> {
+        stream.write(141)
+        writeValue(stream, value.toList())
+      }
+      is BtScanQueueStats -> {
+        stream.write(142)
+        writeValue(stream, value.toList())
+      }
+      is BtAdvertisingInfo -> {
+        stream.write(143)
+        writeValue(stream, value.toList())
+      }
+      is BtConnectTimings -> {
+        stream.write(144)
+        writeValue(stream, value.toList())
+      }
       else -> super.writeValue(stream, value)
     }
   }
@@ -717,6 +1219,28 @@ interface LayrzBlePlatformChannel {
   fun respondWriteRequest(requestId: Long, macAddress: String, offset: Long, success: Boolean, callback: (Result<Boolean>) -> Unit)
   fun sendNotification(serviceUuid: String, characteristicUuid: String, payload: ByteArray, requestConfirmation: Boolean, callback: (Result<Boolean>) -> Unit)
   fun openBluetoothSettings(callback: (Result<Boolean>) -> Unit)
+  fun requestScanResync(callback: (Result<Boolean>) -> Unit)
+  fun setScanCacheLimits(maxDevices: Long?, deviceTtlMs: Long?, callback: (Result<Boolean>) -> Unit)
+  fun getScanCacheStats(callback: (Result<BtScanCacheStats>) -> Unit)
+  fun setScanAddressFilters(allowlist: List<String>, denylist: List<String>, callback: (Result<Boolean>) -> Unit)
+  fun setManufacturerDataFilters(filters: List<BtManufacturerDataFilter>, callback: (Result<Boolean>) -> Unit)
+  fun getManufacturerDataFilterHits(callback: (Result<List<Long>>) -> Unit)
+  fun setRssiSmoothing(mode: Long, emaAlpha: Double, kalmanProcessNoise: Double, kalmanMeasurementNoise: Double, medianWindow: Long, minDeltaDbm: Long, maxIntervalMs: Long, callback: (Result<Boolean>) -> Unit)
+  fun setScanCapture(path: String?, callback: (Result<Boolean>) -> Unit)
+  fun getScanMetrics(reset: Boolean, callback: (Result<BtScanMetrics>) -> Unit)
+  fun dumpScanMetrics(callback: (Result<Boolean>) -> Unit)
+  fun setScanBackpressure(policy: Long, maxQueuedDevices: Long, callback: (Result<Boolean>) -> Unit)
+  fun getScanQueueStats(callback: (Result<BtScanQueueStats>) -> Unit)
+  fun getAdvertisingInfo(macAddress: String, callback: (Result<BtAdvertisingInfo?>) -> Unit)
+  fun getConnectTimings(callback: (Result<BtConnectTimings?>) -> Unit)
+  fun setGattCache(directory: String?, callback: (Result<Boolean>) -> Unit)
+  fun clearGattCache(callback: (Result<Long>) -> Unit)
+  fun setLazyServiceDiscovery(enabled: Boolean, callback: (Result<Boolean>) -> Unit)
+  fun readCharacteristicByHandle(handle: Long, callback: (Result<ByteArray>) -> Unit)
+  fun writeCharacteristicByHandle(handle: Long, payload: ByteArray, withResponse: Boolean, callback: (Result<Boolean>) -> Unit)
+  fun startNotifyByHandle(handle: Long, callback: (Result<Boolean>) -> Unit)
+  fun stopNotifyByHandle(handle: Long, callback: (Result<Boolean>) -> Unit)
+  fun setScanCoalescingWindow(windowMs: Long, callback: (Result<Boolean>) -> Unit)
 
   companion object {
     /** The codec used by LayrzBlePlatformChannel. */
@@ -1141,29 +1665,483 @@ interface LayrzBlePlatformChannel {
           channel.setMessageHandler(null)
         }
       }
-    }
-  }
-}
-/** Generated class from Pigeon that represents Flutter messages that can be called from Kotlin. */
-class LayrzBleCallbackChannel(private val binaryMessenger: BinaryMessenger, private val messageChannelSuffix: String = "") {
-  companion object {
-    /** The codec used by LayrzBleCallbackChannel. */
-    val codec: MessageCodec<Any?> by lazy {
-      LayrzBlePigeonCodec()
-    }
-  }
-  fun onScanResult(deviceArg: BtDevice, callback: (Result<Unit>) -> Unit)
-{
-    val separatedMessageChannelSuffix = if (messageChannelSuffix.isNotEmpty()) ".$messageChannelSuffix" else ""
-    val channelName = "dev.flutter.pigeon.layrz_ble.LayrzBleCallbackChannel.onScanResult$separatedMessageChannelSuffix"
-    val channel = BasicMessageChannel<Any?>(binaryMessenger, channelName, codec)
-    channel.send(listOf(deviceArg)) {
-      if (it is List<*>) {
-        if (it.size > 1) {
-          callback(Result.failure(FlutterError(it[0] as String, it[1] as String, it[2] as String?)))
-        } else {
-          callback(Result.success(Unit))
-        }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.requestScanResync$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { _, reply ->
+            api.requestScanResync{ result: Result<Boolean> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanCacheLimits$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val maxDevicesArg = args[0] as Long?
+            val deviceTtlMsArg = args[1] as Long?
+            api.setScanCacheLimits(maxDevicesArg, deviceTtlMsArg) { result: Result<Boolean> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getScanCacheStats$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { _, reply ->
+            api.getScanCacheStats{ result: Result<BtScanCacheStats> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanAddressFilters$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val allowlistArg = args[0] as List<String>
+            val denylistArg = args[1] as List<String>
+            api.setScanAddressFilters(allowlistArg, denylistArg) { result: Result<Boolean> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setManufacturerDataFilters$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val filtersArg = args[0] as List<BtManufacturerDataFilter>
+            api.setManufacturerDataFilters(filtersArg) { result: Result<Boolean> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getManufacturerDataFilterHits$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { _, reply ->
+            api.getManufacturerDataFilterHits{ result: Result<List<Long>> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setRssiSmoothing$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val modeArg = args[0] as Long
+            val emaAlphaArg = args[1] as Double
+            val kalmanProcessNoiseArg = args[2] as Double
+            val kalmanMeasurementNoiseArg = args[3] as Double
+            val medianWindowArg = args[4] as Long
+            val minDeltaDbmArg = args[5] as Long
+            val maxIntervalMsArg = args[6] as Long
+            api.setRssiSmoothing(modeArg, emaAlphaArg, kalmanProcessNoiseArg, kalmanMeasurementNoiseArg, medianWindowArg, minDeltaDbmArg, maxIntervalMsArg) { result: Result<Boolean> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanCapture$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val pathArg = args[0] as String?
+            api.setScanCapture(pathArg) { result: Result<Boolean> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getScanMetrics$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val resetArg = args[0] as Boolean
+            api.getScanMetrics(resetArg) { result: Result<BtScanMetrics> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.dumpScanMetrics$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { _, reply ->
+            api.dumpScanMetrics{ result: Result<Boolean> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanBackpressure$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val policyArg = args[0] as Long
+            val maxQueuedDevicesArg = args[1] as Long
+            api.setScanBackpressure(policyArg, maxQueuedDevicesArg) { result: Result<Boolean> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getScanQueueStats$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { _, reply ->
+            api.getScanQueueStats{ result: Result<BtScanQueueStats> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getAdvertisingInfo$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val macAddressArg = args[0] as String
+            api.getAdvertisingInfo(macAddressArg) { result: Result<BtAdvertisingInfo?> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getConnectTimings$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { _, reply ->
+            api.getConnectTimings{ result: Result<BtConnectTimings?> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setGattCache$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val directoryArg = args[0] as String?
+            api.setGattCache(directoryArg) { result: Result<Boolean> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.clearGattCache$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { _, reply ->
+            api.clearGattCache{ result: Result<Long> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setLazyServiceDiscovery$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val enabledArg = args[0] as Boolean
+            api.setLazyServiceDiscovery(enabledArg) { result: Result<Boolean> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.readCharacteristicByHandle$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val handleArg = args[0] as Long
+            api.readCharacteristicByHandle(handleArg) { result: Result<ByteArray> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.writeCharacteristicByHandle$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val handleArg = args[0] as Long
+            val payloadArg = args[1] as ByteArray
+            val withResponseArg = args[2] as Boolean
+            api.writeCharacteristicByHandle(handleArg, payloadArg, withResponseArg) { result: Result<Boolean> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.startNotifyByHandle$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val handleArg = args[0] as Long
+            api.startNotifyByHandle(handleArg) { result: Result<Boolean> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.stopNotifyByHandle$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val handleArg = args[0] as Long
+            api.stopNotifyByHandle(handleArg) { result: Result<Boolean> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanCoalescingWindow$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val windowMsArg = args[0] as Long
+            api.setScanCoalescingWindow(windowMsArg) { result: Result<Boolean> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(LayrzBlePigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(LayrzBlePigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+    }
+  }
+}
+/** Generated class from Pigeon that represents Flutter messages that can be called from Kotlin. */
+class LayrzBleCallbackChannel(private val binaryMessenger: BinaryMessenger, private val messageChannelSuffix: String = "") {
+  companion object {
+    /** The codec used by LayrzBleCallbackChannel. */
+    val codec: MessageCodec<Any?> by lazy {
+      LayrzBlePigeonCodec()
+    }
+  }
+  fun onScanResult(deviceArg: BtDevice, callback: (Result<Unit>) -> Unit)
+{
+    val separatedMessageChannelSuffix = if (messageChannelSuffix.isNotEmpty()) ".$messageChannelSuffix" else ""
+    val channelName = "dev.flutter.pigeon.layrz_ble.LayrzBleCallbackChannel.onScanResult$separatedMessageChannelSuffix"
+    val channel = BasicMessageChannel<Any?>(binaryMessenger, channelName, codec)
+    channel.send(listOf(deviceArg)) {
+      if (it is List<*>) {
+        if (it.size > 1) {
+          callback(Result.failure(FlutterError(it[0] as String, it[1] as String, it[2] as String?)))
+        } else {
+          callback(Result.success(Unit))
+        }
+      } else {
+        callback(Result.failure(LayrzBlePigeonUtils.createConnectionError(channelName)))
+      } 
+    }
+  }
+  fun onScanResults(devicesArg: List<BtDevice>, callback: (Result<Unit>) -> Unit)
+{
+    val separatedMessageChannelSuffix = if (messageChannelSuffix.isNotEmpty()) ".$messageChannelSuffix" else ""
+    val channelName = "dev.flutter.pigeon.layrz_ble.LayrzBleCallbackChannel.onScanResults$separatedMessageChannelSuffix"
+    val channel = BasicMessageChannel<Any?>(binaryMessenger, channelName, codec)
+    channel.send(listOf(devicesArg)) {
+      if (it is List<*>) {
+        if (it.size > 1) {
+          callback(Result.failure(FlutterError(it[0] as String, it[1] as String, it[2] as String?)))
+        } else {
+          callback(Result.success(Unit))
+        }
       } else {
         callback(Result.failure(LayrzBlePigeonUtils.createConnectionError(channelName)))
       } 
@@ -1407,4 +2385,38 @@ class LayrzBleCallbackChannel(private val binaryMessenger: BinaryMessenger, priv
       } 
     }
   }
+  fun onScanDeltas(deltasArg: List<BtDeviceDelta>, callback: (Result<Unit>) -> Unit)
+{
+    val separatedMessageChannelSuffix = if (messageChannelSuffix.isNotEmpty()) ".$messageChannelSuffix" else ""
+    val channelName = "dev.flutter.pigeon.layrz_ble.LayrzBleCallbackChannel.onScanDeltas$separatedMessageChannelSuffix"
+    val channel = BasicMessageChannel<Any?>(binaryMessenger, channelName, codec)
+    channel.send(listOf(deltasArg)) {
+      if (it is List<*>) {
+        if (it.size > 1) {
+          callback(Result.failure(FlutterError(it[0] as String, it[1] as String, it[2] as String?)))
+        } else {
+          callback(Result.success(Unit))
+        }
+      } else {
+        callback(Result.failure(LayrzBlePigeonUtils.createConnectionError(channelName)))
+      } 
+    }
+  }
+  fun onDeviceLost(macAddressArg: String, addressTypeArg: Long?, callback: (Result<Unit>) -> Unit)
+{
+    val separatedMessageChannelSuffix = if (messageChannelSuffix.isNotEmpty()) ".$messageChannelSuffix" else ""
+    val channelName = "dev.flutter.pigeon.layrz_ble.LayrzBleCallbackChannel.onDeviceLost$separatedMessageChannelSuffix"
+    val channel = BasicMessageChannel<Any?>(binaryMessenger, channelName, codec)
+    channel.send(listOf(macAddressArg, addressTypeArg)) {
+      if (it is List<*>) {
+        if (it.size > 1) {
+          callback(Result.failure(FlutterError(it[0] as String, it[1] as String, it[2] as String?)))
+        } else {
+          callback(Result.success(Unit))
+        }
+      } else {
+        callback(Result.failure(LayrzBlePigeonUtils.createConnectionError(channelName)))
+      } 
+    }
+  }
 }
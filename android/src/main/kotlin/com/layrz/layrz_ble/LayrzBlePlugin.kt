@@ -58,6 +58,11 @@ class LayrzBlePlugin : LayrzBlePlatformChannel, FlutterPlugin, ActivityAware, Pl
 	private var connectedDevices: MutableMap<String, BluetoothGatt> = mutableMapOf()
 	private var macFilter: String? = null
 
+	// Replaced as a whole by setScanAddressFilters, the scan callback only reads the current sets
+	@Volatile private var allowedAddresses: Set<String> = emptySet()
+	@Volatile private var deniedAddresses: Set<String> = emptySet()
+	@Volatile private var manufacturerDataMatcher = ManufacturerDataMatcher(emptyList())
+
 	private var gattDevices: MutableMap<String, BluetoothDevice> = mutableMapOf()
 	private var gattServices: MutableList<BluetoothGattService> = mutableListOf()
 	private var gattServer: BluetoothGattServer? = null
@@ -910,6 +915,177 @@ class LayrzBlePlugin : LayrzBlePlatformChannel, FlutterPlugin, ActivityAware, Pl
 		}
 	}
 
+	override fun requestScanResync(callback: (Result<Boolean>) -> Unit) {
+		// Scan results are always sent in full through onScanResult, there is nothing to resync
+		callback(Result.success(false))
+	}
+
+	override fun setScanCacheLimits(maxDevices: Long?, deviceTtlMs: Long?, callback: (Result<Boolean>) -> Unit) {
+		// The scanned devices are not aged here, the table only holds the BluetoothDevice handles
+		callback(Result.success(false))
+	}
+
+	override fun setScanCoalescingWindow(windowMs: Long, callback: (Result<Boolean>) -> Unit) {
+		// Scan results are sent one by one as the system reports them, nothing is coalesced
+		callback(Result.success(false))
+	}
+
+	override fun setScanAddressFilters(allowlist: List<String>, denylist: List<String>, callback: (Result<Boolean>) -> Unit) {
+		allowedAddresses = allowlist.map { it.uppercase() }.toHashSet()
+		deniedAddresses = denylist.map { it.uppercase() }.toHashSet()
+		Log.d(TAG, "Scan address filters: ${allowedAddresses.size} allowed, ${deniedAddresses.size} denied")
+		callback(Result.success(true))
+	}
+
+	override fun setManufacturerDataFilters(filters: List<BtManufacturerDataFilter>, callback: (Result<Boolean>) -> Unit) {
+		if (!filters.all { ManufacturerDataMatcher.isValid(it) }) {
+			Log.d(TAG, "Invalid manufacturer data filters")
+			callback(Result.success(false))
+			return
+		}
+
+		manufacturerDataMatcher = ManufacturerDataMatcher(filters)
+		Log.d(TAG, "${filters.size} manufacturer data filters set")
+		callback(Result.success(true))
+	}
+
+	override fun getManufacturerDataFilterHits(callback: (Result<List<Long>>) -> Unit) {
+		val hits = manufacturerDataMatcher.hits
+		callback(Result.success(List(hits.length()) { hits.get(it) }))
+	}
+
+	override fun setRssiSmoothing(
+		mode: Long,
+		emaAlpha: Double,
+		kalmanProcessNoise: Double,
+		kalmanMeasurementNoise: Double,
+		medianWindow: Long,
+		minDeltaDbm: Long,
+		maxIntervalMs: Long,
+		callback: (Result<Boolean>) -> Unit
+	) {
+		// Every scan result is sent as reported by the system, there is no device table to smooth here
+		callback(Result.success(false))
+	}
+
+	override fun setScanCapture(path: String?, callback: (Result<Boolean>) -> Unit) {
+		// The capture format and its replay tooling are part of the Windows scan core
+		callback(Result.success(false))
+	}
+
+	override fun getScanMetrics(reset: Boolean, callback: (Result<BtScanMetrics>) -> Unit) {
+		// Only the Windows scan path is instrumented, the metrics stay empty here
+		callback(
+			Result.success(
+				BtScanMetrics(
+					received = 0,
+					dropped = 0,
+					filtered = 0,
+					duplicates = 0,
+					merged = 0,
+					coalesced = 0,
+					encoded = 0,
+					posted = 0,
+					ingestLatencyBuckets = listOf(),
+					ingestLatencyMaxUs = 0,
+					postLatencyBuckets = listOf(),
+					postLatencyMaxUs = 0,
+				)
+			)
+		)
+	}
+
+	override fun dumpScanMetrics(callback: (Result<Boolean>) -> Unit) {
+		callback(Result.success(false))
+	}
+
+	override fun setScanBackpressure(policy: Long, maxQueuedDevices: Long, callback: (Result<Boolean>) -> Unit) {
+		// Scan results are sent one by one as the system reports them, there is no native queue to bound
+		callback(Result.success(false))
+	}
+
+	override fun getScanQueueStats(callback: (Result<BtScanQueueStats>) -> Unit) {
+		callback(
+			Result.success(
+				BtScanQueueStats(
+					policy = 0,
+					capacity = 0,
+					depth = 0,
+					highWatermark = 0,
+					queuedEvents = 0,
+					deliveredEvents = 0,
+					droppedEvents = 0,
+					droppedDevices = 0,
+					deferredFlushes = 0,
+					pauses = 0,
+					pausedAdvertisements = 0,
+				)
+			)
+		)
+	}
+
+	override fun getAdvertisingInfo(macAddress: String, callback: (Result<BtAdvertisingInfo?>) -> Unit) {
+		// Scan results are sent in full and not kept natively, the advertising details are not tracked
+		callback(Result.success(null))
+	}
+
+	override fun getConnectTimings(callback: (Result<BtConnectTimings?>) -> Unit) {
+		// Services are discovered by BluetoothGatt in a single request, there are no phases to time
+		callback(Result.success(null))
+	}
+
+	override fun setGattCache(directory: String?, callback: (Result<Boolean>) -> Unit) {
+		// Android keeps the GATT database of bonded devices itself
+		callback(Result.success(false))
+	}
+
+	override fun clearGattCache(callback: (Result<Long>) -> Unit) {
+		callback(Result.success(0))
+	}
+
+	override fun setLazyServiceDiscovery(enabled: Boolean, callback: (Result<Boolean>) -> Unit) {
+		// BluetoothGatt discovers the whole database in a single request, it cannot be split per service
+		callback(Result.success(false))
+	}
+
+	// Characteristics are only addressed by UUID on Android, discoverServices returns no handle
+	override fun readCharacteristicByHandle(handle: Long, callback: (Result<ByteArray>) -> Unit) {
+		callback(Result.success(byteArrayOf()))
+	}
+
+	override fun writeCharacteristicByHandle(
+		handle: Long,
+		payload: ByteArray,
+		withResponse: Boolean,
+		callback: (Result<Boolean>) -> Unit
+	) {
+		callback(Result.success(false))
+	}
+
+	override fun startNotifyByHandle(handle: Long, callback: (Result<Boolean>) -> Unit) {
+		callback(Result.success(false))
+	}
+
+	override fun stopNotifyByHandle(handle: Long, callback: (Result<Boolean>) -> Unit) {
+		callback(Result.success(false))
+	}
+
+	override fun getScanCacheStats(callback: (Result<BtScanCacheStats>) -> Unit) {
+		callback(
+			Result.success(
+				BtScanCacheStats(
+					devices = devices.size.toLong(),
+					maxDevices = 0,
+					deviceTtlMs = 0,
+					evictedByTtl = 0,
+					evictedByCapacity = 0,
+					approximateBytes = 0,
+					watcherDevices = 0
+				)
+			)
+		)
+	}
+
 	override fun respondReadRequest(
 		requestId: Long,
 		macAddress: String,
@@ -1063,6 +1239,10 @@ class LayrzBlePlugin : LayrzBlePlatformChannel, FlutterPlugin, ActivityAware, Pl
 			val macAddress = device.address.uppercase()
 
 			if (macFilter != null && macAddress != macFilter) return
+			if (deniedAddresses.contains(macAddress)) return
+			val allowed = allowedAddresses
+			if (allowed.isNotEmpty() && !allowed.contains(macAddress)) return
+			if (!manufacturerDataMatcher.matches(scanRecord.manufacturerSpecificData)) return
 
 			val name = scanRecord.deviceName ?: device.name ?: "Unknown"
 
@@ -1084,7 +1264,13 @@ class LayrzBlePlugin : LayrzBlePlatformChannel, FlutterPlugin, ActivityAware, Pl
 			val serviceData = mutableListOf<BtServiceData>()
 			for ((uuid, data) in rec?.serviceData ?: emptyMap()) {
 				if (uuid == null) continue
-				serviceData.add(BtServiceData(uuid = castServiceUuid(uuid.uuid).toLong(), data = data))
+				serviceData.add(
+					BtServiceData(
+						uuid = castServiceUuid(uuid.uuid).toLong(),
+						data = data,
+						fullUuid = fullServiceUuid(uuid.uuid),
+					)
+				)
 			}
 
 			var txPower: Int? = scanRecord.txPowerLevel
@@ -1,6 +1,62 @@
 package com.layrz.layrz_ble
 
 import android.bluetooth.BluetoothGattService
+import android.util.SparseArray
+import java.util.concurrent.atomic.AtomicLongArray
 
 class BleService(var service: BluetoothGattService, var obj: BtService) {}
 
+
+/**
+ * Manufacturer data filters of the scan, with the value pre-masked so a match only compares bytes.
+ * The filters of the same group must all match, any matching group is enough.
+ */
+class ManufacturerDataMatcher(filters: List<BtManufacturerDataFilter>) {
+	private val companyIds = IntArray(filters.size) { filters[it].companyId.toInt() }
+	private val offsets = IntArray(filters.size) { filters[it].offset.toInt() }
+	private val masks = Array(filters.size) { i -> filters[i].mask ?: ByteArray(filters[i].value.size) { 0xFF.toByte() } }
+	private val values = Array(filters.size) { i ->
+		ByteArray(filters[i].value.size) { j -> (filters[i].value[j].toInt() and masks[i][j].toInt()).toByte() }
+	}
+	private val groups = filters.indices.groupBy { filters[it].group }.values
+
+	val hits = AtomicLongArray(filters.size)
+
+	val isEnabled: Boolean get() = companyIds.isNotEmpty()
+
+	fun matches(manufacturerData: SparseArray<ByteArray>?): Boolean {
+		if (!isEnabled) return true
+		if (manufacturerData == null) return false
+
+		val satisfied = BooleanArray(companyIds.size)
+		for (i in companyIds.indices) {
+			val data = manufacturerData.get(companyIds[i]) ?: continue
+			if (test(i, data)) {
+				satisfied[i] = true
+				hits.incrementAndGet(i)
+			}
+		}
+
+		return groups.any { group -> group.all { satisfied[it] } }
+	}
+
+	private fun test(index: Int, data: ByteArray): Boolean {
+		val offset = offsets[index]
+		val value = values[index]
+		val mask = masks[index]
+		if (offset + value.size > data.size) return false
+		for (j in value.indices) {
+			if ((data[offset + j].toInt() and mask[j].toInt()).toByte() != value[j]) return false
+		}
+		return true
+	}
+
+	companion object {
+		fun isValid(filter: BtManufacturerDataFilter): Boolean {
+			if (filter.companyId < 0 || filter.companyId > 0xFFFF || filter.offset < 0) return false
+			if (filter.value.isEmpty()) return false
+			val mask = filter.mask
+			return mask == null || mask.size == filter.value.size
+		}
+	}
+}
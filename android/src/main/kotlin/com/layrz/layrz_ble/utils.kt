@@ -12,4 +12,13 @@ fun standarizeUuid(uuid: UUID): String {
 fun castServiceUuid(uuid: UUID): Int {
     val shortUuid = uuid.toString().substring(4, 8)
     return Integer.parseInt(shortUuid, 16)
+}
+
+/**
+ * Get the whole UUID when it is not built on the Bluetooth base UUID, castServiceUuid would truncate it
+ */
+fun fullServiceUuid(uuid: UUID): String? {
+    val text = uuid.toString()
+    if (text.startsWith("0000") && text.endsWith("-0000-1000-8000-00805f9b34fb")) return null
+    return text.uppercase()
 }
\ No newline at end of file
@@ -5,6 +5,11 @@
 //  Created by Layrz Mobile on 20/01/25.
 //
 
+#if os(iOS)
+    import Flutter
+#elseif os(macOS)
+    import FlutterMacOS
+#endif
 import CoreBluetooth
 
 class BleService {
@@ -62,3 +67,65 @@ class BleCharacteristic {
         self.characteristic = characteristic
     }
 }
+
+/// Manufacturer data filters of the scan, with the values pre-masked so a match only compares bytes.
+/// The filters of the same group must all match, any matching group is enough.
+class ManufacturerDataMatcher {
+    private let companyIds: [UInt16]
+    private let offsets: [Int]
+    private let values: [[UInt8]]
+    private let masks: [[UInt8]]
+    private let groups: [[Int]]
+    private(set) var hits: [Int64]
+
+    init(filters: [BtManufacturerDataFilter]) {
+        companyIds = filters.map { UInt16(truncatingIfNeeded: $0.companyId) }
+        offsets = filters.map { Int($0.offset) }
+        let masks = filters.map { filter -> [UInt8] in
+            if let mask = filter.mask { return [UInt8](mask.data) }
+            return [UInt8](repeating: 0xFF, count: filter.value.data.count)
+        }
+        self.masks = masks
+        values = filters.enumerated().map { index, filter in
+            zip([UInt8](filter.value.data), masks[index]).map { $0 & $1 }
+        }
+        groups = Array(Dictionary(grouping: filters.indices, by: { filters[$0].group }).values)
+        hits = [Int64](repeating: 0, count: filters.count)
+    }
+
+    var isEnabled: Bool { !companyIds.isEmpty }
+
+    /// - Parameter manufacturerData: the raw manufacturer data of CoreBluetooth, company ID first
+    func matches(_ manufacturerData: Data?) -> Bool {
+        if !isEnabled { return true }
+        guard let raw = manufacturerData, raw.count >= 2 else { return false }
+
+        let bytes = [UInt8](raw)
+        let companyId = UInt16(bytes[0]) | (UInt16(bytes[1]) << 8)
+        var satisfied = [Bool](repeating: false, count: companyIds.count)
+        for index in companyIds.indices where companyIds[index] == companyId && test(index, bytes) {
+            satisfied[index] = true
+            hits[index] += 1
+        }
+
+        return groups.contains { group in group.allSatisfy { satisfied[$0] } }
+    }
+
+    private func test(_ index: Int, _ bytes: [UInt8]) -> Bool {
+        // The data starts after the 2 bytes of the company ID
+        let start = 2 + offsets[index]
+        let value = values[index]
+        if start + value.count > bytes.count { return false }
+        for j in value.indices where bytes[start + j] & masks[index][j] != value[j] {
+            return false
+        }
+        return true
+    }
+
+    static func isValid(_ filter: BtManufacturerDataFilter) -> Bool {
+        if filter.companyId < 0 || filter.companyId > 0xFFFF || filter.offset < 0 { return false }
+        if filter.value.data.isEmpty { return false }
+        if let mask = filter.mask { return mask.data.count == filter.value.data.count }
+        return true
+    }
+}
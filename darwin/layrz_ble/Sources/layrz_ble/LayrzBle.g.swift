@@ -315,35 +315,40 @@ struct BtManufacturerData: Hashable {
 struct BtServiceData: Hashable {
   var uuid: Int64
   var data: FlutterStandardTypedData? = nil
+  var fullUuid: String? = nil
 
 
   // swift-format-ignore: AlwaysUseLowerCamelCase
   static func fromList(_ pigeonVar_list: [Any?]) -> BtServiceData? {
     let uuid = pigeonVar_list[0] as! Int64
     let data: FlutterStandardTypedData? = nilOrValue(pigeonVar_list[1])
+    let fullUuid: String? = nilOrValue(pigeonVar_list[2])
 
     return BtServiceData(
       uuid: uuid,
-      data: data
+      data: data,
+      fullUuid: fullUuid
     )
   }
   func toList() -> [Any?] {
     return [
       uuid,
       data,
+      fullUuid,
     ]
   }
   static func == (lhs: BtServiceData, rhs: BtServiceData) -> Bool {
     if Swift.type(of: lhs) != Swift.type(of: rhs) {
       return false
     }
-    return deepEqualsLayrzBle(lhs.uuid, rhs.uuid) && deepEqualsLayrzBle(lhs.data, rhs.data)
+    return deepEqualsLayrzBle(lhs.uuid, rhs.uuid) && deepEqualsLayrzBle(lhs.data, rhs.data) && deepEqualsLayrzBle(lhs.fullUuid, rhs.fullUuid)
   }
 
   func hash(into hasher: inout Hasher) {
     hasher.combine("BtServiceData")
     deepHashLayrzBle(value: uuid, hasher: &hasher)
     deepHashLayrzBle(value: data, hasher: &hasher)
+    deepHashLayrzBle(value: fullUuid, hasher: &hasher)
   }
 }
 
@@ -387,35 +392,40 @@ struct BtService: Hashable {
 struct BtCharacteristic: Hashable {
   var uuid: String
   var properties: [String]
+  var handle: Int64? = nil
 
 
   // swift-format-ignore: AlwaysUseLowerCamelCase
   static func fromList(_ pigeonVar_list: [Any?]) -> BtCharacteristic? {
     let uuid = pigeonVar_list[0] as! String
     let properties = pigeonVar_list[1] as! [String]
+    let handle: Int64? = nilOrValue(pigeonVar_list[2])
 
     return BtCharacteristic(
       uuid: uuid,
-      properties: properties
+      properties: properties,
+      handle: handle
     )
   }
   func toList() -> [Any?] {
     return [
       uuid,
       properties,
+      handle,
     ]
   }
   static func == (lhs: BtCharacteristic, rhs: BtCharacteristic) -> Bool {
     if Swift.type(of: lhs) != Swift.type(of: rhs) {
       return false
     }
-    return deepEqualsLayrzBle(lhs.uuid, rhs.uuid) && deepEqualsLayrzBle(lhs.properties, rhs.properties)
+    return deepEqualsLayrzBle(lhs.uuid, rhs.uuid) && deepEqualsLayrzBle(lhs.properties, rhs.properties) && deepEqualsLayrzBle(lhs.handle, rhs.handle)
   }
 
   func hash(into hasher: inout Hasher) {
     hasher.combine("BtCharacteristic")
     deepHashLayrzBle(value: uuid, hasher: &hasher)
     deepHashLayrzBle(value: properties, hasher: &hasher)
+    deepHashLayrzBle(value: handle, hasher: &hasher)
   }
 }
 
@@ -582,6 +592,473 @@ struct BtGattWriteRequest: Hashable {
   }
 }
 
+/// Generated class from Pigeon that represents data sent in messages.
+struct BtDeviceDelta: Hashable {
+  var macAddress: String
+  var changedFields: Int64
+  var name: String? = nil
+  var rssi: Int64? = nil
+  var txPower: Int64? = nil
+  var manufacturerData: [BtManufacturerData]? = nil
+  var serviceData: [BtServiceData]? = nil
+  var addressType: Int64? = nil
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> BtDeviceDelta? {
+    let macAddress = pigeonVar_list[0] as! String
+    let changedFields = pigeonVar_list[1] as! Int64
+    let name: String? = nilOrValue(pigeonVar_list[2])
+    let rssi: Int64? = nilOrValue(pigeonVar_list[3])
+    let txPower: Int64? = nilOrValue(pigeonVar_list[4])
+    let manufacturerData: [BtManufacturerData]? = nilOrValue(pigeonVar_list[5])
+    let serviceData: [BtServiceData]? = nilOrValue(pigeonVar_list[6])
+    let addressType: Int64? = nilOrValue(pigeonVar_list[7])
+
+    return BtDeviceDelta(
+      macAddress: macAddress,
+      changedFields: changedFields,
+      name: name,
+      rssi: rssi,
+      txPower: txPower,
+      manufacturerData: manufacturerData,
+      serviceData: serviceData,
+      addressType: addressType
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      macAddress,
+      changedFields,
+      name,
+      rssi,
+      txPower,
+      manufacturerData,
+      serviceData,
+      addressType,
+    ]
+  }
+  static func == (lhs: BtDeviceDelta, rhs: BtDeviceDelta) -> Bool {
+    if Swift.type(of: lhs) != Swift.type(of: rhs) {
+      return false
+    }
+    return deepEqualsLayrzBle(lhs.macAddress, rhs.macAddress) && deepEqualsLayrzBle(lhs.changedFields, rhs.changedFields) && deepEqualsLayrzBle(lhs.name, rhs.name) && deepEqualsLayrzBle(lhs.rssi, rhs.rssi) && deepEqualsLayrzBle(lhs.txPower, rhs.txPower) && deepEqualsLayrzBle(lhs.manufacturerData, rhs.manufacturerData) && deepEqualsLayrzBle(lhs.serviceData, rhs.serviceData) && deepEqualsLayrzBle(lhs.addressType, rhs.addressType)
+  }
+
+  func hash(into hasher: inout Hasher) {
+    hasher.combine("BtDeviceDelta")
+    deepHashLayrzBle(value: macAddress, hasher: &hasher)
+    deepHashLayrzBle(value: changedFields, hasher: &hasher)
+    deepHashLayrzBle(value: name, hasher: &hasher)
+    deepHashLayrzBle(value: rssi, hasher: &hasher)
+    deepHashLayrzBle(value: txPower, hasher: &hasher)
+    deepHashLayrzBle(value: manufacturerData, hasher: &hasher)
+    deepHashLayrzBle(value: serviceData, hasher: &hasher)
+    deepHashLayrzBle(value: addressType, hasher: &hasher)
+  }
+}
+
+/// Generated class from Pigeon that represents data sent in messages.
+struct BtScanCacheStats: Hashable {
+  var devices: Int64
+  var maxDevices: Int64
+  var deviceTtlMs: Int64
+  var evictedByTtl: Int64
+  var evictedByCapacity: Int64
+  var approximateBytes: Int64
+  var watcherDevices: Int64
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> BtScanCacheStats? {
+    let devices = pigeonVar_list[0] as! Int64
+    let maxDevices = pigeonVar_list[1] as! Int64
+    let deviceTtlMs = pigeonVar_list[2] as! Int64
+    let evictedByTtl = pigeonVar_list[3] as! Int64
+    let evictedByCapacity = pigeonVar_list[4] as! Int64
+    let approximateBytes = pigeonVar_list[5] as! Int64
+    let watcherDevices = pigeonVar_list[6] as! Int64
+
+    return BtScanCacheStats(
+      devices: devices,
+      maxDevices: maxDevices,
+      deviceTtlMs: deviceTtlMs,
+      evictedByTtl: evictedByTtl,
+      evictedByCapacity: evictedByCapacity,
+      approximateBytes: approximateBytes,
+      watcherDevices: watcherDevices
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      devices,
+      maxDevices,
+      deviceTtlMs,
+      evictedByTtl,
+      evictedByCapacity,
+      approximateBytes,
+      watcherDevices,
+    ]
+  }
+  static func == (lhs: BtScanCacheStats, rhs: BtScanCacheStats) -> Bool {
+    if Swift.type(of: lhs) != Swift.type(of: rhs) {
+      return false
+    }
+    return deepEqualsLayrzBle(lhs.devices, rhs.devices) && deepEqualsLayrzBle(lhs.maxDevices, rhs.maxDevices) && deepEqualsLayrzBle(lhs.deviceTtlMs, rhs.deviceTtlMs) && deepEqualsLayrzBle(lhs.evictedByTtl, rhs.evictedByTtl) && deepEqualsLayrzBle(lhs.evictedByCapacity, rhs.evictedByCapacity) && deepEqualsLayrzBle(lhs.approximateBytes, rhs.approximateBytes) && deepEqualsLayrzBle(lhs.watcherDevices, rhs.watcherDevices)
+  }
+
+  func hash(into hasher: inout Hasher) {
+    hasher.combine("BtScanCacheStats")
+    deepHashLayrzBle(value: devices, hasher: &hasher)
+    deepHashLayrzBle(value: maxDevices, hasher: &hasher)
+    deepHashLayrzBle(value: deviceTtlMs, hasher: &hasher)
+    deepHashLayrzBle(value: evictedByTtl, hasher: &hasher)
+    deepHashLayrzBle(value: evictedByCapacity, hasher: &hasher)
+    deepHashLayrzBle(value: approximateBytes, hasher: &hasher)
+    deepHashLayrzBle(value: watcherDevices, hasher: &hasher)
+  }
+}
+
+/// Generated class from Pigeon that represents data sent in messages.
+struct BtManufacturerDataFilter: Hashable {
+  var companyId: Int64
+  var offset: Int64
+  var value: FlutterStandardTypedData
+  var mask: FlutterStandardTypedData? = nil
+  var group: Int64
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> BtManufacturerDataFilter? {
+    let companyId = pigeonVar_list[0] as! Int64
+    let offset = pigeonVar_list[1] as! Int64
+    let value = pigeonVar_list[2] as! FlutterStandardTypedData
+    let mask: FlutterStandardTypedData? = nilOrValue(pigeonVar_list[3])
+    let group = pigeonVar_list[4] as! Int64
+
+    return BtManufacturerDataFilter(
+      companyId: companyId,
+      offset: offset,
+      value: value,
+      mask: mask,
+      group: group
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      companyId,
+      offset,
+      value,
+      mask,
+      group,
+    ]
+  }
+  static func == (lhs: BtManufacturerDataFilter, rhs: BtManufacturerDataFilter) -> Bool {
+    if Swift.type(of: lhs) != Swift.type(of: rhs) {
+      return false
+    }
+    return deepEqualsLayrzBle(lhs.companyId, rhs.companyId) && deepEqualsLayrzBle(lhs.offset, rhs.offset) && deepEqualsLayrzBle(lhs.value, rhs.value) && deepEqualsLayrzBle(lhs.mask, rhs.mask) && deepEqualsLayrzBle(lhs.group, rhs.group)
+  }
+
+  func hash(into hasher: inout Hasher) {
+    hasher.combine("BtManufacturerDataFilter")
+    deepHashLayrzBle(value: companyId, hasher: &hasher)
+    deepHashLayrzBle(value: offset, hasher: &hasher)
+    deepHashLayrzBle(value: value, hasher: &hasher)
+    deepHashLayrzBle(value: mask, hasher: &hasher)
+    deepHashLayrzBle(value: group, hasher: &hasher)
+  }
+}
+
+/// Generated class from Pigeon that represents data sent in messages.
+struct BtScanMetrics: Hashable {
+  var received: Int64
+  var dropped: Int64
+  var filtered: Int64
+  var duplicates: Int64
+  var merged: Int64
+  var coalesced: Int64
+  var encoded: Int64
+  var posted: Int64
+  var ingestLatencyBuckets: [Int64]
+  var ingestLatencyMaxUs: Int64
+  var postLatencyBuckets: [Int64]
+  var postLatencyMaxUs: Int64
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> BtScanMetrics? {
+    let received = pigeonVar_list[0] as! Int64
+    let dropped = pigeonVar_list[1] as! Int64
+    let filtered = pigeonVar_list[2] as! Int64
+    let duplicates = pigeonVar_list[3] as! Int64
+    let merged = pigeonVar_list[4] as! Int64
+    let coalesced = pigeonVar_list[5] as! Int64
+    let encoded = pigeonVar_list[6] as! Int64
+    let posted = pigeonVar_list[7] as! Int64
+    let ingestLatencyBuckets = pigeonVar_list[8] as! [Int64]
+    let ingestLatencyMaxUs = pigeonVar_list[9] as! Int64
+    let postLatencyBuckets = pigeonVar_list[10] as! [Int64]
+    let postLatencyMaxUs = pigeonVar_list[11] as! Int64
+
+    return BtScanMetrics(
+      received: received,
+      dropped: dropped,
+      filtered: filtered,
+      duplicates: duplicates,
+      merged: merged,
+      coalesced: coalesced,
+      encoded: encoded,
+      posted: posted,
+      ingestLatencyBuckets: ingestLatencyBuckets,
+      ingestLatencyMaxUs: ingestLatencyMaxUs,
+      postLatencyBuckets: postLatencyBuckets,
+      postLatencyMaxUs: postLatencyMaxUs
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      received,
+      dropped,
+      filtered,
+      duplicates,
+      merged,
+      coalesced,
+      encoded,
+      posted,
+      ingestLatencyBuckets,
+      ingestLatencyMaxUs,
+      postLatencyBuckets,
+      postLatencyMaxUs,
+    ]
+  }
+  static func == (lhs: BtScanMetrics, rhs: BtScanMetrics) -> Bool {
+    if Swift.type(of: lhs) != Swift.type(of: rhs) {
+      return false
+    }
+    return deepEqualsLayrzBle(lhs.received, rhs.received) && deepEqualsLayrzBle(lhs.dropped, rhs.dropped) && deepEqualsLayrzBle(lhs.filtered, rhs.filtered) && deepEqualsLayrzBle(lhs.duplicates, rhs.duplicates) && deepEqualsLayrzBle(lhs.merged, rhs.merged) && deepEqualsLayrzBle(lhs.coalesced, rhs.coalesced) && deepEqualsLayrzBle(lhs.encoded, rhs.encoded) && deepEqualsLayrzBle(lhs.posted, rhs.posted) && deepEqualsLayrzBle(lhs.ingestLatencyBuckets, rhs.ingestLatencyBuckets) && deepEqualsLayrzBle(lhs.ingestLatencyMaxUs, rhs.ingestLatencyMaxUs) && deepEqualsLayrzBle(lhs.postLatencyBuckets, rhs.postLatencyBuckets) && deepEqualsLayrzBle(lhs.postLatencyMaxUs, rhs.postLatencyMaxUs)
+  }
+
+  func hash(into hasher: inout Hasher) {
+    hasher.combine("BtScanMetrics")
+    deepHashLayrzBle(value: received, hasher: &hasher)
+    deepHashLayrzBle(value: dropped, hasher: &hasher)
+    deepHashLayrzBle(value: filtered, hasher: &hasher)
+    deepHashLayrzBle(value: duplicates, hasher: &hasher)
+    deepHashLayrzBle(value: merged, hasher: &hasher)
+    deepHashLayrzBle(value: coalesced, hasher: &hasher)
+    deepHashLayrzBle(value: encoded, hasher: &hasher)
+    deepHashLayrzBle(value: posted, hasher: &hasher)
+    deepHashLayrzBle(value: ingestLatencyBuckets, hasher: &hasher)
+    deepHashLayrzBle(value: ingestLatencyMaxUs, hasher: &hasher)
+    deepHashLayrzBle(value: postLatencyBuckets, hasher: &hasher)
+    deepHashLayrzBle(value: postLatencyMaxUs, hasher: &hasher)
+  }
+}
+
+/// Generated class from Pigeon that represents data sent in messages.
+struct BtScanQueueStats: Hashable {
+  var policy: Int64
+  var capacity: Int64
+  var depth: Int64
+  var highWatermark: Int64
+  var queuedEvents: Int64
+  var deliveredEvents: Int64
+  var droppedEvents: Int64
+  var droppedDevices: Int64
+  var deferredFlushes: Int64
+  var pauses: Int64
+  var pausedAdvertisements: Int64
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> BtScanQueueStats? {
+    let policy = pigeonVar_list[0] as! Int64
+    let capacity = pigeonVar_list[1] as! Int64
+    let depth = pigeonVar_list[2] as! Int64
+    let highWatermark = pigeonVar_list[3] as! Int64
+    let queuedEvents = pigeonVar_list[4] as! Int64
+    let deliveredEvents = pigeonVar_list[5] as! Int64
+    let droppedEvents = pigeonVar_list[6] as! Int64
+    let droppedDevices = pigeonVar_list[7] as! Int64
+    let deferredFlushes = pigeonVar_list[8] as! Int64
+    let pauses = pigeonVar_list[9] as! Int64
+    let pausedAdvertisements = pigeonVar_list[10] as! Int64
+
+    return BtScanQueueStats(
+      policy: policy,
+      capacity: capacity,
+      depth: depth,
+      highWatermark: highWatermark,
+      queuedEvents: queuedEvents,
+      deliveredEvents: deliveredEvents,
+      droppedEvents: droppedEvents,
+      droppedDevices: droppedDevices,
+      deferredFlushes: deferredFlushes,
+      pauses: pauses,
+      pausedAdvertisements: pausedAdvertisements
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      policy,
+      capacity,
+      depth,
+      highWatermark,
+      queuedEvents,
+      deliveredEvents,
+      droppedEvents,
+      droppedDevices,
+      deferredFlushes,
+      pauses,
+      pausedAdvertisements,
+    ]
+  }
+  static func == (lhs: BtScanQueueStats, rhs: BtScanQueueStats) -> Bool {
+    if Swift.type(of: lhs) != Swift.type(of: rhs) {
+      return false
+    }
+    return deepEqualsLayrzBle(lhs.policy, rhs.policy) && deepEqualsLayrzBle(lhs.capacity, rhs.capacity) && deepEqualsLayrzBle(lhs.depth, rhs.depth) && deepEqualsLayrzBle(lhs.highWatermark, rhs.highWatermark) && deepEqualsLayrzBle(lhs.queuedEvents, rhs.queuedEvents) && deepEqualsLayrzBle(lhs.deliveredEvents, rhs.deliveredEvents) && deepEqualsLayrzBle(lhs.droppedEvents, rhs.droppedEvents) && deepEqualsLayrzBle(lhs.droppedDevices, rhs.droppedDevices) && deepEqualsLayrzBle(lhs.deferredFlushes, rhs.deferredFlushes) && deepEqualsLayrzBle(lhs.pauses, rhs.pauses) && deepEqualsLayrzBle(lhs.pausedAdvertisements, rhs.pausedAdvertisements)
+  }
+
+  func hash(into hasher: inout Hasher) {
+    hasher.combine("BtScanQueueStats")
+    deepHashLayrzBle(value: policy, hasher: &hasher)
+    deepHashLayrzBle(value: capacity, hasher: &hasher)
+    deepHashLayrzBle(value: depth, hasher: &hasher)
+    deepHashLayrzBle(value: highWatermark, hasher: &hasher)
+    deepHashLayrzBle(value: queuedEvents, hasher: &hasher)
+    deepHashLayrzBle(value: deliveredEvents, hasher: &hasher)
+    deepHashLayrzBle(value: droppedEvents, hasher: &hasher)
+    deepHashLayrzBle(value: droppedDevices, hasher: &hasher)
+    deepHashLayrzBle(value: deferredFlushes, hasher: &hasher)
+    deepHashLayrzBle(value: pauses, hasher: &hasher)
+    deepHashLayrzBle(value: pausedAdvertisements, hasher: &hasher)
+  }
+}
+
+/// Generated class from Pigeon that represents data sent in messages.
+struct BtAdvertisingInfo: Hashable {
+  var extended: Bool
+  var primaryPhy: Int64
+  var secondaryPhy: Int64
+  var advertisingSid: Int64
+  var maxPayloadLength: Int64
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> BtAdvertisingInfo? {
+    let extended = pigeonVar_list[0] as! Bool
+    let primaryPhy = pigeonVar_list[1] as! Int64
+    let secondaryPhy = pigeonVar_list[2] as! Int64
+    let advertisingSid = pigeonVar_list[3] as! Int64
+    let maxPayloadLength = pigeonVar_list[4] as! Int64
+
+    return BtAdvertisingInfo(
+      extended: extended,
+      primaryPhy: primaryPhy,
+      secondaryPhy: secondaryPhy,
+      advertisingSid: advertisingSid,
+      maxPayloadLength: maxPayloadLength
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      extended,
+      primaryPhy,
+      secondaryPhy,
+      advertisingSid,
+      maxPayloadLength,
+    ]
+  }
+  static func == (lhs: BtAdvertisingInfo, rhs: BtAdvertisingInfo) -> Bool {
+    if Swift.type(of: lhs) != Swift.type(of: rhs) {
+      return false
+    }
+    return deepEqualsLayrzBle(lhs.extended, rhs.extended) && deepEqualsLayrzBle(lhs.primaryPhy, rhs.primaryPhy) && deepEqualsLayrzBle(lhs.secondaryPhy, rhs.secondaryPhy) && deepEqualsLayrzBle(lhs.advertisingSid, rhs.advertisingSid) && deepEqualsLayrzBle(lhs.maxPayloadLength, rhs.maxPayloadLength)
+  }
+
+  func hash(into hasher: inout Hasher) {
+    hasher.combine("BtAdvertisingInfo")
+    deepHashLayrzBle(value: extended, hasher: &hasher)
+    deepHashLayrzBle(value: primaryPhy, hasher: &hasher)
+    deepHashLayrzBle(value: secondaryPhy, hasher: &hasher)
+    deepHashLayrzBle(value: advertisingSid, hasher: &hasher)
+    deepHashLayrzBle(value: maxPayloadLength, hasher: &hasher)
+  }
+}
+
+/// Generated class from Pigeon that represents data sent in messages.
+struct BtConnectTimings: Hashable {
+  var resolveUs: Int64
+  var servicesUs: Int64
+  var characteristicsUs: Int64
+  var slowestServiceUs: Int64
+  var totalUs: Int64
+  var services: Int64
+  var characteristics: Int64
+  var failedServices: Int64
+  var concurrency: Int64
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> BtConnectTimings? {
+    let resolveUs = pigeonVar_list[0] as! Int64
+    let servicesUs = pigeonVar_list[1] as! Int64
+    let characteristicsUs = pigeonVar_list[2] as! Int64
+    let slowestServiceUs = pigeonVar_list[3] as! Int64
+    let totalUs = pigeonVar_list[4] as! Int64
+    let services = pigeonVar_list[5] as! Int64
+    let characteristics = pigeonVar_list[6] as! Int64
+    let failedServices = pigeonVar_list[7] as! Int64
+    let concurrency = pigeonVar_list[8] as! Int64
+
+    return BtConnectTimings(
+      resolveUs: resolveUs,
+      servicesUs: servicesUs,
+      characteristicsUs: characteristicsUs,
+      slowestServiceUs: slowestServiceUs,
+      totalUs: totalUs,
+      services: services,
+      characteristics: characteristics,
+      failedServices: failedServices,
+      concurrency: concurrency
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      resolveUs,
+      servicesUs,
+      characteristicsUs,
+      slowestServiceUs,
+      totalUs,
+      services,
+      characteristics,
+      failedServices,
+      concurrency,
+    ]
+  }
+  static func == (lhs: BtConnectTimings, rhs: BtConnectTimings) -> Bool {
+    if Swift.type(of: lhs) != Swift.type(of: rhs) {
+      return false
+    }
+    return deepEqualsLayrzBle(lhs.resolveUs, rhs.resolveUs) && deepEqualsLayrzBle(lhs.servicesUs, rhs.servicesUs) && deepEqualsLayrzBle(lhs.characteristicsUs, rhs.characteristicsUs) && deepEqualsLayrzBle(lhs.slowestServiceUs, rhs.slowestServiceUs) && deepEqualsLayrzBle(lhs.totalUs, rhs.totalUs) && deepEqualsLayrzBle(lhs.services, rhs.services) && deepEqualsLayrzBle(lhs.characteristics, rhs.characteristics) && deepEqualsLayrzBle(lhs.failedServices, rhs.failedServices) && deepEqualsLayrzBle(lhs.concurrency, rhs.concurrency)
+  }
+
+  func hash(into hasher: inout Hasher) {
+    hasher.combine("BtConnectTimings")
+    deepHashLayrzBle(value: resolveUs, hasher: &hasher)
+    deepHashLayrzBle(value: servicesUs, hasher: &hasher)
+    deepHashLayrzBle(value: characteristicsUs, hasher: &hasher)
+    deepHashLayrzBle(value: slowestServiceUs, hasher: &hasher)
+    deepHashLayrzBle(value: totalUs, hasher: &hasher)
+    deepHashLayrzBle(value: services, hasher: &hasher)
+    deepHashLayrzBle(value: characteristics, hasher: &hasher)
+    deepHashLayrzBle(value: failedServices, hasher: &hasher)
+    deepHashLayrzBle(value: concurrency, hasher: &hasher)
+  }
+}
+
 private class LayrzBlePigeonCodecReader: FlutterStandardReader {
   override func readValue(ofType type: UInt8) -> Any? {
     switch type {
@@ -603,6 +1080,20 @@ private class LayrzBlePigeonCodecReader: FlutterStandardReader {
       return BtGattReadRequest.fromList(self.readValue() as! [Any?])
     case 137:
       return BtGattWriteRequest.fromList(self.readValue() as! [Any?])
+    case 138:
+      return BtDeviceDelta.fromList(self.readValue() as! [Any?])
+    case 139:
+      return BtScanCacheStats.fromList(self.readValue() as! [Any?])
+    case 140:
+      return BtManufacturerDataFilter.fromList(self.readValue() as! [Any?])
+    case 141:
+      return BtScanMetrics.fromList(self.readValue() as! [Any?])
+    case 142:
+      return BtScanQueueStats.fromList(self.readValue() as! [Any?])
+    case 143:
+      return BtAdvertisingInfo.fromList(self.readValue() as! [Any?])
+    case 144:
+      return BtConnectTimings.fromList(self.readValue() as! [Any?])
     default:
       return super.readValue(ofType: type)
     }
@@ -638,6 +1129,27 @@ private class LayrzBlePigeonCodecWriter: FlutterStandardWriter {
     } else if let value = value as? BtGattWriteRequest {
       super.writeByte(137)
       super.writeValue(value.toList())
+    } else if let value = value as? BtDeviceDelta {
+      super.writeByte(138)
+      super.writeValue(value.toList())
+    } else if let value = value as? BtScanCacheStats {
+      super.writeByte(139)
+      super.writeValue(value.toList())
+    } else if let value = value as? BtManufacturerDataFilter {
+      super.writeByte(140)
+      super.writeValue(value.toList())
+    } else if let value = value as? BtScanMetrics {
+      super.writeByte(141)
+      super.writeValue(value.toList())
+    } else if let value = value as? BtScanQueueStats {
+      super.writeByte(142)
+      super.writeValue(value.toList())
+    } else if let value = value as? BtAdvertisingInfo {
+      super.writeByte(143)
+      super.writeValue(value.toList())
+    } else if let value = value as? BtConnectTimings {
+      super.writeByte(144)
+      super.writeValue(value.toList())
     } else {
       super.writeValue(value)
     }
@@ -681,6 +1193,28 @@ protocol LayrzBlePlatformChannel {
   func respondWriteRequest(requestId: Int64, macAddress: String, offset: Int64, success: Bool, completion: @escaping (Result<Bool, Error>) -> Void)
   func sendNotification(serviceUuid: String, characteristicUuid: String, payload: FlutterStandardTypedData, requestConfirmation: Bool, completion: @escaping (Result<Bool, Error>) -> Void)
   func openBluetoothSettings(completion: @escaping (Result<Bool, Error>) -> Void)
+  func requestScanResync(completion: @escaping (Result<Bool, Error>) -> Void)
+  func setScanCacheLimits(maxDevices: Int64?, deviceTtlMs: Int64?, completion: @escaping (Result<Bool, Error>) -> Void)
+  func getScanCacheStats(completion: @escaping (Result<BtScanCacheStats, Error>) -> Void)
+  func setScanAddressFilters(allowlist: [String], denylist: [String], completion: @escaping (Result<Bool, Error>) -> Void)
+  func setManufacturerDataFilters(filters: [BtManufacturerDataFilter], completion: @escaping (Result<Bool, Error>) -> Void)
+  func getManufacturerDataFilterHits(completion: @escaping (Result<[Int64], Error>) -> Void)
+  func setRssiSmoothing(mode: Int64, emaAlpha: Double, kalmanProcessNoise: Double, kalmanMeasurementNoise: Double, medianWindow: Int64, minDeltaDbm: Int64, maxIntervalMs: Int64, completion: @escaping (Result<Bool, Error>) -> Void)
+  func setScanCapture(path: String?, completion: @escaping (Result<Bool, Error>) -> Void)
+  func getScanMetrics(reset: Bool, completion: @escaping (Result<BtScanMetrics, Error>) -> Void)
+  func dumpScanMetrics(completion: @escaping (Result<Bool, Error>) -> Void)
+  func setScanBackpressure(policy: Int64, maxQueuedDevices: Int64, completion: @escaping (Result<Bool, Error>) -> Void)
+  func getScanQueueStats(completion: @escaping (Result<BtScanQueueStats, Error>) -> Void)
+  func getAdvertisingInfo(macAddress: String, completion: @escaping (Result<BtAdvertisingInfo?, Error>) -> Void)
+  func getConnectTimings(completion: @escaping (Result<BtConnectTimings?, Error>) -> Void)
+  func setGattCache(directory: String?, completion: @escaping (Result<Bool, Error>) -> Void)
+  func clearGattCache(completion: @escaping (Result<Int64, Error>) -> Void)
+  func setLazyServiceDiscovery(enabled: Bool, completion: @escaping (Result<Bool, Error>) -> Void)
+  func readCharacteristicByHandle(handle: Int64, completion: @escaping (Result<FlutterStandardTypedData, Error>) -> Void)
+  func writeCharacteristicByHandle(handle: Int64, payload: FlutterStandardTypedData, withResponse: Bool, completion: @escaping (Result<Bool, Error>) -> Void)
+  func startNotifyByHandle(handle: Int64, completion: @escaping (Result<Bool, Error>) -> Void)
+  func stopNotifyByHandle(handle: Int64, completion: @escaping (Result<Bool, Error>) -> Void)
+  func setScanCoalescingWindow(windowMs: Int64, completion: @escaping (Result<Bool, Error>) -> Void)
 }
 
 /// Generated setup class from Pigeon to handle messages through the `binaryMessenger`.
@@ -1043,11 +1577,383 @@ class LayrzBlePlatformChannelSetup {
     } else {
       openBluetoothSettingsChannel.setMessageHandler(nil)
     }
+    let requestScanResyncChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.requestScanResync\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      requestScanResyncChannel.setMessageHandler { _, reply in
+        api.requestScanResync { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      requestScanResyncChannel.setMessageHandler(nil)
+    }
+    let setScanCacheLimitsChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanCacheLimits\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      setScanCacheLimitsChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let maxDevicesArg: Int64? = nilOrValue(args[0])
+        let deviceTtlMsArg: Int64? = nilOrValue(args[1])
+        api.setScanCacheLimits(maxDevices: maxDevicesArg, deviceTtlMs: deviceTtlMsArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      setScanCacheLimitsChannel.setMessageHandler(nil)
+    }
+    let getScanCacheStatsChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getScanCacheStats\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      getScanCacheStatsChannel.setMessageHandler { _, reply in
+        api.getScanCacheStats { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      getScanCacheStatsChannel.setMessageHandler(nil)
+    }
+    let setScanAddressFiltersChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanAddressFilters\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      setScanAddressFiltersChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let allowlistArg = args[0] as! [String]
+        let denylistArg = args[1] as! [String]
+        api.setScanAddressFilters(allowlist: allowlistArg, denylist: denylistArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      setScanAddressFiltersChannel.setMessageHandler(nil)
+    }
+    let setManufacturerDataFiltersChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setManufacturerDataFilters\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      setManufacturerDataFiltersChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let filtersArg = args[0] as! [BtManufacturerDataFilter]
+        api.setManufacturerDataFilters(filters: filtersArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      setManufacturerDataFiltersChannel.setMessageHandler(nil)
+    }
+    let getManufacturerDataFilterHitsChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getManufacturerDataFilterHits\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      getManufacturerDataFilterHitsChannel.setMessageHandler { _, reply in
+        api.getManufacturerDataFilterHits { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      getManufacturerDataFilterHitsChannel.setMessageHandler(nil)
+    }
+    let setRssiSmoothingChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setRssiSmoothing\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      setRssiSmoothingChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let modeArg = args[0] as! Int64
+        let emaAlphaArg = args[1] as! Double
+        let kalmanProcessNoiseArg = args[2] as! Double
+        let kalmanMeasurementNoiseArg = args[3] as! Double
+        let medianWindowArg = args[4] as! Int64
+        let minDeltaDbmArg = args[5] as! Int64
+        let maxIntervalMsArg = args[6] as! Int64
+        api.setRssiSmoothing(mode: modeArg, emaAlpha: emaAlphaArg, kalmanProcessNoise: kalmanProcessNoiseArg, kalmanMeasurementNoise: kalmanMeasurementNoiseArg, medianWindow: medianWindowArg, minDeltaDbm: minDeltaDbmArg, maxIntervalMs: maxIntervalMsArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      setRssiSmoothingChannel.setMessageHandler(nil)
+    }
+    let setScanCaptureChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanCapture\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      setScanCaptureChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let pathArg: String? = nilOrValue(args[0])
+        api.setScanCapture(path: pathArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      setScanCaptureChannel.setMessageHandler(nil)
+    }
+    let getScanMetricsChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getScanMetrics\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      getScanMetricsChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let resetArg = args[0] as! Bool
+        api.getScanMetrics(reset: resetArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      getScanMetricsChannel.setMessageHandler(nil)
+    }
+    let dumpScanMetricsChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.dumpScanMetrics\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      dumpScanMetricsChannel.setMessageHandler { _, reply in
+        api.dumpScanMetrics { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      dumpScanMetricsChannel.setMessageHandler(nil)
+    }
+    let setScanBackpressureChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanBackpressure\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      setScanBackpressureChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let policyArg = args[0] as! Int64
+        let maxQueuedDevicesArg = args[1] as! Int64
+        api.setScanBackpressure(policy: policyArg, maxQueuedDevices: maxQueuedDevicesArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      setScanBackpressureChannel.setMessageHandler(nil)
+    }
+    let getScanQueueStatsChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getScanQueueStats\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      getScanQueueStatsChannel.setMessageHandler { _, reply in
+        api.getScanQueueStats { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      getScanQueueStatsChannel.setMessageHandler(nil)
+    }
+    let getAdvertisingInfoChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getAdvertisingInfo\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      getAdvertisingInfoChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let macAddressArg = args[0] as! String
+        api.getAdvertisingInfo(macAddress: macAddressArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      getAdvertisingInfoChannel.setMessageHandler(nil)
+    }
+    let getConnectTimingsChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getConnectTimings\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      getConnectTimingsChannel.setMessageHandler { _, reply in
+        api.getConnectTimings { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      getConnectTimingsChannel.setMessageHandler(nil)
+    }
+    let setGattCacheChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setGattCache\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      setGattCacheChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let directoryArg: String? = nilOrValue(args[0])
+        api.setGattCache(directory: directoryArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      setGattCacheChannel.setMessageHandler(nil)
+    }
+    let clearGattCacheChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.clearGattCache\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      clearGattCacheChannel.setMessageHandler { _, reply in
+        api.clearGattCache { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      clearGattCacheChannel.setMessageHandler(nil)
+    }
+    let setLazyServiceDiscoveryChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setLazyServiceDiscovery\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      setLazyServiceDiscoveryChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let enabledArg = args[0] as! Bool
+        api.setLazyServiceDiscovery(enabled: enabledArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      setLazyServiceDiscoveryChannel.setMessageHandler(nil)
+    }
+    let readCharacteristicByHandleChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.readCharacteristicByHandle\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      readCharacteristicByHandleChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let handleArg = args[0] as! Int64
+        api.readCharacteristicByHandle(handle: handleArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      readCharacteristicByHandleChannel.setMessageHandler(nil)
+    }
+    let writeCharacteristicByHandleChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.writeCharacteristicByHandle\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      writeCharacteristicByHandleChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let handleArg = args[0] as! Int64
+        let payloadArg = args[1] as! FlutterStandardTypedData
+        let withResponseArg = args[2] as! Bool
+        api.writeCharacteristicByHandle(handle: handleArg, payload: payloadArg, withResponse: withResponseArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      writeCharacteristicByHandleChannel.setMessageHandler(nil)
+    }
+    let startNotifyByHandleChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.startNotifyByHandle\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      startNotifyByHandleChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let handleArg = args[0] as! Int64
+        api.startNotifyByHandle(handle: handleArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      startNotifyByHandleChannel.setMessageHandler(nil)
+    }
+    let stopNotifyByHandleChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.stopNotifyByHandle\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      stopNotifyByHandleChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let handleArg = args[0] as! Int64
+        api.stopNotifyByHandle(handle: handleArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      stopNotifyByHandleChannel.setMessageHandler(nil)
+    }
+    let setScanCoalescingWindowChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanCoalescingWindow\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      setScanCoalescingWindowChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let windowMsArg = args[0] as! Int64
+        api.setScanCoalescingWindow(windowMs: windowMsArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      setScanCoalescingWindowChannel.setMessageHandler(nil)
+    }
   }
 }
 /// Generated protocol from Pigeon that represents Flutter messages that can be called from Swift.
 protocol LayrzBleCallbackChannelProtocol {
   func onScanResult(device deviceArg: BtDevice, completion: @escaping (Result<Void, PigeonError>) -> Void)
+  func onScanResults(devices devicesArg: [BtDevice], completion: @escaping (Result<Void, PigeonError>) -> Void)
   func onBluetoothOn(completion: @escaping (Result<Void, PigeonError>) -> Void)
   func onBluetoothOff(completion: @escaping (Result<Void, PigeonError>) -> Void)
   func onScanStarted(completion: @escaping (Result<Void, PigeonError>) -> Void)
@@ -1062,6 +1968,8 @@ protocol LayrzBleCallbackChannelProtocol {
   func onGattReadRequest(request requestArg: BtGattReadRequest, completion: @escaping (Result<Void, PigeonError>) -> Void)
   func onGattWriteRequest(request requestArg: BtGattWriteRequest, completion: @escaping (Result<Void, PigeonError>) -> Void)
   func onGattMtuChanged(macAddress macAddressArg: String, newMtu newMtuArg: Int64, completion: @escaping (Result<Void, PigeonError>) -> Void)
+  func onScanDeltas(deltas deltasArg: [BtDeviceDelta], completion: @escaping (Result<Void, PigeonError>) -> Void)
+  func onDeviceLost(macAddress macAddressArg: String, addressType addressTypeArg: Int64?, completion: @escaping (Result<Void, PigeonError>) -> Void)
 }
 class LayrzBleCallbackChannel: LayrzBleCallbackChannelProtocol {
   private let binaryMessenger: FlutterBinaryMessenger
@@ -1091,6 +1999,24 @@ class LayrzBleCallbackChannel: LayrzBleCallbackChannelProtocol {
       }
     }
   }
+  func onScanResults(devices devicesArg: [BtDevice], completion: @escaping (Result<Void, PigeonError>) -> Void) {
+    let channelName: String = "dev.flutter.pigeon.layrz_ble.LayrzBleCallbackChannel.onScanResults\(messageChannelSuffix)"
+    let channel = FlutterBasicMessageChannel(name: channelName, binaryMessenger: binaryMessenger, codec: codec)
+    channel.sendMessage([devicesArg] as [Any?]) { response in
+      guard let listResponse = response as? [Any?] else {
+        completion(.failure(createConnectionError(withChannelName: channelName)))
+        return
+      }
+      if listResponse.count > 1 {
+        let code: String = listResponse[0] as! String
+        let message: String? = nilOrValue(listResponse[1])
+        let details: String? = nilOrValue(listResponse[2])
+        completion(.failure(PigeonError(code: code, message: message, details: details)))
+      } else {
+        completion(.success(()))
+      }
+    }
+  }
   func onBluetoothOn(completion: @escaping (Result<Void, PigeonError>) -> Void) {
     let channelName: String = "dev.flutter.pigeon.layrz_ble.LayrzBleCallbackChannel.onBluetoothOn\(messageChannelSuffix)"
     let channel = FlutterBasicMessageChannel(name: channelName, binaryMessenger: binaryMessenger, codec: codec)
@@ -1343,4 +2269,40 @@ class LayrzBleCallbackChannel: LayrzBleCallbackChannelProtocol {
       }
     }
   }
+  func onScanDeltas(deltas deltasArg: [BtDeviceDelta], completion: @escaping (Result<Void, PigeonError>) -> Void) {
+    let channelName: String = "dev.flutter.pigeon.layrz_ble.LayrzBleCallbackChannel.onScanDeltas\(messageChannelSuffix)"
+    let channel = FlutterBasicMessageChannel(name: channelName, binaryMessenger: binaryMessenger, codec: codec)
+    channel.sendMessage([deltasArg] as [Any?]) { response in
+      guard let listResponse = response as? [Any?] else {
+        completion(.failure(createConnectionError(withChannelName: channelName)))
+        return
+      }
+      if listResponse.count > 1 {
+        let code: String = listResponse[0] as! String
+        let message: String? = nilOrValue(listResponse[1])
+        let details: String? = nilOrValue(listResponse[2])
+        completion(.failure(PigeonError(code: code, message: message, details: details)))
+      } else {
+        completion(.success(()))
+      }
+    }
+  }
+  func onDeviceLost(macAddress macAddressArg: String, addressType addressTypeArg: Int64?, completion: @escaping (Result<Void, PigeonError>) -> Void) {
+    let channelName: String = "dev.flutter.pigeon.layrz_ble.LayrzBleCallbackChannel.onDeviceLost\(messageChannelSuffix)"
+    let channel = FlutterBasicMessageChannel(name: channelName, binaryMessenger: binaryMessenger, codec: codec)
+    channel.sendMessage([macAddressArg, addressTypeArg] as [Any?]) { response in
+      guard let listResponse = response as? [Any?] else {
+        completion(.failure(createConnectionError(withChannelName: channelName)))
+        return
+      }
+      if listResponse.count > 1 {
+        let code: String = listResponse[0] as! String
+        let message: String? = nilOrValue(listResponse[1])
+        let details: String? = nilOrValue(listResponse[2])
+        completion(.failure(PigeonError(code: code, message: message, details: details)))
+      } else {
+        completion(.success(()))
+      }
+    }
+  }
 }
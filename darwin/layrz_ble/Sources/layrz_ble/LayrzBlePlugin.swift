@@ -37,6 +37,9 @@ private class LayrzBleDarwin: NSObject, LayrzBlePlatformChannel, CBCentralManage
     var discoveredPeripherals: [CBPeripheral] = []
     var devices: [String: CBPeripheral] = [:]
     var filteredUuid: String?
+    var allowedIdentifiers: Set<String> = []
+    var deniedIdentifiers: Set<String> = []
+    var manufacturerDataMatcher = ManufacturerDataMatcher(filters: [])
 
     init(callbackChannel: LayrzBleCallbackChannel) {
         self.callbackChannel = callbackChannel
@@ -117,6 +120,163 @@ private class LayrzBleDarwin: NSObject, LayrzBlePlatformChannel, CBCentralManage
         #endif
     }
 
+    func requestScanResync(completion: @escaping (Result<Bool, any Error>) -> Void) {
+        // Scan results are always sent in full through onScanResult, there is nothing to resync
+        completion(.success(false))
+    }
+
+    func setScanCacheLimits(maxDevices: Int64?, deviceTtlMs: Int64?, completion: @escaping (Result<Bool, any Error>) -> Void) {
+        // The scanned devices are not aged here, the table only holds the CBPeripheral handles
+        completion(.success(false))
+    }
+
+    func setScanCoalescingWindow(windowMs: Int64, completion: @escaping (Result<Bool, any Error>) -> Void) {
+        // Scan results are sent one by one as CoreBluetooth reports them, nothing is coalesced
+        completion(.success(false))
+    }
+
+    func setScanAddressFilters(allowlist: [String], denylist: [String], completion: @escaping (Result<Bool, any Error>) -> Void) {
+        // The peripherals are identified by their identifier UUID here, not by a MAC address
+        allowedIdentifiers = Set(allowlist.map { $0.uppercased() })
+        deniedIdentifiers = Set(denylist.map { $0.uppercased() })
+        completion(.success(true))
+    }
+
+    func setManufacturerDataFilters(filters: [BtManufacturerDataFilter], completion: @escaping (Result<Bool, any Error>) -> Void) {
+        if (!filters.allSatisfy { ManufacturerDataMatcher.isValid($0) }) {
+            log("Invalid manufacturer data filters")
+            completion(.success(false))
+            return
+        }
+
+        manufacturerDataMatcher = ManufacturerDataMatcher(filters: filters)
+        completion(.success(true))
+    }
+
+    func getManufacturerDataFilterHits(completion: @escaping (Result<[Int64], any Error>) -> Void) {
+        completion(.success(manufacturerDataMatcher.hits))
+    }
+
+    func setRssiSmoothing(
+        mode: Int64,
+        emaAlpha: Double,
+        kalmanProcessNoise: Double,
+        kalmanMeasurementNoise: Double,
+        medianWindow: Int64,
+        minDeltaDbm: Int64,
+        maxIntervalMs: Int64,
+        completion: @escaping (Result<Bool, any Error>) -> Void
+    ) {
+        // Every discovery is sent as reported by CoreBluetooth, there is no device table to smooth here
+        completion(.success(false))
+    }
+
+    func setScanCapture(path: String?, completion: @escaping (Result<Bool, any Error>) -> Void) {
+        // CoreBluetooth does not expose the raw advertisement bytes, there is nothing to capture
+        completion(.success(false))
+    }
+
+    func getScanMetrics(reset: Bool, completion: @escaping (Result<BtScanMetrics, any Error>) -> Void) {
+        // Only the Windows scan path is instrumented, the metrics stay empty here
+        completion(.success(BtScanMetrics(
+            received: 0,
+            dropped: 0,
+            filtered: 0,
+            duplicates: 0,
+            merged: 0,
+            coalesced: 0,
+            encoded: 0,
+            posted: 0,
+            ingestLatencyBuckets: [],
+            ingestLatencyMaxUs: 0,
+            postLatencyBuckets: [],
+            postLatencyMaxUs: 0
+        )))
+    }
+
+    func dumpScanMetrics(completion: @escaping (Result<Bool, any Error>) -> Void) {
+        completion(.success(false))
+    }
+
+    func setScanBackpressure(policy: Int64, maxQueuedDevices: Int64, completion: @escaping (Result<Bool, any Error>) -> Void) {
+        // Scan results are sent one by one as CoreBluetooth reports them, there is no native queue to bound
+        completion(.success(false))
+    }
+
+    func getScanQueueStats(completion: @escaping (Result<BtScanQueueStats, any Error>) -> Void) {
+        completion(.success(BtScanQueueStats(
+            policy: 0,
+            capacity: 0,
+            depth: 0,
+            highWatermark: 0,
+            queuedEvents: 0,
+            deliveredEvents: 0,
+            droppedEvents: 0,
+            droppedDevices: 0,
+            deferredFlushes: 0,
+            pauses: 0,
+            pausedAdvertisements: 0
+        )))
+    }
+
+    func getAdvertisingInfo(macAddress: String, completion: @escaping (Result<BtAdvertisingInfo?, any Error>) -> Void) {
+        // CoreBluetooth does not report extended advertising details
+        completion(.success(nil))
+    }
+
+    func getConnectTimings(completion: @escaping (Result<BtConnectTimings?, any Error>) -> Void) {
+        // Connection phases are not timed on CoreBluetooth
+        completion(.success(nil))
+    }
+
+    func setGattCache(directory: String?, completion: @escaping (Result<Bool, any Error>) -> Void) {
+        // CoreBluetooth caches the GATT database of known peripherals itself
+        completion(.success(false))
+    }
+
+    func clearGattCache(completion: @escaping (Result<Int64, any Error>) -> Void) {
+        completion(.success(0))
+    }
+
+    func setLazyServiceDiscovery(enabled: Bool, completion: @escaping (Result<Bool, any Error>) -> Void) {
+        // Every service is discovered on connect by didConnect, the discovery is not split per service
+        completion(.success(false))
+    }
+
+    // Characteristics are only addressed by UUID on iOS and macOS, discoverServices returns no handle
+    func readCharacteristicByHandle(handle: Int64, completion: @escaping (Result<FlutterStandardTypedData, any Error>) -> Void) {
+        completion(.success(FlutterStandardTypedData(bytes: Data())))
+    }
+
+    func writeCharacteristicByHandle(
+        handle: Int64,
+        payload: FlutterStandardTypedData,
+        withResponse: Bool,
+        completion: @escaping (Result<Bool, any Error>) -> Void
+    ) {
+        completion(.success(false))
+    }
+
+    func startNotifyByHandle(handle: Int64, completion: @escaping (Result<Bool, any Error>) -> Void) {
+        completion(.success(false))
+    }
+
+    func stopNotifyByHandle(handle: Int64, completion: @escaping (Result<Bool, any Error>) -> Void) {
+        completion(.success(false))
+    }
+
+    func getScanCacheStats(completion: @escaping (Result<BtScanCacheStats, any Error>) -> Void) {
+        completion(.success(BtScanCacheStats(
+            devices: Int64(devices.count),
+            maxDevices: 0,
+            deviceTtlMs: 0,
+            evictedByTtl: 0,
+            evictedByCapacity: 0,
+            approximateBytes: 0,
+            watcherDevices: 0
+        )))
+    }
+
     func startScan(macAddress: String?, servicesUuids: [String]?, completion: @escaping (Result<Bool, any Error>) -> Void) {
         if (centralManager.isScanning) {
             log("Already scanning")
@@ -146,6 +306,9 @@ private class LayrzBleDarwin: NSObject, LayrzBlePlatformChannel, CBCentralManage
         let name = peripheral.name
         let uuid = peripheral.identifier.uuidString.uppercased()
         if (filteredUuid != nil && uuid != filteredUuid) { return }
+        if (deniedIdentifiers.contains(uuid)) { return }
+        if (!allowedIdentifiers.isEmpty && !allowedIdentifiers.contains(uuid)) { return }
+        if (!manufacturerDataMatcher.matches(advertisementData[CBAdvertisementDataManufacturerDataKey] as? Data)) { return }
         
         var manufacturerData: [BtManufacturerData] = []
         if let rawManufacturerData = advertisementData[CBAdvertisementDataManufacturerDataKey] as? Data {
@@ -166,7 +329,9 @@ private class LayrzBleDarwin: NSObject, LayrzBlePlatformChannel, CBCentralManage
             for (serviceUuid, data) in raw {
                 serviceData.append(BtServiceData(
                     uuid: standarizeServiceUuid(serviceUuid),
-                    data: FlutterStandardTypedData(bytes: data)
+                    data: FlutterStandardTypedData(bytes: data),
+                    // CBUUID shortens the UUIDs built on the Bluetooth base UUID, only the others are 16 bytes
+                    fullUuid: serviceUuid.data.count == 16 ? serviceUuid.uuidString : nil
                 ))
             }
         }
@@ -10,6 +10,7 @@ import 'package:layrz_ble/src/platform_interface.dart';
 export 'package:layrz_models/layrz_models.dart'
     show BleDevice, BleService, BleCharacteristic, BleProperty, BleManufacturerData, BleServiceData;
 
+export 'src/service_data_uuid.dart' show BleServiceDataFullUuid;
 export 'src/types/types.dart';
 
 class LayrzBle {
@@ -105,6 +106,162 @@ class LayrzBle {
     return _platform.stopScan();
   }
 
+  /// [setScanCacheLimits] bounds the table of visible devices kept by the native side during a scan.
+  /// Beyond [maxDevices] the least recently seen devices are evicted (`0` means unbounded), and with a
+  /// [deviceTtl] the devices not seen for that long are evicted as well ([Duration.zero] disables it).
+  /// A limit left out keeps its current value.
+  ///
+  /// Every evicted device is reported through [onEvent] as a [BleDeviceLost] event.
+  /// Only supported on Windows, where the table is bounded to 2048 devices without TTL by default.
+  /// On the other platforms, this method returns `false`.
+  Future<bool> setScanCacheLimits({int? maxDevices, Duration? deviceTtl}) {
+    return _platform.setScanCacheLimits(maxDevices: maxDevices, deviceTtl: deviceTtl);
+  }
+
+  /// [setScanCoalescingWindow] sets the [window] over which the scan results of a device are merged into
+  /// one message, 100 ms by default. A longer window sends fewer messages with a staler RSSI, and
+  /// [Duration.zero] sends every result as soon as it is merged. A negative [window] is rejected.
+  /// Applies right away, also to a running scan.
+  ///
+  /// Only supported on Windows, on the other platforms this method returns `false`.
+  Future<bool> setScanCoalescingWindow(Duration window) {
+    return _platform.setScanCoalescingWindow(window);
+  }
+
+  /// [getScanCacheStats] returns the size and the memory usage of the table of visible devices.
+  ///
+  /// Returns `null` on Linux and Web.
+  Future<BleScanCacheStats?> getScanCacheStats() {
+    return _platform.getScanCacheStats();
+  }
+
+  /// [setScanAddressFilters] replaces the lists of addresses reported by the scan, without restarting it.
+  /// When [allowlist] is not empty, only its addresses are reported, and the addresses of [denylist] are
+  /// never reported. Pass empty lists to remove the filters.
+  ///
+  /// The visible devices rejected by the new lists are reported through [onEvent] as [BleDeviceLost]
+  /// events on Windows. On iOS and macOS, the lists hold the identifiers of the peripherals.
+  /// On Linux and Web, this method returns `false`.
+  Future<bool> setScanAddressFilters({List<String> allowlist = const [], List<String> denylist = const []}) {
+    return _platform.setScanAddressFilters(allowlist: allowlist, denylist: denylist);
+  }
+
+  /// [setManufacturerDataFilters] only reports the devices whose manufacturer data matches [filters],
+  /// checked natively on the raw advertisement before anything is sent to Dart. Pass an empty list to
+  /// remove the filters. Can be called while scanning, the devices already reported are kept.
+  ///
+  /// Up to 64 filters on Windows. On Linux and Web, this method returns `false`.
+  Future<bool> setManufacturerDataFilters(List<BleManufacturerDataFilter> filters) {
+    return _platform.setManufacturerDataFilters(filters);
+  }
+
+  /// [getManufacturerDataFilterHits] returns the number of advertisements matched by each filter of
+  /// [setManufacturerDataFilters], in the same order.
+  ///
+  /// Returns `null` on Linux and Web.
+  Future<List<int>?> getManufacturerDataFilterHits() {
+    return _platform.getManufacturerDataFilterHits();
+  }
+
+  /// [setRssiSmoothing] smooths the RSSI of the scanned devices natively, and only reports it again once
+  /// the smoothed value moved by [BleRssiSmoothing.minDeltaDbm] or [BleRssiSmoothing.maxInterval] elapsed.
+  /// A device whose only change is an unreported RSSI is not sent at all.
+  ///
+  /// Only supported on Windows, on the other platforms this method returns `false`.
+  Future<bool> setRssiSmoothing(BleRssiSmoothing smoothing) {
+    return _platform.setRssiSmoothing(smoothing);
+  }
+
+  /// [setScanCapture] records every raw advertisement received while scanning to a binary capture file at
+  /// [path], appended to if it already exists, so a field problem can be replayed offline with the
+  /// `capture_replay` tool of the Windows core. A `null` [path] stops the capture and closes the file.
+  ///
+  /// Only supported on Windows, on the other platforms this method returns `false`.
+  Future<bool> setScanCapture({String? path}) {
+    return _platform.setScanCapture(path: path);
+  }
+
+  /// [getScanMetrics] returns the counters of every stage of the native scan path (received, dropped,
+  /// filtered, duplicates, merged, coalesced, encoded, posted) and the ingest and post latency histograms,
+  /// since the plugin started. With [reset] the metrics start over after being read.
+  ///
+  /// Only the Windows scan path is instrumented, Android and iOS return empty metrics and Linux and Web
+  /// return `null`.
+  Future<BleScanMetrics?> getScanMetrics({bool reset = false}) {
+    return _platform.getScanMetrics(reset: reset);
+  }
+
+  /// [dumpScanMetrics] writes the scan metrics to the native log, next to the lines of the scan.
+  ///
+  /// Only supported on Windows, on the other platforms this method returns `false`.
+  Future<bool> dumpScanMetrics() {
+    return _platform.dumpScanMetrics();
+  }
+
+  /// [setScanBackpressure] bounds the scan messages waiting for the Dart side to [maxQueuedDevices]
+  /// devices, so a busy UI thread never makes the native memory grow. [policy] is what happens once the
+  /// bound is reached, [BleScanBackpressurePolicy.latestPerDevice] by default. Whatever the policy, the
+  /// oldest messages are dropped rather than exceeding the bound.
+  ///
+  /// Only supported on Windows, on the other platforms this method returns `false`.
+  Future<bool> setScanBackpressure(BleScanBackpressurePolicy policy, {int maxQueuedDevices = 4096}) {
+    return _platform.setScanBackpressure(policy, maxQueuedDevices: maxQueuedDevices);
+  }
+
+  /// [getScanQueueStats] returns the depth of the scan messages waiting for the Dart side and the counts
+  /// of dropped messages, held back batches and pauses.
+  ///
+  /// Only supported on Windows, Android and iOS return empty stats and Linux and Web return `null`.
+  Future<BleScanQueueStats?> getScanQueueStats() {
+    return _platform.getScanQueueStats();
+  }
+
+  /// [getAdvertisingInfo] returns the Bluetooth 5 advertising details of a device seen by the scan: whether
+  /// it sent extended advertisements (payloads over 31 bytes, up to 1650) and the PHYs they came on.
+  ///
+  /// The PHYs need Windows 11 24H2, the advertising set identifier is not reported by Windows.
+  ///
+  /// Only supported on Windows, the other platforms return `null`.
+  Future<BleAdvertisingInfo?> getAdvertisingInfo({required String macAddress}) {
+    return _platform.getAdvertisingInfo(macAddress: macAddress);
+  }
+
+  /// [getConnectTimings] returns the time spent by each phase of the last successful [connect]: resolving
+  /// the device, discovering the services and, concurrently, their characteristics.
+  ///
+  /// Only supported on Windows, the other platforms return `null`.
+  Future<BleConnectTimings?> getConnectTimings() {
+    return _platform.getConnectTimings();
+  }
+
+  /// [setGattCache] caches the GATT layout (services, characteristics and properties) of every connected
+  /// device on disk, one small file per device under [directory]. A reconnection to a known device then
+  /// skips the discovery, the layout is checked in the background against the Database Hash of the device
+  /// and dropped on a Service Changed indication. A `null` [directory] disables the cache, the files are
+  /// kept.
+  ///
+  /// Only supported on Windows, the other platforms return `false`.
+  Future<bool> setGattCache({String? directory}) {
+    return _platform.setGattCache(directory: directory);
+  }
+
+  /// [clearGattCache] deletes every cached GATT layout and returns the number of layouts deleted.
+  ///
+  /// Only supported on Windows, the other platforms return `0`.
+  Future<int> clearGattCache() {
+    return _platform.clearGattCache();
+  }
+
+  /// [setLazyServiceDiscovery] makes [connect] report the connection without discovering the services.
+  /// Each service is then discovered the first time [discoverServices], [readCharacteristic],
+  /// [writeCharacteristic] or [startNotify] references it, and kept for the rest of the connection. An app
+  /// that only uses one service never waits for the others. Applies to the next connection.
+  ///
+  /// Only supported on Windows, the other platforms return `false`.
+  Future<bool> setLazyServiceDiscovery({required bool enabled}) {
+    return _platform.setLazyServiceDiscovery(enabled: enabled);
+  }
+
   /// [setMtu] sets the MTU size for the BLE connection.
   /// The MTU size is the maximum number of bytes that can be sent in a single packet, also, MTU means
   /// Maximum Transmission Unit and it is the maximum size of a packet that can be sent in a single transmission.
@@ -226,6 +383,77 @@ class LayrzBle {
     );
   }
 
+  /// [characteristicHandle] returns the handle of a characteristic, as returned by the last
+  /// [discoverServices] of the device, for [writeCharacteristicByHandle], [readCharacteristicByHandle],
+  /// [startNotifyByHandle] and [stopNotifyByHandle]. Look it up once, outside of the loops: those calls
+  /// then send no UUID to the native side, which resolves nothing but the handle.
+  ///
+  /// A handle is valid until the services are discovered again or the device disconnects.
+  ///
+  /// Only supported on Windows, the other platforms return `null`.
+  int? characteristicHandle({
+    /// [macAddress] is the MAC address of the device.
+    required String macAddress,
+
+    /// [serviceUuid] is the UUID of the service.
+    required String serviceUuid,
+
+    /// [characteristicUuid] is the UUID of the characteristic.
+    required String characteristicUuid,
+  }) {
+    return _platform.characteristicHandle(
+      macAddress: macAddress,
+      serviceUuid: serviceUuid,
+      characteristicUuid: characteristicUuid,
+    );
+  }
+
+  /// [writeCharacteristicByHandle] is [writeCharacteristic] by the handle of [characteristicHandle].
+  ///
+  /// Only supported on Windows, the other platforms return `false`.
+  Future<bool> writeCharacteristicByHandle({
+    /// [handle] is the handle of the characteristic.
+    required int handle,
+
+    /// [payload] is the data to send to the characteristic.
+    required Uint8List payload,
+
+    /// [withResponse] is a flag to indicate if the write should be with response or not.
+    required bool withResponse,
+  }) {
+    return _platform.writeCharacteristicByHandle(handle: handle, payload: payload, withResponse: withResponse);
+  }
+
+  /// [readCharacteristicByHandle] is [readCharacteristic] by the handle of [characteristicHandle].
+  ///
+  /// Only supported on Windows, the other platforms return `null`.
+  Future<Uint8List?> readCharacteristicByHandle({
+    /// [handle] is the handle of the characteristic.
+    required int handle,
+  }) {
+    return _platform.readCharacteristicByHandle(handle: handle);
+  }
+
+  /// [startNotifyByHandle] is [startNotify] by the handle of [characteristicHandle].
+  ///
+  /// Only supported on Windows, the other platforms return `false`.
+  Future<bool> startNotifyByHandle({
+    /// [handle] is the handle of the characteristic.
+    required int handle,
+  }) {
+    return _platform.startNotifyByHandle(handle: handle);
+  }
+
+  /// [stopNotifyByHandle] is [stopNotify] by the handle of [characteristicHandle].
+  ///
+  /// Only supported on Windows, the other platforms return `false`.
+  Future<bool> stopNotifyByHandle({
+    /// [handle] is the handle of the characteristic.
+    required int handle,
+  }) {
+    return _platform.stopNotifyByHandle(handle: handle);
+  }
+
   /// [startAdvertise] starts advertising a BLE device.
   ///
   /// The advertisement packet will contain the [manufacturerData] and [serviceData] provided, and the advertisement
@@ -271,16 +271,20 @@ class BtServiceData {
   BtServiceData({
     required this.uuid,
     this.data,
+    this.fullUuid,
   });
 
   int uuid;
 
   Uint8List? data;
 
+  String? fullUuid;
+
   List<Object?> _toList() {
     return <Object?>[
       uuid,
       data,
+      fullUuid,
     ];
   }
 
@@ -292,6 +296,7 @@ class BtServiceData {
     return BtServiceData(
       uuid: result[0]! as int,
       data: result[1] as Uint8List?,
+      fullUuid: result[2] as String?,
     );
   }
 
@@ -304,7 +309,7 @@ class BtServiceData {
     if (identical(this, other)) {
       return true;
     }
-    return _deepEquals(uuid, other.uuid) && _deepEquals(data, other.data);
+    return _deepEquals(uuid, other.uuid) && _deepEquals(data, other.data) && _deepEquals(fullUuid, other.fullUuid);
   }
 
   @override
@@ -361,16 +366,20 @@ class BtCharacteristic {
   BtCharacteristic({
     required this.uuid,
     required this.properties,
+    this.handle,
   });
 
   String uuid;
 
   List<String> properties;
 
+  int? handle;
+
   List<Object?> _toList() {
     return <Object?>[
       uuid,
       properties,
+      handle,
     ];
   }
 
@@ -382,6 +391,7 @@ class BtCharacteristic {
     return BtCharacteristic(
       uuid: result[0]! as String,
       properties: (result[1]! as List<Object?>).cast<String>(),
+      handle: result[2] as int?,
     );
   }
 
@@ -394,7 +404,7 @@ class BtCharacteristic {
     if (identical(this, other)) {
       return true;
     }
-    return _deepEquals(uuid, other.uuid) && _deepEquals(properties, other.properties);
+    return _deepEquals(uuid, other.uuid) && _deepEquals(properties, other.properties) && _deepEquals(handle, other.handle);
   }
 
   @override
@@ -592,94 +602,989 @@ class BtGattWriteRequest {
   int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
 }
 
+class BtDeviceDelta {
+  BtDeviceDelta({
+    required this.macAddress,
+    required this.changedFields,
+    this.name,
+    this.rssi,
+    this.txPower,
+    this.manufacturerData,
+    this.serviceData,
+    this.addressType,
+  });
+
+  String macAddress;
+
+  int changedFields;
+
+  String? name;
+
+  int? rssi;
+
+  int? txPower;
+
+  List<BtManufacturerData>? manufacturerData;
+
+  List<BtServiceData>? serviceData;
+
+  int? addressType;
+
+  List<Object?> _toList() {
+    return <Object?>[
+      macAddress,
+      changedFields,
+      name,
+      rssi,
+      txPower,
+      manufacturerData,
+      serviceData,
+      addressType,
+    ];
+  }
+
+  Object encode() {
+    return _toList();  }
+
+  static BtDeviceDelta decode(Object result) {
+    result as List<Object?>;
+    return BtDeviceDelta(
+      macAddress: result[0]! as String,
+      changedFields: result[1]! as int,
+      name: result[2] as String?,
+      rssi: result[3] as int?,
+      txPower: result[4] as int?,
+      manufacturerData: (result[5] as List<Object?>?)?.cast<BtManufacturerData>(),
+      serviceData: (result[6] as List<Object?>?)?.cast<BtServiceData>(),
+      addressType: result[7] as int?,
+    );
+  }
 
-class _PigeonCodec extends StandardMessageCodec {
-  const _PigeonCodec();
   @override
-  void writeValue(WriteBuffer buffer, Object? value) {
-    if (value is int) {
-      buffer.putUint8(4);
-      buffer.putInt64(value);
-    }    else if (value is BtStatus) {
-      buffer.putUint8(129);
-      writeValue(buffer, value.encode());
-    }    else if (value is BtDevice) {
-      buffer.putUint8(130);
-      writeValue(buffer, value.encode());
-    }    else if (value is BtManufacturerData) {
-      buffer.putUint8(131);
-      writeValue(buffer, value.encode());
-    }    else if (value is BtServiceData) {
-      buffer.putUint8(132);
-      writeValue(buffer, value.encode());
-    }    else if (value is BtService) {
-      buffer.putUint8(133);
-      writeValue(buffer, value.encode());
-    }    else if (value is BtCharacteristic) {
-      buffer.putUint8(134);
-      writeValue(buffer, value.encode());
-    }    else if (value is BtCharacteristicNotification) {
-      buffer.putUint8(135);
-      writeValue(buffer, value.encode());
-    }    else if (value is BtGattReadRequest) {
-      buffer.putUint8(136);
-      writeValue(buffer, value.encode());
-    }    else if (value is BtGattWriteRequest) {
-      buffer.putUint8(137);
-      writeValue(buffer, value.encode());
-    } else {
-      super.writeValue(buffer, value);
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  bool operator ==(Object other) {
+    if (other is! BtDeviceDelta || other.runtimeType != runtimeType) {
+      return false;
     }
+    if (identical(this, other)) {
+      return true;
+    }
+    return _deepEquals(macAddress, other.macAddress) && _deepEquals(changedFields, other.changedFields) && _deepEquals(name, other.name) && _deepEquals(rssi, other.rssi) && _deepEquals(txPower, other.txPower) && _deepEquals(manufacturerData, other.manufacturerData) && _deepEquals(serviceData, other.serviceData) && _deepEquals(addressType, other.addressType);
   }
 
   @override
-  Object? readValueOfType(int type, ReadBuffer buffer) {
-    switch (type) {
-      case 129:
-        return BtStatus.decode(readValue(buffer)!);
-      case 130:
-        return BtDevice.decode(readValue(buffer)!);
-      case 131:
-        return BtManufacturerData.decode(readValue(buffer)!);
-      case 132:
-        return BtServiceData.decode(readValue(buffer)!);
-      case 133:
-        return BtService.decode(readValue(buffer)!);
-      case 134:
-        return BtCharacteristic.decode(readValue(buffer)!);
-      case 135:
-        return BtCharacteristicNotification.decode(readValue(buffer)!);
-      case 136:
-        return BtGattReadRequest.decode(readValue(buffer)!);
-      case 137:
-        return BtGattWriteRequest.decode(readValue(buffer)!);
-      default:
-        return super.readValueOfType(type, buffer);
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
+}
+
+
+class BtScanCacheStats {
+  BtScanCacheStats({
+    required this.devices,
+    required this.maxDevices,
+    required this.deviceTtlMs,
+    required this.evictedByTtl,
+    required this.evictedByCapacity,
+    required this.approximateBytes,
+    required this.watcherDevices,
+  });
+
+  int devices;
+
+  int maxDevices;
+
+  int deviceTtlMs;
+
+  int evictedByTtl;
+
+  int evictedByCapacity;
+
+  int approximateBytes;
+
+  int watcherDevices;
+
+  List<Object?> _toList() {
+    return <Object?>[
+      devices,
+      maxDevices,
+      deviceTtlMs,
+      evictedByTtl,
+      evictedByCapacity,
+      approximateBytes,
+      watcherDevices,
+    ];
+  }
+
+  Object encode() {
+    return _toList();  }
+
+  static BtScanCacheStats decode(Object result) {
+    result as List<Object?>;
+    return BtScanCacheStats(
+      devices: result[0]! as int,
+      maxDevices: result[1]! as int,
+      deviceTtlMs: result[2]! as int,
+      evictedByTtl: result[3]! as int,
+      evictedByCapacity: result[4]! as int,
+      approximateBytes: result[5]! as int,
+      watcherDevices: result[6]! as int,
+    );
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  bool operator ==(Object other) {
+    if (other is! BtScanCacheStats || other.runtimeType != runtimeType) {
+      return false;
+    }
+    if (identical(this, other)) {
+      return true;
+    }
+    return _deepEquals(devices, other.devices) && _deepEquals(maxDevices, other.maxDevices) && _deepEquals(deviceTtlMs, other.deviceTtlMs) && _deepEquals(evictedByTtl, other.evictedByTtl) && _deepEquals(evictedByCapacity, other.evictedByCapacity) && _deepEquals(approximateBytes, other.approximateBytes) && _deepEquals(watcherDevices, other.watcherDevices);
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
+}
+
+
+class BtManufacturerDataFilter {
+  BtManufacturerDataFilter({
+    required this.companyId,
+    required this.offset,
+    required this.value,
+    this.mask,
+    required this.group,
+  });
+
+  int companyId;
+
+  int offset;
+
+  Uint8List value;
+
+  Uint8List? mask;
+
+  int group;
+
+  List<Object?> _toList() {
+    return <Object?>[
+      companyId,
+      offset,
+      value,
+      mask,
+      group,
+    ];
+  }
+
+  Object encode() {
+    return _toList();  }
+
+  static BtManufacturerDataFilter decode(Object result) {
+    result as List<Object?>;
+    return BtManufacturerDataFilter(
+      companyId: result[0]! as int,
+      offset: result[1]! as int,
+      value: result[2]! as Uint8List,
+      mask: result[3] as Uint8List?,
+      group: result[4]! as int,
+    );
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  bool operator ==(Object other) {
+    if (other is! BtManufacturerDataFilter || other.runtimeType != runtimeType) {
+      return false;
+    }
+    if (identical(this, other)) {
+      return true;
+    }
+    return _deepEquals(companyId, other.companyId) && _deepEquals(offset, other.offset) && _deepEquals(value, other.value) && _deepEquals(mask, other.mask) && _deepEquals(group, other.group);
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
+}
+
+
+class BtScanMetrics {
+  BtScanMetrics({
+    required this.received,
+    required this.dropped,
+    required this.filtered,
+    required this.duplicates,
+    required this.merged,
+    required this.coalesced,
+    required this.encoded,
+    required this.posted,
+    required this.ingestLatencyBuckets,
+    required this.ingestLatencyMaxUs,
+    required this.postLatencyBuckets,
+    required this.postLatencyMaxUs,
+  });
+
+  int received;
+
+  int dropped;
+
+  int filtered;
+
+  int duplicates;
+
+  int merged;
+
+  int coalesced;
+
+  int encoded;
+
+  int posted;
+
+  List<int> ingestLatencyBuckets;
+
+  int ingestLatencyMaxUs;
+
+  List<int> postLatencyBuckets;
+
+  int postLatencyMaxUs;
+
+  List<Object?> _toList() {
+    return <Object?>[
+      received,
+      dropped,
+      filtered,
+      duplicates,
+      merged,
+      coalesced,
+      encoded,
+      posted,
+      ingestLatencyBuckets,
+      ingestLatencyMaxUs,
+      postLatencyBuckets,
+      postLatencyMaxUs,
+    ];
+  }
+
+  Object encode() {
+    return _toList();  }
+
+  static BtScanMetrics decode(Object result) {
+    result as List<Object?>;
+    return BtScanMetrics(
+      received: result[0]! as int,
+      dropped: result[1]! as int,
+      filtered: result[2]! as int,
+      duplicates: result[3]! as int,
+      merged: result[4]! as int,
+      coalesced: result[5]! as int,
+      encoded: result[6]! as int,
+      posted: result[7]! as int,
+      ingestLatencyBuckets: (result[8]! as List<Object?>).cast<int>(),
+      ingestLatencyMaxUs: result[9]! as int,
+      postLatencyBuckets: (result[10]! as List<Object?>).cast<int>(),
+      postLatencyMaxUs: result[11]! as int,
+    );
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  bool operator ==(Object other) {
+    if (other is! BtScanMetrics || other.runtimeType != runtimeType) {
+      return false;
+    }
+    if (identical(this, other)) {
+      return true;
     }
+    return _deepEquals(received, other.received) && _deepEquals(dropped, other.dropped) && _deepEquals(filtered, other.filtered) && _deepEquals(duplicates, other.duplicates) && _deepEquals(merged, other.merged) && _deepEquals(coalesced, other.coalesced) && _deepEquals(encoded, other.encoded) && _deepEquals(posted, other.posted) && _deepEquals(ingestLatencyBuckets, other.ingestLatencyBuckets) && _deepEquals(ingestLatencyMaxUs, other.ingestLatencyMaxUs) && _deepEquals(postLatencyBuckets, other.postLatencyBuckets) && _deepEquals(postLatencyMaxUs, other.postLatencyMaxUs);
   }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
 }
 
-class LayrzBlePlatformChannel {
-  /// Constructor for [LayrzBlePlatformChannel].  The [binaryMessenger] named argument is
-  /// available for dependency injection.  If it is left null, the default
-  /// BinaryMessenger will be used which routes to the host platform.
-  LayrzBlePlatformChannel({BinaryMessenger? binaryMessenger, String messageChannelSuffix = ''})
-      : pigeonVar_binaryMessenger = binaryMessenger,
-        pigeonVar_messageChannelSuffix = messageChannelSuffix.isNotEmpty ? '.$messageChannelSuffix' : '';
-  final BinaryMessenger? pigeonVar_binaryMessenger;
 
-  static const MessageCodec<Object?> pigeonChannelCodec = _PigeonCodec();
+class BtScanQueueStats {
+  BtScanQueueStats({
+    required this.policy,
+    required this.capacity,
+    required this.depth,
+    required this.highWatermark,
+    required this.queuedEvents,
+    required this.deliveredEvents,
+    required this.droppedEvents,
+    required this.droppedDevices,
+    required this.deferredFlushes,
+    required this.pauses,
+    required this.pausedAdvertisements,
+  });
+
+  int policy;
+
+  int capacity;
+
+  int depth;
+
+  int highWatermark;
+
+  int queuedEvents;
+
+  int deliveredEvents;
+
+  int droppedEvents;
+
+  int droppedDevices;
+
+  int deferredFlushes;
+
+  int pauses;
+
+  int pausedAdvertisements;
+
+  List<Object?> _toList() {
+    return <Object?>[
+      policy,
+      capacity,
+      depth,
+      highWatermark,
+      queuedEvents,
+      deliveredEvents,
+      droppedEvents,
+      droppedDevices,
+      deferredFlushes,
+      pauses,
+      pausedAdvertisements,
+    ];
+  }
+
+  Object encode() {
+    return _toList();  }
+
+  static BtScanQueueStats decode(Object result) {
+    result as List<Object?>;
+    return BtScanQueueStats(
+      policy: result[0]! as int,
+      capacity: result[1]! as int,
+      depth: result[2]! as int,
+      highWatermark: result[3]! as int,
+      queuedEvents: result[4]! as int,
+      deliveredEvents: result[5]! as int,
+      droppedEvents: result[6]! as int,
+      droppedDevices: result[7]! as int,
+      deferredFlushes: result[8]! as int,
+      pauses: result[9]! as int,
+      pausedAdvertisements: result[10]! as int,
+    );
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  bool operator ==(Object other) {
+    if (other is! BtScanQueueStats || other.runtimeType != runtimeType) {
+      return false;
+    }
+    if (identical(this, other)) {
+      return true;
+    }
+    return _deepEquals(policy, other.policy) && _deepEquals(capacity, other.capacity) && _deepEquals(depth, other.depth) && _deepEquals(highWatermark, other.highWatermark) && _deepEquals(queuedEvents, other.queuedEvents) && _deepEquals(deliveredEvents, other.deliveredEvents) && _deepEquals(droppedEvents, other.droppedEvents) && _deepEquals(droppedDevices, other.droppedDevices) && _deepEquals(deferredFlushes, other.deferredFlushes) && _deepEquals(pauses, other.pauses) && _deepEquals(pausedAdvertisements, other.pausedAdvertisements);
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
+}
+
+
+class BtAdvertisingInfo {
+  BtAdvertisingInfo({
+    required this.extended,
+    required this.primaryPhy,
+    required this.secondaryPhy,
+    required this.advertisingSid,
+    required this.maxPayloadLength,
+  });
+
+  bool extended;
+
+  int primaryPhy;
+
+  int secondaryPhy;
+
+  int advertisingSid;
+
+  int maxPayloadLength;
+
+  List<Object?> _toList() {
+    return <Object?>[
+      extended,
+      primaryPhy,
+      secondaryPhy,
+      advertisingSid,
+      maxPayloadLength,
+    ];
+  }
+
+  Object encode() {
+    return _toList();  }
+
+  static BtAdvertisingInfo decode(Object result) {
+    result as List<Object?>;
+    return BtAdvertisingInfo(
+      extended: result[0]! as bool,
+      primaryPhy: result[1]! as int,
+      secondaryPhy: result[2]! as int,
+      advertisingSid: result[3]! as int,
+      maxPayloadLength: result[4]! as int,
+    );
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  bool operator ==(Object other) {
+    if (other is! BtAdvertisingInfo || other.runtimeType != runtimeType) {
+      return false;
+    }
+    if (identical(this, other)) {
+      return true;
+    }
+    return _deepEquals(extended, other.extended) && _deepEquals(primaryPhy, other.primaryPhy) && _deepEquals(secondaryPhy, other.secondaryPhy) && _deepEquals(advertisingSid, other.advertisingSid) && _deepEquals(maxPayloadLength, other.maxPayloadLength);
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
+}
+
+
+class BtConnectTimings {
+  BtConnectTimings({
+    required this.resolveUs,
+    required this.servicesUs,
+    required this.characteristicsUs,
+    required this.slowestServiceUs,
+    required this.totalUs,
+    required this.services,
+    required this.characteristics,
+    required this.failedServices,
+    required this.concurrency,
+  });
+
+  int resolveUs;
+
+  int servicesUs;
+
+  int characteristicsUs;
+
+  int slowestServiceUs;
+
+  int totalUs;
+
+  int services;
+
+  int characteristics;
+
+  int failedServices;
+
+  int concurrency;
+
+  List<Object?> _toList() {
+    return <Object?>[
+      resolveUs,
+      servicesUs,
+      characteristicsUs,
+      slowestServiceUs,
+      totalUs,
+      services,
+      characteristics,
+      failedServices,
+      concurrency,
+    ];
+  }
+
+  Object encode() {
+    return _toList();  }
+
+  static BtConnectTimings decode(Object result) {
+    result as List<Object?>;
+    return BtConnectTimings(
+      resolveUs: result[0]! as int,
+      servicesUs: result[1]! as int,
+      characteristicsUs: result[2]! as int,
+      slowestServiceUs: result[3]! as int,
+      totalUs: result[4]! as int,
+      services: result[5]! as int,
+      characteristics: result[6]! as int,
+      failedServices: result[7]! as int,
+      concurrency: result[8]! as int,
+    );
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  bool operator ==(Object other) {
+    if (other is! BtConnectTimings || other.runtimeType != runtimeType) {
+      return false;
+    }
+    if (identical(this, other)) {
+      return true;
+    }
+    return _deepEquals(resolveUs, other.resolveUs) && _deepEquals(servicesUs, other.servicesUs) && _deepEquals(characteristicsUs, other.characteristicsUs) && _deepEquals(slowestServiceUs, other.slowestServiceUs) && _deepEquals(totalUs, other.totalUs) && _deepEquals(services, other.services) && _deepEquals(characteristics, other.characteristics) && _deepEquals(failedServices, other.failedServices) && _deepEquals(concurrency, other.concurrency);
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
+}
+
+
+
+class _PigeonCodec extends StandardMessageCodec {
+  const _PigeonCodec();
+  @override
+  void writeValue(WriteBuffer buffer, Object? value) {
+    if (value is int) {
+      buffer.putUint8(4);
+      buffer.putInt64(value);
+    }    else if (value is BtStatus) {
+      buffer.putUint8(129);
+      writeValue(buffer, value.encode());
+    }    else if (value is BtDevice) {
+      buffer.putUint8(130);
+      writeValue(buffer, value.encode());
+    }    else if (value is BtManufacturerData) {
+      buffer.putUint8(131);
+      writeValue(buffer, value.encode());
+    }    else if (value is BtServiceData) {
+      buffer.putUint8(132);
+      writeValue(buffer, value.encode());
+    }    else if (value is BtService) {
+      buffer.putUint8(133);
+      writeValue(buffer, value.encode());
+    }    else if (value is BtCharacteristic) {
+      buffer.putUint8(134);
+      writeValue(buffer, value.encode());
+    }    else if (value is BtCharacteristicNotification) {
+      buffer.putUint8(135);
+      writeValue(buffer, value.encode());
+    }    else if (value is BtGattReadRequest) {
+      buffer.putUint8(136);
+      writeValue(buffer, value.encode());
+    }    else if (value is BtGattWriteRequest) {
+      buffer.putUint8(137);
+      writeValue(buffer, value.encode());
+    }    else if (value is BtDeviceDelta) {
+      buffer.putUint8(138);
+      writeValue(buffer, value.encode());
+    }    else if (value is BtScanCacheStats) {
+      buffer.putUint8(139);
+      writeValue(buffer, value.encode());
+    }    else if (value is BtManufacturerDataFilter) {
+      buffer.putUint8(140);
+      writeValue(buffer, value.encode());
+    }    else if (value is BtScanMetrics) {
+      buffer.putUint8(141);
+      writeValue(buffer, value.encode());
+    }    else if (value is BtScanQueueStats) {
+      buffer.putUint8(142);
+      writeValue(buffer, value.encode());
+    }    else if (value is BtAdvertisingInfo) {
+      buffer.putUint8(143);
+      writeValue(buffer, value.encode());
+    }    else if (value is BtConnectTimings) {
+      buffer.putUint8(144);
+      writeValue(buffer, value.encode());
+    } else {
+      super.writeValue(buffer, value);
+    }
+  }
+
+  @override
+  Object? readValueOfType(int type, ReadBuffer buffer) {
+    switch (type) {
+      case 129:
+        return BtStatus.decode(readValue(buffer)!);
+      case 130:
+        return BtDevice.decode(readValue(buffer)!);
+      case 131:
+        return BtManufacturerData.decode(readValue(buffer)!);
+      case 132:
+        return BtServiceData.decode(readValue(buffer)!);
+      case 133:
+        return BtService.decode(readValue(buffer)!);
+      case 134:
+        return BtCharacteristic.decode(readValue(buffer)!);
+      case 135:
+        return BtCharacteristicNotification.decode(readValue(buffer)!);
+      case 136:
+        return BtGattReadRequest.decode(readValue(buffer)!);
+      case 137:
+        return BtGattWriteRequest.decode(readValue(buffer)!);
+      case 138:
+        return BtDeviceDelta.decode(readValue(buffer)!);
+      case 139:
+        return BtScanCacheStats.decode(readValue(buffer)!);
+      case 140:
+        return BtManufacturerDataFilter.decode(readValue(buffer)!);
+      case 141:
+        return BtScanMetrics.decode(readValue(buffer)!);
+      case 142:
+        return BtScanQueueStats.decode(readValue(buffer)!);
+      case 143:
+        return BtAdvertisingInfo.decode(readValue(buffer)!);
+      case 144:
+        return BtConnectTimings.decode(readValue(buffer)!);
+      default:
+        return super.readValueOfType(type, buffer);
+    }
+  }
+}
+
+class LayrzBlePlatformChannel {
+  /// Constructor for [LayrzBlePlatformChannel].  The [binaryMessenger] named argument is
+  /// available for dependency injection.  If it is left null, the default
+  /// BinaryMessenger will be used which routes to the host platform.
+  LayrzBlePlatformChannel({BinaryMessenger? binaryMessenger, String messageChannelSuffix = ''})
+      : pigeonVar_binaryMessenger = binaryMessenger,
+        pigeonVar_messageChannelSuffix = messageChannelSuffix.isNotEmpty ? '.$messageChannelSuffix' : '';
+  final BinaryMessenger? pigeonVar_binaryMessenger;
+
+  static const MessageCodec<Object?> pigeonChannelCodec = _PigeonCodec();
+
+  final String pigeonVar_messageChannelSuffix;
+
+  Future<BtStatus> getStatuses() async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getStatuses$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as BtStatus;
+  }
+
+  Future<bool> checkCapabilities() async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.checkCapabilities$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as bool;
+  }
+
+  Future<bool> checkScanPermissions() async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.checkScanPermissions$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as bool;
+  }
+
+  Future<bool> checkAdvertisePermissions() async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.checkAdvertisePermissions$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as bool;
+  }
+
+  Future<bool> startScan({String? macAddress, List<String>? servicesUuids}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.startScan$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress, servicesUuids]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as bool;
+  }
+
+  Future<bool> stopScan({String? macAddress}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.stopScan$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as bool;
+  }
+
+  Future<bool> connect({required String macAddress}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.connect$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as bool;
+  }
+
+  Future<bool> disconnect({String? macAddress}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.disconnect$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as bool;
+  }
+
+  Future<int?> setMtu({required String macAddress, required int newMtu}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setMtu$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress, newMtu]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: true,
+    )
+    ;
+    return pigeonVar_replyValue as int?;
+  }
+
+  Future<List<BtService>> discoverServices({required String macAddress}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.discoverServices$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return (pigeonVar_replyValue! as List<Object?>).cast<BtService>();
+  }
+
+  Future<Uint8List> readCharacteristic({required String macAddress, required String serviceUuid, required String characteristicUuid, }) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.readCharacteristic$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress, serviceUuid, characteristicUuid]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as Uint8List;
+  }
+
+  Future<bool> writeCharacteristic({required String macAddress, required String serviceUuid, required String characteristicUuid, required Uint8List payload, required bool withResponse, }) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.writeCharacteristic$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress, serviceUuid, characteristicUuid, payload, withResponse]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as bool;
+  }
+
+  Future<bool> startNotify({required String macAddress, required String serviceUuid, required String characteristicUuid, }) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.startNotify$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress, serviceUuid, characteristicUuid]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as bool;
+  }
+
+  Future<bool> stopNotify({required String macAddress, required String serviceUuid, required String characteristicUuid, }) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.stopNotify$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress, serviceUuid, characteristicUuid]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as bool;
+  }
+
+  Future<bool> startAdvertise({List<BtManufacturerData> manufacturerData = const [], List<BtServiceData> serviceData = const [], bool canConnect = false, String? name, List<BtService> servicesSpecs = const [], bool allowBluetooth5 = true, }) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.startAdvertise$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[manufacturerData, serviceData, canConnect, name, servicesSpecs, allowBluetooth5]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as bool;
+  }
+
+  Future<bool> stopAdvertise() async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.stopAdvertise$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as bool;
+  }
+
+  Future<bool> respondReadRequest({required int requestId, required String macAddress, required int offset, Uint8List? data, }) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.respondReadRequest$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[requestId, macAddress, offset, data]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
-  final String pigeonVar_messageChannelSuffix;
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as bool;
+  }
 
-  Future<BtStatus> getStatuses() async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getStatuses$pigeonVar_messageChannelSuffix';
+  Future<bool> respondWriteRequest({required int requestId, required String macAddress, required int offset, required bool success, }) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.respondWriteRequest$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[requestId, macAddress, offset, success]);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
@@ -688,17 +1593,17 @@ class LayrzBlePlatformChannel {
         isNullValid: false,
     )
     ;
-    return pigeonVar_replyValue! as BtStatus;
+    return pigeonVar_replyValue! as bool;
   }
 
-  Future<bool> checkCapabilities() async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.checkCapabilities$pigeonVar_messageChannelSuffix';
+  Future<bool> sendNotification({required String serviceUuid, required String characteristicUuid, required Uint8List payload, bool requestConfirmation = false, }) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.sendNotification$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[serviceUuid, characteristicUuid, payload, requestConfirmation]);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
@@ -710,8 +1615,8 @@ class LayrzBlePlatformChannel {
     return pigeonVar_replyValue! as bool;
   }
 
-  Future<bool> checkScanPermissions() async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.checkScanPermissions$pigeonVar_messageChannelSuffix';
+  Future<bool> openBluetoothSettings() async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.openBluetoothSettings$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
@@ -729,8 +1634,8 @@ class LayrzBlePlatformChannel {
     return pigeonVar_replyValue! as bool;
   }
 
-  Future<bool> checkAdvertisePermissions() async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.checkAdvertisePermissions$pigeonVar_messageChannelSuffix';
+  Future<bool> requestScanResync() async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.requestScanResync$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
@@ -748,14 +1653,14 @@ class LayrzBlePlatformChannel {
     return pigeonVar_replyValue! as bool;
   }
 
-  Future<bool> startScan({String? macAddress, List<String>? servicesUuids}) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.startScan$pigeonVar_messageChannelSuffix';
+  Future<bool> setScanCacheLimits({int? maxDevices, int? deviceTtlMs}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanCacheLimits$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress, servicesUuids]);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[maxDevices, deviceTtlMs]);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
@@ -767,14 +1672,14 @@ class LayrzBlePlatformChannel {
     return pigeonVar_replyValue! as bool;
   }
 
-  Future<bool> stopScan({String? macAddress}) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.stopScan$pigeonVar_messageChannelSuffix';
+  Future<BtScanCacheStats> getScanCacheStats() async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getScanCacheStats$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress]);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
@@ -783,17 +1688,17 @@ class LayrzBlePlatformChannel {
         isNullValid: false,
     )
     ;
-    return pigeonVar_replyValue! as bool;
+    return pigeonVar_replyValue! as BtScanCacheStats;
   }
 
-  Future<bool> connect({required String macAddress}) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.connect$pigeonVar_messageChannelSuffix';
+  Future<bool> setScanAddressFilters({required List<String> allowlist, required List<String> denylist}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanAddressFilters$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress]);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[allowlist, denylist]);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
@@ -805,14 +1710,14 @@ class LayrzBlePlatformChannel {
     return pigeonVar_replyValue! as bool;
   }
 
-  Future<bool> disconnect({String? macAddress}) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.disconnect$pigeonVar_messageChannelSuffix';
+  Future<bool> setManufacturerDataFilters({required List<BtManufacturerDataFilter> filters}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setManufacturerDataFilters$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress]);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[filters]);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
@@ -824,33 +1729,33 @@ class LayrzBlePlatformChannel {
     return pigeonVar_replyValue! as bool;
   }
 
-  Future<int?> setMtu({required String macAddress, required int newMtu}) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setMtu$pigeonVar_messageChannelSuffix';
+  Future<List<int>> getManufacturerDataFilterHits() async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getManufacturerDataFilterHits$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress, newMtu]);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
         pigeonVar_replyList,
         pigeonVar_channelName,
-        isNullValid: true,
+        isNullValid: false,
     )
     ;
-    return pigeonVar_replyValue as int?;
+    return (pigeonVar_replyValue! as List<Object?>).cast<int>();
   }
 
-  Future<List<BtService>> discoverServices({required String macAddress}) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.discoverServices$pigeonVar_messageChannelSuffix';
+  Future<bool> setRssiSmoothing({required int mode, required double emaAlpha, required double kalmanProcessNoise, required double kalmanMeasurementNoise, required int medianWindow, required int minDeltaDbm, required int maxIntervalMs}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setRssiSmoothing$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress]);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[mode, emaAlpha, kalmanProcessNoise, kalmanMeasurementNoise, medianWindow, minDeltaDbm, maxIntervalMs]);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
@@ -859,17 +1764,17 @@ class LayrzBlePlatformChannel {
         isNullValid: false,
     )
     ;
-    return (pigeonVar_replyValue! as List<Object?>).cast<BtService>();
+    return pigeonVar_replyValue! as bool;
   }
 
-  Future<Uint8List> readCharacteristic({required String macAddress, required String serviceUuid, required String characteristicUuid, }) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.readCharacteristic$pigeonVar_messageChannelSuffix';
+  Future<bool> setScanCapture({String? path}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanCapture$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress, serviceUuid, characteristicUuid]);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[path]);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
@@ -878,17 +1783,17 @@ class LayrzBlePlatformChannel {
         isNullValid: false,
     )
     ;
-    return pigeonVar_replyValue! as Uint8List;
+    return pigeonVar_replyValue! as bool;
   }
 
-  Future<bool> writeCharacteristic({required String macAddress, required String serviceUuid, required String characteristicUuid, required Uint8List payload, required bool withResponse, }) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.writeCharacteristic$pigeonVar_messageChannelSuffix';
+  Future<BtScanMetrics> getScanMetrics({required bool reset}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getScanMetrics$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress, serviceUuid, characteristicUuid, payload, withResponse]);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[reset]);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
@@ -897,17 +1802,17 @@ class LayrzBlePlatformChannel {
         isNullValid: false,
     )
     ;
-    return pigeonVar_replyValue! as bool;
+    return pigeonVar_replyValue! as BtScanMetrics;
   }
 
-  Future<bool> startNotify({required String macAddress, required String serviceUuid, required String characteristicUuid, }) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.startNotify$pigeonVar_messageChannelSuffix';
+  Future<bool> dumpScanMetrics() async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.dumpScanMetrics$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress, serviceUuid, characteristicUuid]);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
@@ -919,14 +1824,14 @@ class LayrzBlePlatformChannel {
     return pigeonVar_replyValue! as bool;
   }
 
-  Future<bool> stopNotify({required String macAddress, required String serviceUuid, required String characteristicUuid, }) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.stopNotify$pigeonVar_messageChannelSuffix';
+  Future<bool> setScanBackpressure({required int policy, required int maxQueuedDevices}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanBackpressure$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress, serviceUuid, characteristicUuid]);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[policy, maxQueuedDevices]);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
@@ -938,14 +1843,71 @@ class LayrzBlePlatformChannel {
     return pigeonVar_replyValue! as bool;
   }
 
-  Future<bool> startAdvertise({List<BtManufacturerData> manufacturerData = const [], List<BtServiceData> serviceData = const [], bool canConnect = false, String? name, List<BtService> servicesSpecs = const [], bool allowBluetooth5 = true, }) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.startAdvertise$pigeonVar_messageChannelSuffix';
+  Future<BtScanQueueStats> getScanQueueStats() async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getScanQueueStats$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[manufacturerData, serviceData, canConnect, name, servicesSpecs, allowBluetooth5]);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as BtScanQueueStats;
+  }
+
+  Future<BtAdvertisingInfo?> getAdvertisingInfo({required String macAddress}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getAdvertisingInfo$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[macAddress]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: true,
+    )
+    ;
+    return pigeonVar_replyValue as BtAdvertisingInfo?;
+  }
+
+  Future<BtConnectTimings?> getConnectTimings() async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getConnectTimings$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: true,
+    )
+    ;
+    return pigeonVar_replyValue as BtConnectTimings?;
+  }
+
+  Future<bool> setGattCache({String? directory}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setGattCache$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[directory]);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
@@ -957,8 +1919,8 @@ class LayrzBlePlatformChannel {
     return pigeonVar_replyValue! as bool;
   }
 
-  Future<bool> stopAdvertise() async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.stopAdvertise$pigeonVar_messageChannelSuffix';
+  Future<int> clearGattCache() async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.clearGattCache$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
@@ -967,6 +1929,25 @@ class LayrzBlePlatformChannel {
     final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as int;
+  }
+
+  Future<bool> setLazyServiceDiscovery({required bool enabled}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setLazyServiceDiscovery$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[enabled]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
         pigeonVar_replyList,
         pigeonVar_channelName,
@@ -976,14 +1957,33 @@ class LayrzBlePlatformChannel {
     return pigeonVar_replyValue! as bool;
   }
 
-  Future<bool> respondReadRequest({required int requestId, required String macAddress, required int offset, Uint8List? data, }) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.respondReadRequest$pigeonVar_messageChannelSuffix';
+  Future<Uint8List> readCharacteristicByHandle({required int handle}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.readCharacteristicByHandle$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[requestId, macAddress, offset, data]);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[handle]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as Uint8List;
+  }
+
+  Future<bool> writeCharacteristicByHandle({required int handle, required Uint8List payload, required bool withResponse}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.writeCharacteristicByHandle$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[handle, payload, withResponse]);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
@@ -995,14 +1995,14 @@ class LayrzBlePlatformChannel {
     return pigeonVar_replyValue! as bool;
   }
 
-  Future<bool> respondWriteRequest({required int requestId, required String macAddress, required int offset, required bool success, }) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.respondWriteRequest$pigeonVar_messageChannelSuffix';
+  Future<bool> startNotifyByHandle({required int handle}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.startNotifyByHandle$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[requestId, macAddress, offset, success]);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[handle]);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
@@ -1014,14 +2014,14 @@ class LayrzBlePlatformChannel {
     return pigeonVar_replyValue! as bool;
   }
 
-  Future<bool> sendNotification({required String serviceUuid, required String characteristicUuid, required Uint8List payload, bool requestConfirmation = false, }) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.sendNotification$pigeonVar_messageChannelSuffix';
+  Future<bool> stopNotifyByHandle({required int handle}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.stopNotifyByHandle$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[serviceUuid, characteristicUuid, payload, requestConfirmation]);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[handle]);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
@@ -1033,14 +2033,14 @@ class LayrzBlePlatformChannel {
     return pigeonVar_replyValue! as bool;
   }
 
-  Future<bool> openBluetoothSettings() async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.openBluetoothSettings$pigeonVar_messageChannelSuffix';
+  Future<bool> setScanCoalescingWindow({required int windowMs}) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanCoalescingWindow$pigeonVar_messageChannelSuffix';
     final pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
       pigeonChannelCodec,
       binaryMessenger: pigeonVar_binaryMessenger,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[windowMs]);
     final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
 
     final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
@@ -1058,6 +2058,8 @@ abstract class LayrzBleCallbackChannel {
 
   void onScanResult(BtDevice device);
 
+  void onScanResults(List<BtDevice> devices);
+
   void onBluetoothOn();
 
   void onBluetoothOff();
@@ -1086,6 +2088,10 @@ abstract class LayrzBleCallbackChannel {
 
   void onGattMtuChanged(String macAddress, int newMtu);
 
+  void onScanDeltas(List<BtDeviceDelta> deltas);
+
+  void onDeviceLost(String macAddress, int? addressType);
+
   static void setUp(LayrzBleCallbackChannel? api, {BinaryMessenger? binaryMessenger, String messageChannelSuffix = '',}) {
     messageChannelSuffix = messageChannelSuffix.isNotEmpty ? '.$messageChannelSuffix' : '';
     {
@@ -1109,6 +2115,27 @@ abstract class LayrzBleCallbackChannel {
         });
       }
     }
+    {
+      final pigeonVar_channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.layrz_ble.LayrzBleCallbackChannel.onScanResults$messageChannelSuffix', pigeonChannelCodec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        pigeonVar_channel.setMessageHandler(null);
+      } else {
+        pigeonVar_channel.setMessageHandler((Object? message) async {
+          final List<Object?> args = message! as List<Object?>;
+          final List<BtDevice> arg_devices = (args[0]! as List<Object?>).cast<BtDevice>();
+          try {
+            api.onScanResults(arg_devices);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          }          catch (e) {
+            return wrapResponse(error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
     {
       final pigeonVar_channel = BasicMessageChannel<Object?>(
           'dev.flutter.pigeon.layrz_ble.LayrzBleCallbackChannel.onBluetoothOn$messageChannelSuffix', pigeonChannelCodec,
@@ -1392,5 +2419,48 @@ abstract class LayrzBleCallbackChannel {
         });
       }
     }
+    {
+      final pigeonVar_channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.layrz_ble.LayrzBleCallbackChannel.onScanDeltas$messageChannelSuffix', pigeonChannelCodec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        pigeonVar_channel.setMessageHandler(null);
+      } else {
+        pigeonVar_channel.setMessageHandler((Object? message) async {
+          final List<Object?> args = message! as List<Object?>;
+          final List<BtDeviceDelta> arg_deltas = (args[0]! as List<Object?>).cast<BtDeviceDelta>();
+          try {
+            api.onScanDeltas(arg_deltas);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          }          catch (e) {
+            return wrapResponse(error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final pigeonVar_channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.layrz_ble.LayrzBleCallbackChannel.onDeviceLost$messageChannelSuffix', pigeonChannelCodec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        pigeonVar_channel.setMessageHandler(null);
+      } else {
+        pigeonVar_channel.setMessageHandler((Object? message) async {
+          final List<Object?> args = message! as List<Object?>;
+          final String arg_macAddress = args[0]! as String;
+          final int? arg_addressType = args[1] as int?;
+          try {
+            api.onDeviceLost(arg_macAddress, arg_addressType);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          }          catch (e) {
+            return wrapResponse(error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
   }
 }
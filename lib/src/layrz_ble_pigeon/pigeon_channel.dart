@@ -3,6 +3,7 @@ import 'dart:async';
 import 'package:flutter/foundation.dart';
 import 'package:layrz_ble/src/layrz_ble_pigeon/layrz_ble.g.dart';
 import 'package:layrz_ble/src/platform_interface.dart';
+import 'package:layrz_ble/src/service_data_uuid.dart';
 import 'package:layrz_ble/src/types/types.dart';
 import 'package:layrz_models/layrz_models.dart';
 
@@ -44,6 +45,13 @@ class LayrzBlePigeonChannel extends LayrzBlePlatform {
   }
 
   final _channel = LayrzBlePlatformChannel();
+  late final _LayrzBleCallbackHandler _callbackHandler;
+
+  /// Handles returned by the last [discoverServices] of each device, see [characteristicHandle]
+  final Map<String, int> _characteristicHandles = {};
+
+  String _handleKey(String macAddress, String serviceUuid, String characteristicUuid) =>
+      '${macAddress.toUpperCase()}/${serviceUuid.toUpperCase()}/${characteristicUuid.toUpperCase()}';
 
   @override
   Future<BleStatus> getStatuses() async {
@@ -67,12 +75,165 @@ class LayrzBlePigeonChannel extends LayrzBlePlatform {
   Future<bool> checkAdvertisePermissions() => _channel.checkAdvertisePermissions();
 
   @override
-  Future<bool> startScan({String? macAddress, List<String>? servicesUuids}) =>
-      _channel.startScan(macAddress: macAddress, servicesUuids: servicesUuids);
+  Future<bool> startScan({String? macAddress, List<String>? servicesUuids}) {
+    // The native side starts over with full snapshots, the deltas of the previous scan are useless
+    _callbackHandler.resetScanCache();
+    return _channel.startScan(macAddress: macAddress, servicesUuids: servicesUuids);
+  }
 
   @override
   Future<bool> stopScan() => _channel.stopScan();
 
+  @override
+  Future<bool> setScanCacheLimits({int? maxDevices, Duration? deviceTtl}) => _channel.setScanCacheLimits(
+        maxDevices: maxDevices,
+        deviceTtlMs: deviceTtl?.inMilliseconds,
+      );
+
+  @override
+  Future<bool> setScanCoalescingWindow(Duration window) =>
+      _channel.setScanCoalescingWindow(windowMs: window.inMilliseconds);
+
+  @override
+  Future<BleScanCacheStats?> getScanCacheStats() async {
+    final stats = await _channel.getScanCacheStats();
+    return BleScanCacheStats(
+      devices: stats.devices,
+      maxDevices: stats.maxDevices,
+      deviceTtl: stats.deviceTtlMs > 0 ? Duration(milliseconds: stats.deviceTtlMs) : null,
+      evictedByTtl: stats.evictedByTtl,
+      evictedByCapacity: stats.evictedByCapacity,
+      approximateBytes: stats.approximateBytes,
+      watcherDevices: stats.watcherDevices,
+    );
+  }
+
+  @override
+  Future<bool> setScanAddressFilters({List<String> allowlist = const [], List<String> denylist = const []}) =>
+      _channel.setScanAddressFilters(allowlist: allowlist, denylist: denylist);
+
+  @override
+  Future<bool> setManufacturerDataFilters(List<BleManufacturerDataFilter> filters) =>
+      _channel.setManufacturerDataFilters(
+        filters: filters
+            .map((filter) => BtManufacturerDataFilter(
+                  companyId: filter.companyId,
+                  offset: filter.offset,
+                  value: filter.value,
+                  mask: filter.mask,
+                  group: filter.group,
+                ))
+            .toList(),
+      );
+
+  @override
+  Future<List<int>?> getManufacturerDataFilterHits() => _channel.getManufacturerDataFilterHits();
+
+  @override
+  Future<bool> setRssiSmoothing(BleRssiSmoothing smoothing) => _channel.setRssiSmoothing(
+        mode: smoothing.mode.index,
+        emaAlpha: smoothing.emaAlpha,
+        kalmanProcessNoise: smoothing.kalmanProcessNoise,
+        kalmanMeasurementNoise: smoothing.kalmanMeasurementNoise,
+        medianWindow: smoothing.medianWindow,
+        minDeltaDbm: smoothing.minDeltaDbm,
+        maxIntervalMs: smoothing.maxInterval?.inMilliseconds ?? 0,
+      );
+
+  @override
+  Future<bool> setScanCapture({String? path}) => _channel.setScanCapture(path: path);
+
+  @override
+  Future<BleScanMetrics?> getScanMetrics({bool reset = false}) async {
+    final metrics = await _channel.getScanMetrics(reset: reset);
+    return BleScanMetrics(
+      received: metrics.received,
+      dropped: metrics.dropped,
+      filtered: metrics.filtered,
+      duplicates: metrics.duplicates,
+      merged: metrics.merged,
+      coalesced: metrics.coalesced,
+      encoded: metrics.encoded,
+      posted: metrics.posted,
+      ingestLatency: BleLatencyHistogram(
+        buckets: metrics.ingestLatencyBuckets,
+        max: Duration(microseconds: metrics.ingestLatencyMaxUs),
+      ),
+      postLatency: BleLatencyHistogram(
+        buckets: metrics.postLatencyBuckets,
+        max: Duration(microseconds: metrics.postLatencyMaxUs),
+      ),
+    );
+  }
+
+  @override
+  Future<bool> dumpScanMetrics() => _channel.dumpScanMetrics();
+
+  @override
+  Future<bool> setScanBackpressure(BleScanBackpressurePolicy policy, {int maxQueuedDevices = 4096}) =>
+      _channel.setScanBackpressure(policy: policy.index, maxQueuedDevices: maxQueuedDevices);
+
+  @override
+  Future<BleScanQueueStats?> getScanQueueStats() async {
+    final stats = await _channel.getScanQueueStats();
+    return BleScanQueueStats(
+      policy: BleScanBackpressurePolicy.values[stats.policy.clamp(0, BleScanBackpressurePolicy.values.length - 1)],
+      capacity: stats.capacity,
+      depth: stats.depth,
+      highWatermark: stats.highWatermark,
+      queuedEvents: stats.queuedEvents,
+      deliveredEvents: stats.deliveredEvents,
+      droppedEvents: stats.droppedEvents,
+      droppedDevices: stats.droppedDevices,
+      deferredFlushes: stats.deferredFlushes,
+      pauses: stats.pauses,
+      pausedAdvertisements: stats.pausedAdvertisements,
+    );
+  }
+
+  @override
+  Future<BleAdvertisingInfo?> getAdvertisingInfo({required String macAddress}) async {
+    final info = await _channel.getAdvertisingInfo(macAddress: macAddress);
+    if (info == null) return null;
+
+    BleAdvertisingPhy phy(int value) => BleAdvertisingPhy.values[value.clamp(0, BleAdvertisingPhy.values.length - 1)];
+    return BleAdvertisingInfo(
+      extended: info.extended,
+      primaryPhy: phy(info.primaryPhy),
+      secondaryPhy: phy(info.secondaryPhy),
+      advertisingSid: info.advertisingSid == 0xFF ? null : info.advertisingSid,
+      maxPayloadLength: info.maxPayloadLength,
+    );
+  }
+
+  @override
+  Future<BleConnectTimings?> getConnectTimings() async {
+    final timings = await _channel.getConnectTimings();
+    if (timings == null) return null;
+
+    return BleConnectTimings(
+      resolve: Duration(microseconds: timings.resolveUs),
+      services: Duration(microseconds: timings.servicesUs),
+      characteristics: Duration(microseconds: timings.characteristicsUs),
+      slowestService: Duration(microseconds: timings.slowestServiceUs),
+      total: Duration(microseconds: timings.totalUs),
+      serviceCount: timings.services,
+      characteristicCount: timings.characteristics,
+      failedServices: timings.failedServices,
+      concurrency: timings.concurrency,
+    );
+  }
+
+  @override
+  Future<bool> setGattCache({String? directory}) => _channel.setGattCache(directory: directory);
+
+  @override
+  Future<int> clearGattCache() => _channel.clearGattCache();
+
+  @override
+  Future<bool> setLazyServiceDiscovery({required bool enabled}) =>
+      _channel.setLazyServiceDiscovery(enabled: enabled);
+
   @override
   Future<bool> connect({required String macAddress}) => _channel.connect(macAddress: macAddress);
 
@@ -87,6 +248,9 @@ class LayrzBlePigeonChannel extends LayrzBlePlatform {
   Future<List<BleService>> discoverServices({required String macAddress}) async {
     final services = await _channel.discoverServices(macAddress: macAddress);
 
+    final devicePrefix = '${macAddress.toUpperCase()}/';
+    _characteristicHandles.removeWhere((key, _) => key.startsWith(devicePrefix));
+
     return services
         .map((service) {
           try {
@@ -95,6 +259,10 @@ class LayrzBlePigeonChannel extends LayrzBlePlatform {
               characteristics: service.characteristics
                   .map((characteristic) {
                     try {
+                      final handle = characteristic.handle;
+                      if (handle != null) {
+                        _characteristicHandles[_handleKey(macAddress, service.uuid, characteristic.uuid)] = handle;
+                      }
                       return BleCharacteristic(
                         uuid: characteristic.uuid,
                         properties: characteristic.properties
@@ -171,6 +339,32 @@ class LayrzBlePigeonChannel extends LayrzBlePlatform {
         characteristicUuid: characteristicUuid,
       );
 
+  @override
+  int? characteristicHandle({
+    required String macAddress,
+    required String serviceUuid,
+    required String characteristicUuid,
+  }) =>
+      _characteristicHandles[_handleKey(macAddress, serviceUuid, characteristicUuid)];
+
+  @override
+  Future<bool> writeCharacteristicByHandle({
+    required int handle,
+    required Uint8List payload,
+    required bool withResponse,
+  }) =>
+      _channel.writeCharacteristicByHandle(handle: handle, payload: payload, withResponse: withResponse);
+
+  @override
+  Future<Uint8List> readCharacteristicByHandle({required int handle}) =>
+      _channel.readCharacteristicByHandle(handle: handle);
+
+  @override
+  Future<bool> startNotifyByHandle({required int handle}) => _channel.startNotifyByHandle(handle: handle);
+
+  @override
+  Future<bool> stopNotifyByHandle({required int handle}) => _channel.stopNotifyByHandle(handle: handle);
+
   @override
   Future<bool> startAdvertise({
     List<BleManufacturerData> manufacturerData = const [],
@@ -260,7 +454,7 @@ class LayrzBlePigeonChannel extends LayrzBlePlatform {
   Future<bool> openBluetoothSettings() => _channel.openBluetoothSettings();
 
   void _setupListeners() {
-    LayrzBleCallbackChannel.setUp(_LayrzBleCallbackHandler(
+    _callbackHandler = _LayrzBleCallbackHandler(
       eventController: _eventsController,
       scanController: _scanController,
       notifyController: _notifyController,
@@ -268,7 +462,9 @@ class LayrzBlePigeonChannel extends LayrzBlePlatform {
       bluetoothStateController: _bluetoothStateController,
       onScanChanged: (isScanning) => _scanning = isScanning,
       onAdvertiseChanged: (isAdvertising) => _advertising = isAdvertising,
-    ));
+      requestScanResync: _channel.requestScanResync,
+    );
+    LayrzBleCallbackChannel.setUp(_callbackHandler);
   }
 }
 
@@ -280,6 +476,20 @@ class _LayrzBleCallbackHandler extends LayrzBleCallbackChannel {
   final StreamController<bool> bluetoothStateController;
   final ValueChanged<bool> onScanChanged;
   final ValueChanged<bool> onAdvertiseChanged;
+  final Future<bool> Function() requestScanResync;
+
+  // Bits of BtDeviceDelta.changedFields, must match ScanDeltaField on the native side
+  static const int _deltaName = 1 << 0;
+  static const int _deltaRssi = 1 << 1;
+  static const int _deltaTxPower = 1 << 2;
+  static const int _deltaManufacturerData = 1 << 3;
+  static const int _deltaServiceData = 1 << 4;
+  static const int _deltaFullSnapshot = 1 << 5;
+
+  // Last known state of the scanned devices, the deltas are applied on top of it.
+  // Keyed like the native tracker, by address and address type (null when the platform does not report it)
+  final Map<(String, int?), BtDevice> _scanCache = {};
+  bool _resyncRequested = false;
 
   _LayrzBleCallbackHandler({
     required this.eventController,
@@ -289,8 +499,14 @@ class _LayrzBleCallbackHandler extends LayrzBleCallbackChannel {
     required this.bluetoothStateController,
     required this.onScanChanged,
     required this.onAdvertiseChanged,
+    required this.requestScanResync,
   });
 
+  void resetScanCache() {
+    _scanCache.clear();
+    _resyncRequested = false;
+  }
+
   @override
   void onBluetoothOff() {
     bluetoothStateController.add(false);
@@ -329,7 +545,62 @@ class _LayrzBleCallbackHandler extends LayrzBleCallbackChannel {
 
   @override
   void onScanResult(BtDevice device) {
-    scanController.add(BleDevice(
+    scanController.add(_parseDevice(device));
+  }
+
+  @override
+  void onScanResults(List<BtDevice> devices) {
+    for (final device in devices) {
+      scanController.add(_parseDevice(device));
+    }
+  }
+
+  @override
+  void onScanDeltas(List<BtDeviceDelta> deltas) {
+    for (final delta in deltas) {
+      final device = _applyDelta(delta);
+      if (device != null) {
+        scanController.add(_parseDevice(device));
+      }
+    }
+  }
+
+  // Applies a delta on the cached device, returns null when the device is unknown
+  BtDevice? _applyDelta(BtDeviceDelta delta) {
+    final fields = delta.changedFields;
+    if (fields & _deltaFullSnapshot != 0) {
+      final device = BtDevice(
+        macAddress: delta.macAddress,
+        name: delta.name,
+        rssi: delta.rssi,
+        txPower: delta.txPower,
+        manufacturerData: delta.manufacturerData ?? [],
+        serviceData: delta.serviceData ?? [],
+      );
+      _scanCache[(delta.macAddress, delta.addressType)] = device;
+      return device;
+    }
+
+    final device = _scanCache[(delta.macAddress, delta.addressType)];
+    if (device == null) {
+      // We lost track of the scan (hot restart or a missed message), ask once for full snapshots
+      if (!_resyncRequested) {
+        _resyncRequested = true;
+        requestScanResync().whenComplete(() => _resyncRequested = false);
+      }
+      return null;
+    }
+
+    if (fields & _deltaName != 0) device.name = delta.name;
+    if (fields & _deltaRssi != 0) device.rssi = delta.rssi;
+    if (fields & _deltaTxPower != 0) device.txPower = delta.txPower;
+    if (fields & _deltaManufacturerData != 0) device.manufacturerData = delta.manufacturerData ?? [];
+    if (fields & _deltaServiceData != 0) device.serviceData = delta.serviceData ?? [];
+    return device;
+  }
+
+  BleDevice _parseDevice(BtDevice device) {
+    return BleDevice(
       macAddress: device.macAddress.toUpperCase(),
       name: device.name,
       rssi: device.rssi,
@@ -341,12 +612,21 @@ class _LayrzBleCallbackHandler extends LayrzBleCallbackChannel {
         );
       }).toList(),
       serviceData: device.serviceData.map((serviceData) {
-        return BleServiceData(
-          uuid: serviceData.uuid,
-          data: serviceData.data,
+        return withFullUuid(
+          BleServiceData(
+            uuid: serviceData.uuid,
+            data: serviceData.data,
+          ),
+          serviceData.fullUuid,
         );
       }).toList(),
-    ));
+    );
+  }
+
+  @override
+  void onDeviceLost(String macAddress, int? addressType) {
+    _scanCache.remove((macAddress, addressType));
+    eventController.add(BleDeviceLost(macAddress: macAddress.toUpperCase()));
   }
 
   @override
@@ -332,4 +332,82 @@ class LayrzBlePluginWeb extends LayrzBlePlatform {
 
   @override
   Future<bool> openBluetoothSettings() => Future.value(false);
+
+  @override
+  Future<bool> setScanCacheLimits({int? maxDevices, Duration? deviceTtl}) => Future.value(false);
+
+  @override
+  Future<bool> setScanCoalescingWindow(Duration window) => Future.value(false);
+
+  @override
+  Future<BleScanCacheStats?> getScanCacheStats() => Future.value(null);
+
+  @override
+  Future<bool> setScanAddressFilters({List<String> allowlist = const [], List<String> denylist = const []}) =>
+      Future.value(false);
+
+  @override
+  Future<bool> setManufacturerDataFilters(List<BleManufacturerDataFilter> filters) => Future.value(false);
+
+  @override
+  Future<List<int>?> getManufacturerDataFilterHits() => Future.value(null);
+
+  @override
+  Future<bool> setRssiSmoothing(BleRssiSmoothing smoothing) => Future.value(false);
+
+  @override
+  Future<bool> setScanCapture({String? path}) => Future.value(false);
+
+  @override
+  Future<BleScanMetrics?> getScanMetrics({bool reset = false}) => Future.value(null);
+
+  @override
+  Future<bool> dumpScanMetrics() => Future.value(false);
+
+  @override
+  Future<bool> setScanBackpressure(BleScanBackpressurePolicy policy, {int maxQueuedDevices = 4096}) =>
+      Future.value(false);
+
+  @override
+  Future<BleScanQueueStats?> getScanQueueStats() => Future.value(null);
+
+  @override
+  Future<BleAdvertisingInfo?> getAdvertisingInfo({required String macAddress}) => Future.value(null);
+
+  @override
+  Future<BleConnectTimings?> getConnectTimings() => Future.value(null);
+
+  @override
+  Future<bool> setGattCache({String? directory}) => Future.value(false);
+
+  @override
+  Future<int> clearGattCache() => Future.value(0);
+
+  @override
+  Future<bool> setLazyServiceDiscovery({required bool enabled}) => Future.value(false);
+
+  @override
+  int? characteristicHandle({
+    required String macAddress,
+    required String serviceUuid,
+    required String characteristicUuid,
+  }) =>
+      null;
+
+  @override
+  Future<bool> writeCharacteristicByHandle({
+    required int handle,
+    required Uint8List payload,
+    required bool withResponse,
+  }) =>
+      Future.value(false);
+
+  @override
+  Future<Uint8List?> readCharacteristicByHandle({required int handle}) => Future.value(null);
+
+  @override
+  Future<bool> startNotifyByHandle({required int handle}) => Future.value(false);
+
+  @override
+  Future<bool> stopNotifyByHandle({required int handle}) => Future.value(false);
 }
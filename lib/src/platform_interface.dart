@@ -22,6 +22,37 @@ abstract class LayrzBlePlatform {
   Future<bool> startScan({String? macAddress, List<String>? servicesUuids}) =>
       throw UnimplementedError('startScan() has not been implemented.');
   Future<bool> stopScan() => throw UnimplementedError('stopScan() has not been implemented.');
+  Future<bool> setScanCacheLimits({int? maxDevices, Duration? deviceTtl}) =>
+      throw UnimplementedError('setScanCacheLimits() has not been implemented.');
+  Future<bool> setScanCoalescingWindow(Duration window) =>
+      throw UnimplementedError('setScanCoalescingWindow() has not been implemented.');
+  Future<BleScanCacheStats?> getScanCacheStats() =>
+      throw UnimplementedError('getScanCacheStats() has not been implemented.');
+  Future<bool> setScanAddressFilters({List<String> allowlist = const [], List<String> denylist = const []}) =>
+      throw UnimplementedError('setScanAddressFilters() has not been implemented.');
+  Future<bool> setManufacturerDataFilters(List<BleManufacturerDataFilter> filters) =>
+      throw UnimplementedError('setManufacturerDataFilters() has not been implemented.');
+  Future<List<int>?> getManufacturerDataFilterHits() =>
+      throw UnimplementedError('getManufacturerDataFilterHits() has not been implemented.');
+  Future<bool> setRssiSmoothing(BleRssiSmoothing smoothing) =>
+      throw UnimplementedError('setRssiSmoothing() has not been implemented.');
+  Future<bool> setScanCapture({String? path}) =>
+      throw UnimplementedError('setScanCapture() has not been implemented.');
+  Future<BleScanMetrics?> getScanMetrics({bool reset = false}) =>
+      throw UnimplementedError('getScanMetrics() has not been implemented.');
+  Future<bool> dumpScanMetrics() => throw UnimplementedError('dumpScanMetrics() has not been implemented.');
+  Future<bool> setScanBackpressure(BleScanBackpressurePolicy policy, {int maxQueuedDevices = 4096}) =>
+      throw UnimplementedError('setScanBackpressure() has not been implemented.');
+  Future<BleScanQueueStats?> getScanQueueStats() =>
+      throw UnimplementedError('getScanQueueStats() has not been implemented.');
+  Future<BleAdvertisingInfo?> getAdvertisingInfo({required String macAddress}) =>
+      throw UnimplementedError('getAdvertisingInfo() has not been implemented.');
+  Future<BleConnectTimings?> getConnectTimings() =>
+      throw UnimplementedError('getConnectTimings() has not been implemented.');
+  Future<bool> setGattCache({String? directory}) => throw UnimplementedError('setGattCache() has not been implemented.');
+  Future<int> clearGattCache() => throw UnimplementedError('clearGattCache() has not been implemented.');
+  Future<bool> setLazyServiceDiscovery({required bool enabled}) =>
+      throw UnimplementedError('setLazyServiceDiscovery() has not been implemented.');
 
   Future<bool> connect({required String macAddress}) => throw UnimplementedError('connect() has not been implemented.');
   Future<bool> disconnect({String? macAddress}) => throw UnimplementedError('disconnect() has not been implemented.');
@@ -61,6 +92,29 @@ abstract class LayrzBlePlatform {
   }) =>
       throw UnimplementedError('stopNotify() has not been implemented.');
 
+  int? characteristicHandle({
+    required String macAddress,
+    required String serviceUuid,
+    required String characteristicUuid,
+  }) =>
+      throw UnimplementedError('characteristicHandle() has not been implemented.');
+
+  Future<bool> writeCharacteristicByHandle({
+    required int handle,
+    required Uint8List payload,
+    required bool withResponse,
+  }) =>
+      throw UnimplementedError('writeCharacteristicByHandle() has not been implemented.');
+
+  Future<Uint8List?> readCharacteristicByHandle({required int handle}) =>
+      throw UnimplementedError('readCharacteristicByHandle() has not been implemented.');
+
+  Future<bool> startNotifyByHandle({required int handle}) =>
+      throw UnimplementedError('startNotifyByHandle() has not been implemented.');
+
+  Future<bool> stopNotifyByHandle({required int handle}) =>
+      throw UnimplementedError('stopNotifyByHandle() has not been implemented.');
+
   Future<bool> startAdvertise({
     List<BleManufacturerData> manufacturerData = const [],
     List<BleServiceData> serviceData = const [],
@@ -0,0 +1,19 @@
+import 'package:layrz_models/layrz_models.dart';
+
+/// Whole UUIDs of the service data entries, [BleServiceData] only has room for an integer
+final Expando<String> _fullUuids = Expando<String>('BleServiceData.fullUuid');
+
+/// [BleServiceDataFullUuid] exposes the whole UUID of a service data entry.
+extension BleServiceDataFullUuid on BleServiceData {
+  /// [fullUuid] is the whole 128 bits UUID, uppercase with dashes, when it is not built on the Bluetooth
+  /// base UUID. [uuid] then only holds its first 32 bits, and can be equal to the one of another entry.
+  ///
+  /// `null` for the UUIDs built on the base UUID, and on Linux and Web.
+  String? get fullUuid => _fullUuids[this];
+}
+
+/// Attach the whole UUID sent by the native side to a service data entry
+BleServiceData withFullUuid(BleServiceData serviceData, String? fullUuid) {
+  if (fullUuid != null) _fullUuids[serviceData] = fullUuid;
+  return serviceData;
+}
@@ -0,0 +1,49 @@
+part of '../types.dart';
+
+/// [BleAdvertisingPhy] is the radio PHY an advertisement was received on.
+enum BleAdvertisingPhy {
+  /// [unknown] means the platform does not report the PHY.
+  unknown,
+
+  /// [le1M] is the LE 1M PHY, the only one of the legacy advertisements.
+  le1M,
+
+  /// [le2M] is the LE 2M PHY, only used by the secondary advertising channels.
+  le2M,
+
+  /// [leCoded] is the LE Coded PHY (long range).
+  leCoded,
+}
+
+/// [BleAdvertisingInfo] are the Bluetooth 5 advertising details of a device seen by the scan.
+class BleAdvertisingInfo {
+  /// [extended] is true once the device sent a payload longer than the legacy 31 bytes.
+  final bool extended;
+
+  /// [primaryPhy] is the PHY of the primary advertising channel.
+  final BleAdvertisingPhy primaryPhy;
+
+  /// [secondaryPhy] is the PHY the extended payload was received on, [BleAdvertisingPhy.unknown] for a
+  /// legacy advertisement.
+  final BleAdvertisingPhy secondaryPhy;
+
+  /// [advertisingSid] is the advertising set identifier, `null` when the platform does not report it.
+  final int? advertisingSid;
+
+  /// [maxPayloadLength] is the longest advertising payload received from the device, in bytes.
+  final int maxPayloadLength;
+
+  const BleAdvertisingInfo({
+    this.extended = false,
+    this.primaryPhy = BleAdvertisingPhy.unknown,
+    this.secondaryPhy = BleAdvertisingPhy.unknown,
+    this.advertisingSid,
+    this.maxPayloadLength = 0,
+  });
+
+  @override
+  String toString() {
+    return 'BleAdvertisingInfo(extended: $extended, primaryPhy: $primaryPhy, secondaryPhy: $secondaryPhy, '
+        'advertisingSid: $advertisingSid, maxPayloadLength: $maxPayloadLength)';
+  }
+}
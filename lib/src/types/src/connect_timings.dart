@@ -0,0 +1,51 @@
+part of '../types.dart';
+
+/// [BleConnectTimings] is the time spent by each phase of a connection.
+class BleConnectTimings {
+  /// [resolve] is the time taken to get the device from its address.
+  final Duration resolve;
+
+  /// [services] is the time taken to discover the GATT services.
+  final Duration services;
+
+  /// [characteristics] is the time taken to discover the characteristics of every service. The services
+  /// are queried concurrently, so this is less than the sum of the queries.
+  final Duration characteristics;
+
+  /// [slowestService] is the longest characteristic discovery of a single service.
+  final Duration slowestService;
+
+  /// [total] is the time of the whole connection.
+  final Duration total;
+
+  /// [serviceCount] is the number of services discovered.
+  final int serviceCount;
+
+  /// [characteristicCount] is the number of characteristics discovered.
+  final int characteristicCount;
+
+  /// [failedServices] is the number of services whose characteristics could not be read.
+  final int failedServices;
+
+  /// [concurrency] is the max number of services queried at once.
+  final int concurrency;
+
+  const BleConnectTimings({
+    this.resolve = Duration.zero,
+    this.services = Duration.zero,
+    this.characteristics = Duration.zero,
+    this.slowestService = Duration.zero,
+    this.total = Duration.zero,
+    this.serviceCount = 0,
+    this.characteristicCount = 0,
+    this.failedServices = 0,
+    this.concurrency = 0,
+  });
+
+  @override
+  String toString() {
+    return 'BleConnectTimings(total: $total, resolve: $resolve, services: $services, '
+        'characteristics: $characteristics, slowestService: $slowestService, serviceCount: $serviceCount, '
+        'characteristicCount: $characteristicCount, failedServices: $failedServices, concurrency: $concurrency)';
+  }
+}
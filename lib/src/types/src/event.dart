@@ -42,6 +42,15 @@ class BleScanStopped extends BleEvent {
   const BleScanStopped() : super.event();
 }
 
+/// [BleDeviceLost] is the event received when a scanned device is dropped from the table of visible devices,
+/// because it was not seen for longer than the TTL or the table was full. See [LayrzBle.setScanCacheLimits].
+class BleDeviceLost extends BleEvent {
+  /// [macAddress] is the MAC address of the device.
+  final String macAddress;
+
+  const BleDeviceLost({required this.macAddress}) : super.event();
+}
+
 class BleAdapterOff extends BleEvent {
   const BleAdapterOff() : super.event();
 }
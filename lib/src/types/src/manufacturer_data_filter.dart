@@ -0,0 +1,37 @@
+part of '../types.dart';
+
+/// [BleManufacturerDataFilter] matches the manufacturer data of the scanned devices on the native side.
+///
+/// The bytes at [offset] of the manufacturer data (right after the company ID), masked by [mask], must equal
+/// [value] masked the same way. The filters of the same [group] must all match, any matching group is enough.
+class BleManufacturerDataFilter {
+  /// [companyId] is the Bluetooth SIG company identifier of the manufacturer data.
+  final int companyId;
+
+  /// [offset] is the position of [value] in the manufacturer data, the company ID is not counted.
+  final int offset;
+
+  /// [value] is the expected bytes.
+  final Uint8List value;
+
+  /// [mask] selects the compared bits of [value], every bit is compared when `null`.
+  /// Must have the same length as [value].
+  final Uint8List? mask;
+
+  /// [group] combines the filters: the filters of the same group are AND-ed, the groups are OR-ed.
+  final int group;
+
+  const BleManufacturerDataFilter({
+    required this.companyId,
+    required this.value,
+    this.offset = 0,
+    this.mask,
+    this.group = 0,
+  });
+
+  @override
+  String toString() {
+    return 'BleManufacturerDataFilter(companyId: $companyId, offset: $offset, value: $value, mask: $mask, '
+        'group: $group)';
+  }
+}
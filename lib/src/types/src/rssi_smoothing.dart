@@ -0,0 +1,57 @@
+part of '../types.dart';
+
+/// [BleRssiSmoothingMode] is how the native side smooths the RSSI samples of a device.
+enum BleRssiSmoothingMode {
+  /// [none] reports the raw samples.
+  none,
+
+  /// [ema] is an exponential moving average, see [BleRssiSmoothing.emaAlpha].
+  ema,
+
+  /// [kalman] is a one dimensional Kalman filter, see [BleRssiSmoothing.kalmanProcessNoise].
+  kalman,
+
+  /// [median] is the median of the last [BleRssiSmoothing.medianWindow] samples, robust to outliers.
+  median,
+}
+
+/// [BleRssiSmoothing] configures the RSSI smoothing and the reporting rate of the scanned devices.
+class BleRssiSmoothing {
+  /// [mode] is the smoothing algorithm.
+  final BleRssiSmoothingMode mode;
+
+  /// [emaAlpha] is the weight of a new sample in [BleRssiSmoothingMode.ema], between `0` (excluded) and `1`.
+  final double emaAlpha;
+
+  /// [kalmanProcessNoise] is the expected variance of the real signal between two samples, in dBm².
+  final double kalmanProcessNoise;
+
+  /// [kalmanMeasurementNoise] is the variance of the measurement noise, in dBm².
+  final double kalmanMeasurementNoise;
+
+  /// [medianWindow] is the number of samples of [BleRssiSmoothingMode.median], odd and up to 15.
+  final int medianWindow;
+
+  /// [minDeltaDbm] is how much the smoothed RSSI must move before it is reported again.
+  final int minDeltaDbm;
+
+  /// [maxInterval] reports a smaller move anyway once that long elapsed since the last report.
+  final Duration? maxInterval;
+
+  const BleRssiSmoothing({
+    this.mode = BleRssiSmoothingMode.none,
+    this.emaAlpha = 0.25,
+    this.kalmanProcessNoise = 0.5,
+    this.kalmanMeasurementNoise = 16,
+    this.medianWindow = 5,
+    this.minDeltaDbm = 0,
+    this.maxInterval,
+  });
+
+  @override
+  String toString() {
+    return 'BleRssiSmoothing(mode: $mode, emaAlpha: $emaAlpha, kalmanProcessNoise: $kalmanProcessNoise, '
+        'kalmanMeasurementNoise: $kalmanMeasurementNoise, medianWindow: $medianWindow, '
+        'minDeltaDbm: $minDeltaDbm, maxInterval: $maxInterval)';
+  }
+}
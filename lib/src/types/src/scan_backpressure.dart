@@ -0,0 +1,72 @@
+part of '../types.dart';
+
+/// [BleScanBackpressurePolicy] is what the native side does when the Dart side does not keep up with the
+/// scan messages.
+enum BleScanBackpressurePolicy {
+  /// [dropOldest] keeps sending, the oldest waiting messages are dropped to make room.
+  dropOldest,
+
+  /// [latestPerDevice] holds the devices back natively, the latest state of each is sent once there is room.
+  latestPerDevice,
+
+  /// [pauseWatcher] holds the devices back and ignores the advertisements until the Dart side caught up.
+  pauseWatcher,
+}
+
+/// [BleScanQueueStats] are the scan messages waiting for the Dart side, counted in devices.
+class BleScanQueueStats {
+  /// [policy] is the backpressure policy in use.
+  final BleScanBackpressurePolicy policy;
+
+  /// [capacity] is the max number of waiting devices.
+  final int capacity;
+
+  /// [depth] is the number of waiting devices.
+  final int depth;
+
+  /// [highWatermark] is the highest [depth] seen.
+  final int highWatermark;
+
+  /// [queuedEvents] is the number of messages queued for the Dart side.
+  final int queuedEvents;
+
+  /// [deliveredEvents] is the number of messages delivered to the Dart side.
+  final int deliveredEvents;
+
+  /// [droppedEvents] is the number of messages dropped because the queue was full.
+  final int droppedEvents;
+
+  /// [droppedDevices] is the number of devices carried by the dropped messages.
+  final int droppedDevices;
+
+  /// [deferredFlushes] is the number of batches held back because the queue was full.
+  final int deferredFlushes;
+
+  /// [pauses] is the number of times the scan was paused by [BleScanBackpressurePolicy.pauseWatcher].
+  final int pauses;
+
+  /// [pausedAdvertisements] is the number of advertisements ignored while the scan was paused.
+  final int pausedAdvertisements;
+
+  const BleScanQueueStats({
+    this.policy = BleScanBackpressurePolicy.latestPerDevice,
+    this.capacity = 0,
+    this.depth = 0,
+    this.highWatermark = 0,
+    this.queuedEvents = 0,
+    this.deliveredEvents = 0,
+    this.droppedEvents = 0,
+    this.droppedDevices = 0,
+    this.deferredFlushes = 0,
+    this.pauses = 0,
+    this.pausedAdvertisements = 0,
+  });
+
+  @override
+  String toString() {
+    return 'BleScanQueueStats(policy: $policy, capacity: $capacity, depth: $depth, '
+        'highWatermark: $highWatermark, queuedEvents: $queuedEvents, deliveredEvents: $deliveredEvents, '
+        'droppedEvents: $droppedEvents, droppedDevices: $droppedDevices, deferredFlushes: $deferredFlushes, '
+        'pauses: $pauses, pausedAdvertisements: $pausedAdvertisements)';
+  }
+}
@@ -0,0 +1,42 @@
+part of '../types.dart';
+
+/// [BleScanCacheStats] is the size of the table of visible devices kept by the native side during a scan.
+class BleScanCacheStats {
+  /// [devices] is the number of visible devices.
+  final int devices;
+
+  /// [maxDevices] is the max number of visible devices, `0` means unbounded.
+  final int maxDevices;
+
+  /// [deviceTtl] is the time after which an unseen device is evicted, `null` if the devices never age.
+  final Duration? deviceTtl;
+
+  /// [evictedByTtl] is the number of devices evicted because they were not seen for longer than [deviceTtl].
+  final int evictedByTtl;
+
+  /// [evictedByCapacity] is the number of devices evicted to stay within [maxDevices].
+  final int evictedByCapacity;
+
+  /// [approximateBytes] is an estimation of the memory held by the visible devices.
+  final int approximateBytes;
+
+  /// [watcherDevices] is the number of devices reported by the Bluetooth Classic watcher (Windows only).
+  final int watcherDevices;
+
+  const BleScanCacheStats({
+    required this.devices,
+    required this.maxDevices,
+    this.deviceTtl,
+    this.evictedByTtl = 0,
+    this.evictedByCapacity = 0,
+    this.approximateBytes = 0,
+    this.watcherDevices = 0,
+  });
+
+  @override
+  String toString() {
+    return 'BleScanCacheStats(devices: $devices, maxDevices: $maxDevices, deviceTtl: $deviceTtl, '
+        'evictedByTtl: $evictedByTtl, evictedByCapacity: $evictedByCapacity, '
+        'approximateBytes: $approximateBytes, watcherDevices: $watcherDevices)';
+  }
+}
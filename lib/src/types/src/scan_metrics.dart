@@ -0,0 +1,99 @@
+part of '../types.dart';
+
+/// [BleLatencyHistogram] is a latency distribution in power of two buckets of microseconds.
+class BleLatencyHistogram {
+  /// [buckets] are the counts per bucket: bucket `0` counts the latencies under 1 µs, bucket `i` those
+  /// between `2^(i-1)` and `2^i` µs, the last bucket has no upper bound.
+  final List<int> buckets;
+
+  /// [max] is the highest recorded latency.
+  final Duration max;
+
+  const BleLatencyHistogram({
+    this.buckets = const [],
+    this.max = Duration.zero,
+  });
+
+  /// [count] is the number of recorded latencies.
+  int get count => buckets.fold(0, (sum, bucket) => sum + bucket);
+
+  /// [percentile] estimates a percentile ([rank] between `0` and `1`) as the upper bound of its bucket,
+  /// capped by [max]. The estimation is within a factor of two, `Duration.zero` when nothing was recorded.
+  Duration percentile(double rank) {
+    final total = count;
+    if (total == 0) return Duration.zero;
+
+    var target = (rank.clamp(0, 1) * total).floor();
+    if (target == 0) target = 1;
+
+    var seen = 0;
+    for (var i = 0; i < buckets.length; i++) {
+      seen += buckets[i];
+      if (seen >= target) {
+        if (i == buckets.length - 1) return max;
+        final upper = Duration(microseconds: 1 << i);
+        return upper < max ? upper : max;
+      }
+    }
+    return max;
+  }
+
+  @override
+  String toString() {
+    return 'BleLatencyHistogram(count: $count, p50: ${percentile(0.5)}, p99: ${percentile(0.99)}, max: $max)';
+  }
+}
+
+/// [BleScanMetrics] are the counters of the native scan path, per stage, since the plugin started or since
+/// the last reset.
+class BleScanMetrics {
+  /// [received] is the number of advertisements raised by the watcher.
+  final int received;
+
+  /// [dropped] is the number of advertisements lost because the native side could not keep up.
+  final int dropped;
+
+  /// [filtered] is the number of advertisements discarded by the address, service or manufacturer filters.
+  final int filtered;
+
+  /// [duplicates] is the number of advertisements with the same payload as the last one of their device.
+  final int duplicates;
+
+  /// [merged] is the number of advertisements merged into the visible devices.
+  final int merged;
+
+  /// [coalesced] is the number of updates absorbed by a pending update of the same device.
+  final int coalesced;
+
+  /// [encoded] is the number of devices (full or delta) encoded for the Dart side.
+  final int encoded;
+
+  /// [posted] is the number of messages posted to the Dart side.
+  final int posted;
+
+  /// [ingestLatency] goes from the advertisement event to its merge.
+  final BleLatencyHistogram ingestLatency;
+
+  /// [postLatency] goes from the latest advertisement of a device to the post of the message carrying it.
+  final BleLatencyHistogram postLatency;
+
+  const BleScanMetrics({
+    this.received = 0,
+    this.dropped = 0,
+    this.filtered = 0,
+    this.duplicates = 0,
+    this.merged = 0,
+    this.coalesced = 0,
+    this.encoded = 0,
+    this.posted = 0,
+    this.ingestLatency = const BleLatencyHistogram(),
+    this.postLatency = const BleLatencyHistogram(),
+  });
+
+  @override
+  String toString() {
+    return 'BleScanMetrics(received: $received, dropped: $dropped, filtered: $filtered, '
+        'duplicates: $duplicates, merged: $merged, coalesced: $coalesced, encoded: $encoded, '
+        'posted: $posted, ingestLatency: $ingestLatency, postLatency: $postLatency)';
+  }
+}
@@ -10,6 +10,13 @@ part 'src/event.dart';
 part 'src/characteristic_notification.dart';
 part 'src/gatt_server.dart';
 part 'src/ble_status.dart';
+part 'src/scan_cache_stats.dart';
+part 'src/manufacturer_data_filter.dart';
+part 'src/rssi_smoothing.dart';
+part 'src/scan_metrics.dart';
+part 'src/scan_backpressure.dart';
+part 'src/advertising_info.dart';
+part 'src/connect_timings.dart';
 
 class UintListConverter implements JsonConverter<Uint8List, List<dynamic>> {
   const UintListConverter();
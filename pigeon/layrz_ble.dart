@@ -118,12 +118,123 @@ abstract class LayrzBlePlatformChannel {
 
   @async
   bool openBluetoothSettings();
+
+  // Asks the native side to send the full state of every visible device in the next
+  // onScanDeltas batch.
+  @async
+  bool requestScanResync();
+
+  // Bounds the table of visible devices of a scan. maxDevices 0 means unbounded, the least
+  // recently seen devices are evicted beyond it. deviceTtlMs 0 disables the aging, otherwise
+  // a device not seen for that long is evicted. Evicted devices are reported by onDeviceLost.
+  // A null limit keeps its current value.
+  @async
+  bool setScanCacheLimits({int? maxDevices, int? deviceTtlMs});
+
+  @async
+  BtScanCacheStats getScanCacheStats();
+
+  // Replaces the addresses reported by the scan while it runs. An empty allowlist allows every
+  // address, the denylist wins over the allowlist.
+  @async
+  bool setScanAddressFilters({required List<String> allowlist, required List<String> denylist});
+
+  // Replaces the manufacturer data filters of the scan, an empty list disables them. A device is
+  // only reported once one of its advertisements matches.
+  @async
+  bool setManufacturerDataFilters({required List<BtManufacturerDataFilter> filters});
+
+  // Number of advertisements matched by each filter, in the order they were set.
+  @async
+  List<int> getManufacturerDataFilterHits();
+
+  // Smooths the RSSI of every scanned device natively. mode: 0 none, 1 EMA, 2 Kalman, 3 median of
+  // medianWindow samples. The reported RSSI only changes once the smoothed one moved by minDeltaDbm,
+  // or moved at all and maxIntervalMs elapsed (0 disables the interval).
+  @async
+  bool setRssiSmoothing({
+    required int mode,
+    required double emaAlpha,
+    required double kalmanProcessNoise,
+    required double kalmanMeasurementNoise,
+    required int medianWindow,
+    required int minDeltaDbm,
+    required int maxIntervalMs,
+  });
+
+  // Records every raw advertisement of the scan to a binary capture file at path (appended if it exists),
+  // to replay it offline. A null path stops the capture.
+  @async
+  bool setScanCapture({String? path});
+
+  // Counters and latency histograms of the scan path since the plugin started (or the last reset).
+  @async
+  BtScanMetrics getScanMetrics({required bool reset});
+
+  // Writes the scan metrics to the native log.
+  @async
+  bool dumpScanMetrics();
+
+  // Bounds the scan messages waiting for the Flutter side to maxQueuedDevices devices. policy: 0 drops
+  // the oldest messages, 1 keeps the latest state of every device until there is room, 2 also pauses
+  // the scan until the Flutter side caught up.
+  @async
+  bool setScanBackpressure({required int policy, required int maxQueuedDevices});
+
+  @async
+  BtScanQueueStats getScanQueueStats();
+
+  // Bluetooth 5 advertising details of a device seen by the scan, null if it is not visible.
+  @async
+  BtAdvertisingInfo? getAdvertisingInfo({required String macAddress});
+
+  // Time spent by each phase of the last successful connection, null before the first one.
+  @async
+  BtConnectTimings? getConnectTimings();
+
+  // Caches the GATT layout of every connected device in a compact file per device under directory, so a
+  // reconnection skips the discovery. A null directory disables the cache, the files are kept.
+  @async
+  bool setGattCache({String? directory});
+
+  // Deletes every cached GATT layout, returns the number of layouts deleted.
+  @async
+  int clearGattCache();
+
+  // Connects without discovering the services, each one is discovered the first time discoverServices,
+  // a read, a write or startNotify references it. Applies to the next connection.
+  @async
+  bool setLazyServiceDiscovery({required bool enabled});
+
+  // Variants of readCharacteristic, writeCharacteristic, startNotify and stopNotify by the handle that
+  // discoverServices returns with each characteristic, no UUID is sent nor resolved.
+  @async
+  Uint8List readCharacteristicByHandle({required int handle});
+
+  @async
+  bool writeCharacteristicByHandle({
+    required int handle,
+    required Uint8List payload,
+    required bool withResponse,
+  });
+
+  @async
+  bool startNotifyByHandle({required int handle});
+
+  @async
+  bool stopNotifyByHandle({required int handle});
+
+  // Window over which the scan results of a device are merged into one message, 0 sends every result
+  // right away. Negative windows are rejected.
+  @async
+  bool setScanCoalescingWindow({required int windowMs});
 }
 
 // Flutter API from Native to Flutter
 @FlutterApi()
 abstract class LayrzBleCallbackChannel {
   void onScanResult(BtDevice device);
+  void onScanResults(List<BtDevice> devices);
 
   void onBluetoothOn();
   void onBluetoothOff();
@@ -143,6 +254,9 @@ abstract class LayrzBleCallbackChannel {
   void onGattReadRequest(BtGattReadRequest request);
   void onGattWriteRequest(BtGattWriteRequest request);
   void onGattMtuChanged(String macAddress, int newMtu);
+
+  void onScanDeltas(List<BtDeviceDelta> deltas);
+  void onDeviceLost(String macAddress, int? addressType);
 }
 
 class BtStatus {
@@ -188,10 +302,14 @@ class BtManufacturerData {
 class BtServiceData {
   final int uuid;
   final Uint8List? data;
+  // Whole 128 bits UUID, uppercase with dashes, when it is not built on the Bluetooth base UUID. uuid then
+  // only holds its first 32 bits.
+  final String? fullUuid;
 
   const BtServiceData({
     this.uuid = 0x0000,
     this.data,
+    this.fullUuid,
   });
 }
 
@@ -208,10 +326,14 @@ class BtService {
 class BtCharacteristic {
   final String uuid;
   final List<String> properties;
+  // Handle for the *ByHandle methods, valid until the services are discovered again or the device
+  // disconnects. Null on the platforms without them.
+  final int? handle;
 
   const BtCharacteristic({
     required this.uuid,
     this.properties = const [],
+    this.handle,
   });
 }
 
@@ -266,3 +388,179 @@ class BtGattWriteRequest {
     this.responseNeeded = false,
   });
 }
+
+// Changes of a device since the last time it was sent.
+// changedFields is a bitmask of the fields carried by the delta: name (1), rssi (2), txPower (4),
+// manufacturerData (8) and serviceData (16). A field flagged as changed but left null was cleared.
+// Full snapshot (32) means the delta carries the whole device and replaces whatever was known of it.
+// addressType tells apart devices sharing an address (public 0, random 1, unspecified 2), null when the
+// platform does not report it.
+class BtDeviceDelta {
+  final String macAddress;
+  final int changedFields;
+  final String? name;
+  final int? rssi;
+  final int? txPower;
+  final List<BtManufacturerData>? manufacturerData;
+  final List<BtServiceData>? serviceData;
+  final int? addressType;
+
+  const BtDeviceDelta({
+    required this.macAddress,
+    this.changedFields = 0,
+    this.name,
+    this.rssi,
+    this.txPower,
+    this.manufacturerData,
+    this.serviceData,
+    this.addressType,
+  });
+}
+
+// Size of the table of visible devices of a scan, approximateBytes is an estimation of
+// the memory held by the devices (identifiers, names and payloads).
+class BtScanCacheStats {
+  final int devices;
+  final int maxDevices;
+  final int deviceTtlMs;
+  final int evictedByTtl;
+  final int evictedByCapacity;
+  final int approximateBytes;
+  final int watcherDevices;
+
+  const BtScanCacheStats({
+    required this.devices,
+    required this.maxDevices,
+    required this.deviceTtlMs,
+    required this.evictedByTtl,
+    required this.evictedByCapacity,
+    required this.approximateBytes,
+    required this.watcherDevices,
+  });
+}
+
+// Matches the manufacturer data of an advertisement: the bytes at offset (after the company ID),
+// masked by mask (all ones when null), must equal value masked the same way. The filters of the same
+// group must all match (AND), any group matching is enough (OR).
+class BtManufacturerDataFilter {
+  final int companyId;
+  final int offset;
+  final Uint8List value;
+  final Uint8List? mask;
+  final int group;
+
+  const BtManufacturerDataFilter({
+    required this.companyId,
+    required this.offset,
+    required this.value,
+    this.mask,
+    required this.group,
+  });
+}
+
+// Counters of the scan path, per stage, and latency histograms in power of two buckets of microseconds:
+// bucket 0 counts the latencies under 1 us, bucket i those in [2^(i-1), 2^i) us, the last one is open.
+// The ingest latency goes from the advertisement event to its merge, the post latency from the latest
+// advertisement of a device to the post of the message carrying it to the UI thread.
+class BtScanMetrics {
+  final int received;
+  final int dropped;
+  final int filtered;
+  final int duplicates;
+  final int merged;
+  final int coalesced;
+  final int encoded;
+  final int posted;
+  final List<int> ingestLatencyBuckets;
+  final int ingestLatencyMaxUs;
+  final List<int> postLatencyBuckets;
+  final int postLatencyMaxUs;
+
+  const BtScanMetrics({
+    required this.received,
+    required this.dropped,
+    required this.filtered,
+    required this.duplicates,
+    required this.merged,
+    required this.coalesced,
+    required this.encoded,
+    required this.posted,
+    required this.ingestLatencyBuckets,
+    required this.ingestLatencyMaxUs,
+    required this.postLatencyBuckets,
+    required this.postLatencyMaxUs,
+  });
+}
+
+// Scan messages waiting for the Flutter side, depth and capacity counted in devices.
+class BtScanQueueStats {
+  final int policy;
+  final int capacity;
+  final int depth;
+  final int highWatermark;
+  final int queuedEvents;
+  final int deliveredEvents;
+  final int droppedEvents;
+  final int droppedDevices;
+  final int deferredFlushes;
+  final int pauses;
+  final int pausedAdvertisements;
+
+  const BtScanQueueStats({
+    required this.policy,
+    required this.capacity,
+    required this.depth,
+    required this.highWatermark,
+    required this.queuedEvents,
+    required this.deliveredEvents,
+    required this.droppedEvents,
+    required this.droppedDevices,
+    required this.deferredFlushes,
+    required this.pauses,
+    required this.pausedAdvertisements,
+  });
+}
+
+// Advertising details of a device. PHY: 0 unknown, 1 LE 1M, 2 LE 2M, 3 LE Coded. advertisingSid is 255
+// when unknown. extended is true once a payload over the legacy 31 bytes was received.
+class BtAdvertisingInfo {
+  final bool extended;
+  final int primaryPhy;
+  final int secondaryPhy;
+  final int advertisingSid;
+  final int maxPayloadLength;
+
+  const BtAdvertisingInfo({
+    required this.extended,
+    required this.primaryPhy,
+    required this.secondaryPhy,
+    required this.advertisingSid,
+    required this.maxPayloadLength,
+  });
+}
+
+// Phases of a connection in microseconds. The characteristics are discovered concurrently (concurrency
+// requests in flight), characteristicsUs is the wall time of the whole discovery.
+class BtConnectTimings {
+  final int resolveUs;
+  final int servicesUs;
+  final int characteristicsUs;
+  final int slowestServiceUs;
+  final int totalUs;
+  final int services;
+  final int characteristics;
+  final int failedServices;
+  final int concurrency;
+
+  const BtConnectTimings({
+    required this.resolveUs,
+    required this.servicesUs,
+    required this.characteristicsUs,
+    required this.slowestServiceUs,
+    required this.totalUs,
+    required this.services,
+    required this.characteristics,
+    required this.failedServices,
+    required this.concurrency,
+  });
+}
@@ -0,0 +1,166 @@
+// Compares the storage of the manufacturer/service data of a device, the previous
+// std::map<uint16_t, std::vector<uint8_t>> against AdvPacketMap, on the two merge paths of the plugin:
+//   - rebuild: a fresh result is built per advertisement and merged into the device (handleBleScanResult)
+//   - update: the raw sections are compared and updated in place (handleBleAdvertisement)
+//
+// Usage: adv_packet_benchmark [stream file] [iterations]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ad_parser.h"
+#include "adv_packet.h"
+#include "alloc_counter.h"
+#include "replay_stream.h"
+
+#ifndef LAYRZ_BLE_BENCHMARK_DATA_DIR
+#define LAYRZ_BLE_BENCHMARK_DATA_DIR "."
+#endif
+
+using namespace layrz_ble;
+using namespace layrz_ble::benchmarks;
+
+namespace {
+  template <typename Key>
+  using LegacyAdvPacketType = std::map<Key, std::vector<uint8_t>>;
+
+  /// @brief Manufacturer and service data of a device, parametrized by the container
+  template <template <typename> class Map>
+  struct DevicePackets {
+    Map<uint16_t> manufacturerData;
+    Map<Uuid128> serviceData;
+  };
+
+  template <typename Key>
+  void assignEntry(LegacyAdvPacketType<Key>& map, const Key& key, ByteView data) {
+    map.insert_or_assign(key, data.toVector());
+  }
+
+  template <typename Key>
+  void assignEntry(AdvSectionMap<Key>& map, const Key& key, ByteView data) {
+    map.insert_or_assign(key, data);
+  }
+
+  template <typename Key>
+  bool updateEntry(LegacyAdvPacketType<Key>& map, const Key& key, ByteView data) {
+    auto it = map.find(key);
+    if (it == map.end()) {
+      map.emplace(key, data.toVector());
+      return true;
+    }
+    if (ByteView(it->second) == data) return false;
+    it->second.assign(data.begin(), data.end());
+    return true;
+  }
+
+  template <typename Key>
+  bool updateEntry(AdvSectionMap<Key>& map, const Key& key, ByteView data) {
+    return map.update(key, data);
+  }
+
+  ByteView entryView(const std::vector<uint8_t>& value) { return ByteView(value); }
+  ByteView entryView(const AdvPayload& value) { return value.view(); }
+
+  template <template <typename> class Map>
+  void parse(const RecordedAdvertisement& record, DevicePackets<Map>& packets) {
+    for (const auto& structure : AdStructures(ByteView(record.payload))) {
+      uint16_t companyId = 0;
+      Uuid128 serviceUuid;
+      ByteView data;
+      if (parseManufacturerData(structure, companyId, data)) {
+        assignEntry(packets.manufacturerData, companyId, data);
+      } else if (parseServiceData(structure, serviceUuid, data)) {
+        assignEntry(packets.serviceData, serviceUuid, data);
+      }
+    }
+  }
+
+  template <typename Map>
+  void mergeInto(Map& target, const Map& source) {
+    for (const auto& entry : source) {
+      assignEntry(target, entry.first, entryView(entry.second));
+    }
+  }
+
+  template <template <typename> class Map>
+  void rebuildPass(const std::vector<RecordedAdvertisement>& records, const std::vector<size_t>& deviceIndexes, std::vector<DevicePackets<Map>>& devices) {
+    for (size_t i = 0; i < records.size(); i++) {
+      DevicePackets<Map> fresh;
+      parse(records[i], fresh);
+
+      auto& device = devices[deviceIndexes[i]];
+      mergeInto(device.manufacturerData, fresh.manufacturerData);
+      mergeInto(device.serviceData, fresh.serviceData);
+    }
+  }
+
+  template <template <typename> class Map>
+  void updatePass(const std::vector<RecordedAdvertisement>& records, const std::vector<size_t>& deviceIndexes, std::vector<DevicePackets<Map>>& devices) {
+    for (size_t i = 0; i < records.size(); i++) {
+      auto& device = devices[deviceIndexes[i]];
+      for (const auto& structure : AdStructures(ByteView(records[i].payload))) {
+        uint16_t companyId = 0;
+        Uuid128 serviceUuid;
+        ByteView data;
+        if (parseManufacturerData(structure, companyId, data)) {
+          updateEntry(device.manufacturerData, companyId, data);
+        } else if (parseServiceData(structure, serviceUuid, data)) {
+          updateEntry(device.serviceData, serviceUuid, data);
+        }
+      }
+    }
+  }
+
+  template <template <typename> class Map, typename Pass>
+  void run(const char* name, const std::vector<RecordedAdvertisement>& records, const std::vector<size_t>& deviceIndexes, size_t deviceCount, int iterations, Pass pass) {
+    std::vector<DevicePackets<Map>> devices(deviceCount);
+    pass(records, deviceIndexes, devices);
+
+    auto allocationsBefore = currentAllocations();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+      pass(records, deviceIndexes, devices);
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    auto allocationsAfter = currentAllocations();
+
+    double adverts = static_cast<double>(records.size()) * iterations;
+    std::printf("%-24s %10.1f ns/advert %8.2f allocations/advert %8.1f bytes/advert\n",
+      name,
+      elapsed * 1e9 / adverts,
+      (allocationsAfter.allocations - allocationsBefore.allocations) / adverts,
+      (allocationsAfter.bytes - allocationsBefore.bytes) / adverts);
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  std::string path = argc > 1 ? argv[1] : std::string(LAYRZ_BLE_BENCHMARK_DATA_DIR) + "/sample.stream";
+  int iterations = argc > 2 ? std::atoi(argv[2]) : 500;
+  if (iterations <= 0) iterations = 1;
+
+  std::vector<RecordedAdvertisement> records;
+  std::string error;
+  if (!loadAdvertisementStream(path, records, error)) {
+    std::fprintf(stderr, "Failed to load the stream: %s\n", error.c_str());
+    return 1;
+  }
+
+  std::unordered_map<uint64_t, size_t> indexes;
+  std::vector<size_t> deviceIndexes;
+  deviceIndexes.reserve(records.size());
+  for (const auto& record : records) {
+    deviceIndexes.push_back(indexes.emplace(record.address, indexes.size()).first->second);
+  }
+
+  std::printf("stream: %s (%zu adverts, %zu devices, %d passes)\n", path.c_str(), records.size(), indexes.size(), iterations);
+  run<LegacyAdvPacketType>("rebuild std::map", records, deviceIndexes, indexes.size(), iterations, rebuildPass<LegacyAdvPacketType>);
+  run<AdvSectionMap>("rebuild AdvPacketMap", records, deviceIndexes, indexes.size(), iterations, rebuildPass<AdvSectionMap>);
+  run<LegacyAdvPacketType>("update std::map", records, deviceIndexes, indexes.size(), iterations, updatePass<LegacyAdvPacketType>);
+  run<AdvSectionMap>("update AdvPacketMap", records, deviceIndexes, indexes.size(), iterations, updatePass<AdvSectionMap>);
+  return 0;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_BENCHMARKS_ALLOC_COUNTER_H__
+#define __LAYRZ_BLE_BENCHMARKS_ALLOC_COUNTER_H__
+
+#include <cstddef>
+#include <cstdint>
+
+namespace layrz_ble::benchmarks {
+  /// @brief Snapshot of the global allocation counters
+  struct AllocationStats {
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+  };
+
+  /// @brief Get the allocations performed through the global operator new since the process started
+  /// @return AllocationStats
+  AllocationStats currentAllocations();
+} // namespace layrz_ble::benchmarks
+
+#endif // __LAYRZ_BLE_BENCHMARKS_ALLOC_COUNTER_H__
@@ -0,0 +1,183 @@
+// Compares the characteristic lookup of the GATT operations (read, write, start/stop notify):
+//   - copy: the previous path, uppercase both UUIDs, find the service, copy it, copy its map of
+//     characteristics (Characteristics() returned it by value) and find the characteristic
+//   - reference: the same maps, without the copies (Characteristics() returning a reference)
+//   - table: CharacteristicTable, the UUIDs parsed in place from the text sent by Flutter
+//   - table (parsed): CharacteristicTable with the UUIDs already parsed
+//   - handle: CharacteristicTable by the integer handle returned by discoverServices
+// The characteristic stands in for a GattCharacteristic, a reference counted handle cheap to copy.
+//
+// Usage: gatt_lookup_benchmark [services] [characteristics per service] [lookups]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "alloc_counter.h"
+#include "characteristic_table.h"
+#include "string_utils.h"
+#include "uuid.h"
+
+using namespace layrz_ble;
+using namespace layrz_ble::benchmarks;
+
+namespace {
+  struct FakeCharacteristic {
+    std::shared_ptr<uint32_t> handle;
+  };
+
+  /// @brief BleService as it was, the map of characteristics keyed by uppercase UUID
+  class LegacyService {
+    public:
+      void addCharacteristic(const std::string& uuid, FakeCharacteristic characteristic) {
+        characteristics_[uuid] = std::move(characteristic);
+      }
+      const std::unordered_map<std::string, FakeCharacteristic> Characteristics() const { return characteristics_; }
+      const std::unordered_map<std::string, FakeCharacteristic>& CharacteristicsRef() const { return characteristics_; }
+
+    private:
+      std::unordered_map<std::string, FakeCharacteristic> characteristics_;
+  };
+
+  struct Lookup {
+    std::string service;
+    std::string characteristic;
+    Uuid128 serviceUuid;
+    Uuid128 characteristicUuid;
+    int64_t handle = kInvalidCharacteristicHandle;
+  };
+
+  /// @brief A vendor UUID, as most custom GATT services use
+  Uuid128 vendorUuid(uint32_t index) {
+    return Uuid128{0x6E400000ULL << 32 | (static_cast<uint64_t>(index) << 16) | 0xB5A3ULL, 0xF393E0A9E50E24DCULL};
+  }
+
+  template <typename Pass>
+  void run(const char* name, const std::vector<Lookup>& lookups, int iterations, Pass pass) {
+    uint64_t found = pass(lookups);
+
+    auto allocationsBefore = currentAllocations();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+      found += pass(lookups);
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    auto allocationsAfter = currentAllocations();
+
+    double operations = static_cast<double>(lookups.size()) * iterations;
+    std::printf("%-18s %10.1f ns/op %8.2f allocations/op %10.1f bytes/op (found %llu)\n",
+      name,
+      elapsed * 1e9 / operations,
+      (allocationsAfter.allocations - allocationsBefore.allocations) / operations,
+      (allocationsAfter.bytes - allocationsBefore.bytes) / operations,
+      static_cast<unsigned long long>(found));
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  int serviceCount = argc > 1 ? std::atoi(argv[1]) : 12;
+  int characteristicCount = argc > 2 ? std::atoi(argv[2]) : 8;
+  int lookupCount = argc > 3 ? std::atoi(argv[3]) : 100000;
+  serviceCount = std::max(serviceCount, 1);
+  characteristicCount = std::max(characteristicCount, 1);
+  lookupCount = std::max(lookupCount, 1);
+
+  std::unordered_map<std::string, LegacyService> legacy;
+  CharacteristicTable<FakeCharacteristic> table;
+  std::vector<std::pair<Uuid128, Uuid128>> keys;
+  for (int s = 0; s < serviceCount; s++) {
+    auto serviceUuid = vendorUuid(static_cast<uint32_t>(s * 256));
+    auto &service = legacy[serviceUuid.toString()];
+    for (int c = 0; c < characteristicCount; c++) {
+      auto characteristicUuid = vendorUuid(static_cast<uint32_t>(s * 256 + c + 1));
+      FakeCharacteristic characteristic{std::make_shared<uint32_t>(static_cast<uint32_t>(keys.size()))};
+      service.addCharacteristic(characteristicUuid.toString(), characteristic);
+      table.insert(serviceUuid, characteristicUuid, characteristic);
+      keys.emplace_back(serviceUuid, characteristicUuid);
+    }
+  }
+
+  // Flutter sends the UUIDs in lowercase, a few lookups miss
+  std::mt19937 random(42);
+  std::vector<Lookup> lookups(1024);
+  for (auto &lookup : lookups) {
+    auto key = keys[random() % keys.size()];
+    if (random() % 16 == 0) {
+      key.second = vendorUuid(0xFFFF);
+    }
+    lookup.serviceUuid = key.first;
+    lookup.characteristicUuid = key.second;
+    lookup.service = toLowercase(key.first.toString());
+    lookup.characteristic = toLowercase(key.second.toString());
+    lookup.handle = table.handleOf(key.first, key.second);
+  }
+  int iterations = std::max(1, lookupCount / static_cast<int>(lookups.size()));
+
+  std::printf("%d services x %d characteristics, %d lookups\n", serviceCount, characteristicCount,
+    iterations * static_cast<int>(lookups.size()));
+
+  run("copy", lookups, iterations, [&](const std::vector<Lookup>& batch) {
+    uint64_t found = 0;
+    for (const auto &lookup : batch) {
+      auto serviceSearch = legacy.find(toUppercase(lookup.service));
+      if (serviceSearch == legacy.end()) continue;
+      auto service = serviceSearch->second;
+      auto characteristics = service.Characteristics();
+      auto characteristicsSearch = characteristics.find(toUppercase(lookup.characteristic));
+      if (characteristicsSearch == characteristics.end()) continue;
+      auto characteristic = characteristicsSearch->second;
+      found += *characteristic.handle != UINT32_MAX;
+    }
+    return found;
+  });
+
+  run("reference", lookups, iterations, [&](const std::vector<Lookup>& batch) {
+    uint64_t found = 0;
+    for (const auto &lookup : batch) {
+      auto serviceSearch = legacy.find(toUppercase(lookup.service));
+      if (serviceSearch == legacy.end()) continue;
+      const auto &characteristics = serviceSearch->second.CharacteristicsRef();
+      auto characteristicsSearch = characteristics.find(toUppercase(lookup.characteristic));
+      if (characteristicsSearch == characteristics.end()) continue;
+      found += *characteristicsSearch->second.handle != UINT32_MAX;
+    }
+    return found;
+  });
+
+  run("table", lookups, iterations, [&](const std::vector<Lookup>& batch) {
+    uint64_t found = 0;
+    for (const auto &lookup : batch) {
+      auto characteristic = table.find(lookup.service, lookup.characteristic);
+      if (characteristic == nullptr) continue;
+      found += *characteristic->handle != UINT32_MAX;
+    }
+    return found;
+  });
+
+  run("table (parsed)", lookups, iterations, [&](const std::vector<Lookup>& batch) {
+    uint64_t found = 0;
+    for (const auto &lookup : batch) {
+      auto characteristic = table.find(lookup.serviceUuid, lookup.characteristicUuid);
+      if (characteristic == nullptr) continue;
+      found += *characteristic->handle != UINT32_MAX;
+    }
+    return found;
+  });
+
+  run("handle", lookups, iterations, [&](const std::vector<Lookup>& batch) {
+    uint64_t found = 0;
+    for (const auto &lookup : batch) {
+      auto characteristic = table.at(lookup.handle);
+      if (characteristic == nullptr) continue;
+      found += *characteristic->handle != UINT32_MAX;
+    }
+    return found;
+  });
+  return 0;
+}
@@ -0,0 +1,111 @@
+#include "replay_stream.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "adv_capture.h"
+
+namespace layrz_ble::benchmarks {
+  namespace {
+    int hexValue(char c) {
+      if (c >= '0' && c <= '9') return c - '0';
+      if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+      if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+      return -1;
+    }
+
+    bool parseHex(const std::string& text, std::vector<uint8_t>& out) {
+      if (text.size() % 2 != 0) return false;
+      out.clear();
+      out.reserve(text.size() / 2);
+      for (size_t i = 0; i < text.size(); i += 2) {
+        int high = hexValue(text[i]);
+        int low = hexValue(text[i + 1]);
+        if (high < 0 || low < 0) return false;
+        out.push_back(static_cast<uint8_t>((high << 4) | low));
+      }
+      return true;
+    }
+
+    bool parseAddress(const std::string& text, uint64_t& address) {
+      if (text.size() != 17) return false;
+      address = 0;
+      for (size_t i = 0; i < text.size(); i += 3) {
+        int high = hexValue(text[i]);
+        int low = hexValue(text[i + 1]);
+        if (high < 0 || low < 0) return false;
+        if (i + 2 < text.size() && text[i + 2] != ':') return false;
+        address = (address << 8) | static_cast<uint64_t>((high << 4) | low);
+      }
+      return true;
+    }
+  } // namespace
+
+  bool loadAdvertisementStream(const std::string& path, std::vector<RecordedAdvertisement>& records, std::string& error) {
+    // A binary capture of the plugin, read in place
+    MappedFile mapped;
+    std::string mapError;
+    if (mapped.open(path, mapError) && CaptureReader::isCapture(mapped.view())) {
+      CaptureReader reader;
+      if (!reader.open(mapped.view(), error)) {
+        return false;
+      }
+
+      AdvertisementView advertisement;
+      while (reader.next(advertisement)) {
+        RecordedAdvertisement record;
+        record.timestampUs = static_cast<uint64_t>(advertisement.timestampUs);
+        record.address = advertisement.address;
+        record.addressType = advertisement.addressType;
+        record.rssi = static_cast<int16_t>(advertisement.rssi);
+        if (advertisement.txPower) {
+          record.txPower = static_cast<int16_t>(*advertisement.txPower);
+        }
+        record.payload = advertisement.payload.toVector();
+        records.push_back(std::move(record));
+      }
+      // A torn last record is expected from a crashed capture, the complete ones are kept
+      return true;
+    }
+
+    std::ifstream file(path);
+    if (!file.is_open()) {
+      error = "Cannot open " + path;
+      return false;
+    }
+
+    std::string line;
+    size_t lineNumber = 0;
+    while (std::getline(file, line)) {
+      lineNumber++;
+      if (line.empty() || line[0] == '#') continue;
+
+      std::istringstream iss(line);
+      std::string address, addressType, txPower, payload;
+      RecordedAdvertisement record;
+      if (!(iss >> record.timestampUs >> address >> addressType >> record.rssi >> txPower >> payload)) {
+        error = "Malformed line " + std::to_string(lineNumber);
+        return false;
+      }
+
+      if (!parseAddress(address, record.address)) {
+        error = "Invalid address on line " + std::to_string(lineNumber);
+        return false;
+      }
+
+      record.addressType = addressType == "random" ? 1 : 0;
+      if (txPower != "-") {
+        record.txPower = static_cast<int16_t>(std::stoi(txPower));
+      }
+
+      if (!parseHex(payload, record.payload)) {
+        error = "Invalid payload on line " + std::to_string(lineNumber);
+        return false;
+      }
+
+      records.push_back(std::move(record));
+    }
+
+    return true;
+  } // loadAdvertisementStream
+} // namespace layrz_ble::benchmarks
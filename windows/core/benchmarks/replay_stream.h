@@ -0,0 +1,33 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_BENCHMARKS_REPLAY_STREAM_H__
+#define __LAYRZ_BLE_BENCHMARKS_REPLAY_STREAM_H__
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace layrz_ble::benchmarks {
+  /// @brief One advertisement as it was received by the radio
+  struct RecordedAdvertisement {
+    uint64_t timestampUs = 0;
+    uint64_t address = 0;
+    uint8_t addressType = 0;
+    int16_t rssi = 0;
+    std::optional<int16_t> txPower;
+    std::vector<uint8_t> payload;
+  };
+
+  /// @brief Load a text advertisement stream
+  /// @param path the file to read
+  /// @param records where to append the parsed advertisements
+  /// @param error the reason of the failure, if any
+  /// @return bool true if the whole file was parsed
+  /// @note Either a binary capture of the plugin (see CaptureWriter) or a text stream, with one advertisement
+  /// per line: `<timestamp_us> <address> <public|random> <rssi> <tx_power|-> <payload hex>`, blank lines and
+  /// lines starting with `#` are ignored.
+  bool loadAdvertisementStream(const std::string& path, std::vector<RecordedAdvertisement>& records, std::string& error);
+} // namespace layrz_ble::benchmarks
+
+#endif // __LAYRZ_BLE_BENCHMARKS_REPLAY_STREAM_H__
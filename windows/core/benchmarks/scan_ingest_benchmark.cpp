@@ -0,0 +1,176 @@
+// Stress test of the ingest path: a producer thread pushes the recorded advertisements into the
+// ScanIngestWorker ring as fast as it can, like a burst of `Received` events, while the worker merges
+// them into the scan engine in batches. Reports the cost paid by the producer per advertisement next to
+// the previous inline merge (one lock and one merge per callback), the ring depth and the overruns.
+// Fails if an advertisement is lost or reordered, or if the counters do not add up.
+//
+// The stream is pushed twice: once as a burst, and once paced at a fixed rate with the producer yielding
+// between advertisements, closer to the radio and meaningful on a single core.
+//
+// Usage: scan_ingest_benchmark [stream file] [iterations] [ring capacity] [paced adverts/s]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ad_parser.h"
+#include "replay_stream.h"
+#include "scan_engine.h"
+#include "scan_ingest.h"
+
+#ifndef LAYRZ_BLE_BENCHMARK_DATA_DIR
+#define LAYRZ_BLE_BENCHMARK_DATA_DIR "."
+#endif
+
+using namespace layrz_ble;
+using namespace layrz_ble::benchmarks;
+
+namespace {
+  /// @brief Same steps as the `Received` handler: flatten the sections into the record
+  void fill(RawAdvertisement& slot, const RecordedAdvertisement& record, int64_t sequence) {
+    slot.address = record.address;
+    slot.addressType = record.addressType;
+    slot.rssi = record.rssi;
+    if (record.txPower) {
+      slot.hasTxPower = true;
+      slot.txPower = static_cast<uint16_t>(*record.txPower);
+    }
+    // The sequence number stands for the timestamp, so the consumer can check the order
+    slot.timestampUs = sequence;
+    for (const auto& structure : AdStructures(ByteView(record.payload))) {
+      slot.appendSection(structure.type, structure.data.data(), structure.data.size());
+    }
+  }
+
+  /// @brief Previous path, every callback locks the engine and merges inline
+  double inlineNsPerAdvert(const std::vector<RecordedAdvertisement>& records, int iterations) {
+    ScanEngine engine;
+    std::mutex mutex;
+    RawAdvertisement scratch;
+    int64_t sequence = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+      for (const auto& record : records) {
+        scratch.reset();
+        fill(scratch, record, ++sequence);
+        std::lock_guard<std::mutex> lock(mutex);
+        engine.mergeAdvertisement(scratch.view());
+      }
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return elapsed * 1e9 / (static_cast<double>(records.size()) * iterations);
+  }
+
+  /// @brief Outcome of one run of the worker
+  struct IngestRun {
+    double producerSeconds = 0;
+    double totalSeconds = 0;
+    uint64_t produced = 0;
+    uint64_t dropped = 0;
+    uint64_t reordered = 0;
+    ScanIngestStats stats;
+  };
+
+  /// @brief Push the stream through a worker
+  /// @param rate advertisements per second, 0 pushes as fast as possible (a burst)
+  IngestRun runWorker(const std::vector<RecordedAdvertisement>& records, int iterations, size_t capacity, double rate) {
+    IngestRun run;
+    ScanEngine engine;
+    std::mutex scanMutex;
+    int64_t lastSequence = 0;
+
+    ScanIngestWorker worker(capacity);
+    worker.start([&](const std::vector<AdvertisementView>& batch) {
+      std::lock_guard<std::mutex> lock(scanMutex);
+      for (const auto& advertisement : batch) {
+        if (advertisement.timestampUs <= lastSequence) {
+          run.reordered++;
+        }
+        lastSequence = advertisement.timestampUs;
+        engine.mergeAdvertisement(advertisement);
+      }
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    std::thread producer([&]() {
+      int64_t sequence = 0;
+      for (int i = 0; i < iterations; i++) {
+        for (const auto& record : records) {
+          if (rate > 0) {
+            auto due = start + std::chrono::duration<double>(run.produced / rate);
+            while (std::chrono::steady_clock::now() < due) {
+              std::this_thread::yield();
+            }
+          }
+
+          run.produced++;
+          RawAdvertisement* slot = worker.beginPush();
+          if (slot == nullptr) {
+            run.dropped++;
+            continue;
+          }
+          fill(*slot, record, ++sequence);
+          worker.commitPush();
+        }
+      }
+    });
+    producer.join();
+    run.producerSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    worker.stop();
+    run.totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    run.stats = worker.Stats();
+    return run;
+  }
+
+  /// @brief Print a run and check that every advertisement is accounted for
+  bool report(const char* name, const IngestRun& run, bool paced) {
+    const ScanIngestStats& stats = run.stats;
+    double adverts = static_cast<double>(run.produced);
+    // A paced producer mostly waits, its time per push is the pace
+    std::printf("%-6s %8.1f ns/push %10.0f drained/s %8.2f%% overruns %6zu max depth %6.1f per batch\n",
+      name,
+      paced ? 0.0 : run.producerSeconds * 1e9 / adverts,
+      stats.processed / run.totalSeconds,
+      stats.overruns * 100.0 / adverts,
+      stats.highWatermark,
+      stats.batches > 0 ? static_cast<double>(stats.processed) / stats.batches : 0.0);
+
+    bool ok = run.reordered == 0
+      && stats.overruns == run.dropped
+      && stats.processed + stats.overruns == run.produced
+      && stats.truncated == 0
+      && stats.depth == 0;
+    if (!ok) {
+      std::fprintf(stderr, "ingest mismatch: %llu produced, %llu processed, %llu overruns, %llu reordered\n",
+        static_cast<unsigned long long>(run.produced), static_cast<unsigned long long>(stats.processed),
+        static_cast<unsigned long long>(stats.overruns), static_cast<unsigned long long>(run.reordered));
+    }
+    return ok;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  std::string path = argc > 1 ? argv[1] : std::string(LAYRZ_BLE_BENCHMARK_DATA_DIR) + "/sample.stream";
+  int iterations = argc > 2 ? std::atoi(argv[2]) : 50;
+  if (iterations <= 0) iterations = 1;
+  size_t capacity = argc > 3 ? static_cast<size_t>(std::atoll(argv[3])) : AdvertisementRing::kDefaultCapacity;
+  double rate = argc > 4 ? std::atof(argv[4]) : 50000;
+
+  std::vector<RecordedAdvertisement> records;
+  std::string error;
+  if (!loadAdvertisementStream(path, records, error)) {
+    std::fprintf(stderr, "Failed to load the stream: %s\n", error.c_str());
+    return 1;
+  }
+
+  std::printf("stream: %s (%zu adverts, %d passes, ring of %zu)\n", path.c_str(), records.size(), iterations, capacity);
+  std::printf("inline %8.1f ns/merge under the lock, in the callback\n", inlineNsPerAdvert(records, iterations));
+  bool ok = report("burst", runWorker(records, iterations, capacity, 0), false);
+  ok = report("paced", runWorker(records, iterations, capacity, rate), true) && ok;
+  return ok ? 0 : 1;
+}
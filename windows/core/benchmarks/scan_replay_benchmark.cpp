@@ -0,0 +1,214 @@
+// Replays a recorded advertisement stream through the scan merge engine and reports the throughput
+// and the allocations per advertisement of the path that the WinRT `Received` handler runs.
+// A last pass follows the timestamps of the stream to count the platform channel messages that the
+// coalescing window saves, and how many of the sent devices only carry a delta. The same pass runs again
+// with the RSSI smoothing, to count the deltas it holds back.
+//
+// With a service UUID, the timed passes run with the startScan service filter and report its drops.
+//
+// Usage: scan_replay_benchmark [stream file] [iterations] [coalescing window ms] [service UUID]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "alloc_counter.h"
+#include "replay_stream.h"
+#include "scan_coalescer.h"
+#include "scan_delta.h"
+#include "scan_engine.h"
+
+#ifndef LAYRZ_BLE_BENCHMARK_DATA_DIR
+#define LAYRZ_BLE_BENCHMARK_DATA_DIR "."
+#endif
+
+using namespace layrz_ble;
+using namespace layrz_ble::benchmarks;
+
+namespace {
+  /// @brief Same steps as the `Received` handler of the plugin, without the WinRT types
+  const BleScanResult* ingest(ScanEngine& engine, const RecordedAdvertisement& record) {
+    AdvertisementView advertisement;
+    advertisement.address = record.address;
+    advertisement.addressType = record.addressType;
+    advertisement.rssi = record.rssi;
+    if (record.txPower)
+      advertisement.txPower = static_cast<uint16_t>(*record.txPower);
+    advertisement.payload = ByteView(record.payload);
+    advertisement.timestampUs = static_cast<int64_t>(record.timestampUs);
+
+    return engine.mergeAdvertisement(advertisement);
+  }
+
+  /// @brief Messages sent to the Flutter side while replaying the stream at its recorded pace
+  struct ChannelTraffic {
+    size_t messages = 0;
+    size_t devices = 0;
+    double seconds = 0;
+    uint64_t fullSnapshots = 0;
+    uint64_t rssiOnlyDeltas = 0;
+    uint64_t partialDeltas = 0;
+    uint64_t unchangedSkips = 0;
+    // Batches with at least one changed device, the plugin does not send the others
+    size_t changedMessages = 0;
+  };
+
+  /// @brief Replay the stream once, flushing the coalescer like the plugin flush timer does
+  ChannelTraffic replayCoalesced(
+    const std::vector<RecordedAdvertisement>& records,
+    int64_t windowUs,
+    const RssiSmoothingConfig& smoothing = RssiSmoothingConfig()
+  ) {
+    ScanEngine engine;
+    engine.setRssiSmoothing(smoothing);
+    ScanCoalescer coalescer(windowUs);
+    ScanDeltaTracker deltas;
+    std::vector<DeviceKey> batch;
+    ChannelTraffic traffic;
+
+    auto flush = [&]() {
+      coalescer.take(batch);
+      if (batch.empty()) return;
+      traffic.messages++;
+      traffic.devices += batch.size();
+      bool changed = false;
+      for (const auto& key : batch) {
+        const auto device = engine.find(key);
+        if (device != nullptr && deltas.diff(*device) != kDeltaNone) changed = true;
+      }
+      if (changed) traffic.changedMessages++;
+    };
+
+    for (const auto& record : records) {
+      auto nowUs = static_cast<int64_t>(record.timestampUs);
+      if (coalescer.isDue(nowUs)) {
+        flush();
+      }
+
+      const auto merged = ingest(engine, record);
+      if (merged == nullptr) continue;
+
+      if (coalescer.isEnabled()) {
+        coalescer.add(merged->Key(), nowUs);
+      } else {
+        traffic.messages++;
+        traffic.devices++;
+      }
+    }
+
+    flush();
+
+    traffic.fullSnapshots = deltas.FullSnapshots();
+    traffic.rssiOnlyDeltas = deltas.RssiOnlyDeltas();
+    traffic.partialDeltas = deltas.PartialDeltas();
+    traffic.unchangedSkips = deltas.UnchangedSkips();
+    traffic.seconds = (records.back().timestampUs - records.front().timestampUs) / 1e6;
+    return traffic;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  std::string path = argc > 1 ? argv[1] : std::string(LAYRZ_BLE_BENCHMARK_DATA_DIR) + "/sample.stream";
+  int iterations = argc > 2 ? std::atoi(argv[2]) : 200;
+  if (iterations <= 0) iterations = 1;
+  int64_t windowMs = argc > 3 ? std::atoll(argv[3]) : ScanCoalescer::kDefaultWindowUs / 1000;
+
+  std::vector<RecordedAdvertisement> records;
+  std::string error;
+  if (!loadAdvertisementStream(path, records, error)) {
+    std::fprintf(stderr, "Failed to load the stream: %s\n", error.c_str());
+    return 1;
+  }
+
+  if (records.empty()) {
+    std::fprintf(stderr, "The stream %s is empty\n", path.c_str());
+    return 1;
+  }
+
+  ScanEngine engine;
+  if (argc > 4) {
+    ServiceUuidFilter serviceFilter;
+    if (!serviceFilter.add(argv[4])) {
+      std::fprintf(stderr, "Invalid service UUID: %s\n", argv[4]);
+      return 1;
+    }
+    engine.setServiceFilter(std::move(serviceFilter));
+  }
+
+  // Warm up, so the table of visible devices is already populated like in a running scan
+  size_t merged = 0;
+  for (const auto& record : records) {
+    if (ingest(engine, record) != nullptr) merged++;
+  }
+
+  auto allocationsBefore = currentAllocations();
+  auto start = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < iterations; i++) {
+    for (const auto& record : records) {
+      if (ingest(engine, record) != nullptr) merged++;
+    }
+  }
+
+  auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  auto allocationsAfter = currentAllocations();
+
+  double adverts = static_cast<double>(records.size()) * iterations;
+  std::printf("stream:             %s\n", path.c_str());
+  std::printf("adverts per pass:   %zu\n", records.size());
+  std::printf("passes:             %d\n", iterations);
+  std::printf("visible devices:    %zu (~%zu bytes)\n", engine.size(), engine.ApproximateBytes());
+  std::printf("merged adverts:     %zu\n", merged);
+  std::printf("elapsed:            %.3f s\n", elapsed);
+  std::printf("adverts/sec:        %.0f\n", adverts / elapsed);
+  std::printf("ns/advert:          %.1f\n", elapsed * 1e9 / adverts);
+  std::printf("allocations/advert: %.2f\n", (allocationsAfter.allocations - allocationsBefore.allocations) / adverts);
+  std::printf("bytes/advert:       %.1f\n", (allocationsAfter.bytes - allocationsBefore.bytes) / adverts);
+
+  auto fingerprinted = engine.FingerprintHits() + engine.FingerprintMisses();
+  if (fingerprinted > 0) {
+    std::printf("fingerprint hits:   %.1f%% (payload not parsed)\n", engine.FingerprintHits() * 100.0 / fingerprinted);
+  }
+  if (engine.ServiceFilter().isEnabled()) {
+    std::printf("service filter:     %llu devices matched, %llu adverts dropped\n",
+      static_cast<unsigned long long>(engine.ServiceFilterMatches()),
+      static_cast<unsigned long long>(engine.ServiceFilterDrops()));
+  }
+
+  auto direct = replayCoalesced(records, 0);
+  auto coalesced = replayCoalesced(records, windowMs * 1000);
+  if (direct.seconds > 0) {
+    std::printf("messages/sec:       %.1f direct, %.1f with a %lld ms window (%.1f devices per batch)\n",
+      direct.messages / direct.seconds,
+      coalesced.messages / coalesced.seconds,
+      static_cast<long long>(windowMs),
+      coalesced.messages > 0 ? static_cast<double>(coalesced.devices) / coalesced.messages : 0.0);
+    std::printf("devices sent/sec:   %.1f direct, %.1f coalesced\n",
+      direct.devices / direct.seconds,
+      coalesced.devices / coalesced.seconds);
+  }
+  if (coalesced.devices > 0) {
+    double sent = static_cast<double>(coalesced.devices);
+    std::printf("coalesced entries:  %.1f%% full, %.1f%% rssi only, %.1f%% partial, %.1f%% unchanged (skipped)\n",
+      coalesced.fullSnapshots * 100 / sent,
+      coalesced.rssiOnlyDeltas * 100 / sent,
+      coalesced.partialDeltas * 100 / sent,
+      coalesced.unchangedSkips * 100 / sent);
+
+    // Kalman smoothing, reported on a 3 dBm move or every 2 s
+    RssiSmoothingConfig smoothing;
+    smoothing.mode = RssiSmoothingMode::kKalman;
+    smoothing.minDeltaDbm = 3;
+    smoothing.maxIntervalUs = 2000000;
+    auto smoothed = replayCoalesced(records, windowMs * 1000, smoothing);
+    std::printf("rssi smoothing:     %.1f deltas/sec raw, %.1f smoothed (%.1f vs %.1f messages/sec)\n",
+      (coalesced.devices - coalesced.unchangedSkips) / coalesced.seconds,
+      (smoothed.devices - smoothed.unchangedSkips) / smoothed.seconds,
+      coalesced.changedMessages / coalesced.seconds,
+      smoothed.changedMessages / smoothed.seconds);
+  }
+  return 0;
+}
@@ -0,0 +1,168 @@
+#include "synthetic_fleet.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+
+namespace layrz_ble::benchmarks {
+  namespace {
+    enum class DeviceKind {
+      kIBeacon,
+      kEddystone,
+      kVendor,
+    };
+
+    struct SyntheticDevice {
+      uint64_t address = 0;
+      uint8_t addressType = 0;
+      DeviceKind kind = DeviceKind::kIBeacon;
+      int16_t rssi = -70;
+      int8_t txPower = -59;
+      uint32_t counter = 0;
+      uint16_t reading = 0;
+    };
+
+    void appendFlags(std::vector<uint8_t>& payload) {
+      payload.insert(payload.end(), {0x02, 0x01, 0x06});
+    }
+
+    void appendIBeacon(std::vector<uint8_t>& payload, const SyntheticDevice& device) {
+      appendFlags(payload);
+      // Manufacturer data of Apple (0x004C), iBeacon type 0x02 length 0x15
+      payload.insert(payload.end(), {0x1A, 0xFF, 0x4C, 0x00, 0x02, 0x15});
+      // Proximity UUID shared by the fleet, major and minor from the address
+      for (uint8_t i = 0; i < 16; i++) payload.push_back(static_cast<uint8_t>(0xA0 + i));
+      payload.push_back(static_cast<uint8_t>(device.address >> 24));
+      payload.push_back(static_cast<uint8_t>(device.address >> 16));
+      payload.push_back(static_cast<uint8_t>(device.address >> 8));
+      payload.push_back(static_cast<uint8_t>(device.address));
+      payload.push_back(static_cast<uint8_t>(device.txPower));
+    }
+
+    void appendEddystone(std::vector<uint8_t>& payload, const SyntheticDevice& device) {
+      appendFlags(payload);
+      // Complete list of 16 bits services: 0xFEAA
+      payload.insert(payload.end(), {0x03, 0x03, 0xAA, 0xFE});
+      if (device.counter % 2 == 0) {
+        // UID frame: tx power, 10 bytes namespace, 6 bytes instance, 2 reserved
+        payload.insert(payload.end(), {0x17, 0x16, 0xAA, 0xFE, 0x00, static_cast<uint8_t>(device.txPower)});
+        for (uint8_t i = 0; i < 10; i++) payload.push_back(static_cast<uint8_t>(0x10 + i));
+        for (int shift = 40; shift >= 0; shift -= 8) payload.push_back(static_cast<uint8_t>(device.address >> shift));
+        payload.insert(payload.end(), {0x00, 0x00});
+      } else {
+        // TLM frame: version, battery, temperature, advertisement count, uptime
+        uint32_t uptime = device.counter * 10;
+        payload.insert(payload.end(), {0x11, 0x16, 0xAA, 0xFE, 0x20, 0x00, 0x0B, 0xB8, 0x16, 0x80});
+        for (int shift = 24; shift >= 0; shift -= 8) payload.push_back(static_cast<uint8_t>(device.counter >> shift));
+        for (int shift = 24; shift >= 0; shift -= 8) payload.push_back(static_cast<uint8_t>(uptime >> shift));
+      }
+    }
+
+    void appendVendor(std::vector<uint8_t>& payload, const SyntheticDevice& device) {
+      appendFlags(payload);
+      char name[16];
+      int length = std::snprintf(name, sizeof(name), "SNS-%04X", static_cast<unsigned>(device.address & 0xFFFF));
+      payload.push_back(static_cast<uint8_t>(length + 1));
+      payload.push_back(0x09);
+      payload.insert(payload.end(), name, name + length);
+      // Manufacturer data of Nordic (0x0059): model, reading, sequence
+      payload.insert(payload.end(), {0x0B, 0xFF, 0x59, 0x00, 0x01});
+      payload.push_back(static_cast<uint8_t>(device.reading >> 8));
+      payload.push_back(static_cast<uint8_t>(device.reading));
+      for (int shift = 24; shift >= 0; shift -= 8) payload.push_back(static_cast<uint8_t>(device.counter >> shift));
+      payload.push_back(0x64);
+    }
+  } // namespace
+
+  bool parsePayloadMix(const std::string& text, PayloadMix& mix) {
+    PayloadMix parsed;
+    parsed.ibeacon = 0;
+    parsed.eddystone = 0;
+    parsed.vendor = 0;
+
+    std::istringstream stream(text);
+    std::string entry;
+    while (std::getline(stream, entry, ',')) {
+      auto separator = entry.find(':');
+      if (separator == std::string::npos) return false;
+      std::string kind = entry.substr(0, separator);
+      char* end = nullptr;
+      double weight = std::strtod(entry.c_str() + separator + 1, &end);
+      if (end == entry.c_str() + separator + 1 || weight < 0) return false;
+
+      if (kind == "ibeacon") parsed.ibeacon = weight;
+      else if (kind == "eddystone") parsed.eddystone = weight;
+      else if (kind == "vendor") parsed.vendor = weight;
+      else return false;
+    }
+
+    if (parsed.ibeacon + parsed.eddystone + parsed.vendor <= 0) return false;
+    mix = parsed;
+    return true;
+  }
+
+  void generateFleet(const FleetConfig& config, std::vector<RecordedAdvertisement>& records) {
+    std::mt19937 random(config.seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    double total = config.mix.ibeacon + config.mix.eddystone + config.mix.vendor;
+
+    std::vector<SyntheticDevice> devices(config.devices);
+    for (size_t i = 0; i < devices.size(); i++) {
+      auto& device = devices[i];
+      device.addressType = unit(random) < config.randomAddressShare ? 1 : 0;
+      // Random static addresses have the two upper bits set
+      uint64_t base = device.addressType ? 0xC00000000000ULL : 0x00A0C9000000ULL;
+      device.address = base | (static_cast<uint64_t>(random()) << 8 & 0x3FFFFF000000ULL) | (i & 0xFFFFFF);
+      double pick = unit(random) * total;
+      device.kind = pick < config.mix.ibeacon ? DeviceKind::kIBeacon
+        : pick < config.mix.ibeacon + config.mix.eddystone ? DeviceKind::kEddystone
+        : DeviceKind::kVendor;
+      device.rssi = static_cast<int16_t>(-95 + static_cast<int>(unit(random) * 55));
+      device.reading = static_cast<uint16_t>(random());
+    }
+
+    // Every device advertises at the configured interval, from a random phase, with a 10 ms jitter
+    // like the advDelay of the Bluetooth spec
+    double intervalUs = 1e6 / std::max(config.advertsPerSecond, 1e-3);
+    uint64_t durationUs = static_cast<uint64_t>(config.seconds * 1e6);
+    size_t perDevice = static_cast<size_t>(durationUs / intervalUs);
+    size_t first = records.size();
+    records.reserve(first + perDevice * devices.size());
+
+    std::uniform_int_distribution<int> rssiStep(-2, 2);
+    for (auto& device : devices) {
+      double timestampUs = unit(random) * intervalUs;
+      for (size_t n = 0; n < perDevice; n++, timestampUs += intervalUs) {
+        device.counter++;
+        device.reading = static_cast<uint16_t>(device.reading + rssiStep(random));
+        device.rssi = static_cast<int16_t>(std::max(-100, std::min(-30, device.rssi + rssiStep(random))));
+
+        RecordedAdvertisement record;
+        record.timestampUs = static_cast<uint64_t>(timestampUs + unit(random) * 10000);
+        record.address = device.address;
+        record.addressType = device.addressType;
+        record.rssi = device.rssi;
+        record.payload.reserve(31);
+        switch (device.kind) {
+          case DeviceKind::kIBeacon:
+            appendIBeacon(record.payload, device);
+            break;
+          case DeviceKind::kEddystone:
+            appendEddystone(record.payload, device);
+            break;
+          case DeviceKind::kVendor:
+            record.txPower = device.txPower;
+            appendVendor(record.payload, device);
+            break;
+        }
+        records.push_back(std::move(record));
+      }
+    }
+
+    std::sort(records.begin() + first, records.end(), [](const RecordedAdvertisement& a, const RecordedAdvertisement& b) {
+      return a.timestampUs < b.timestampUs;
+    });
+  }
+} // namespace layrz_ble::benchmarks
@@ -0,0 +1,52 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_BENCHMARKS_SYNTHETIC_FLEET_H__
+#define __LAYRZ_BLE_BENCHMARKS_SYNTHETIC_FLEET_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "replay_stream.h"
+
+namespace layrz_ble::benchmarks {
+  /// @brief Shares of the advertisement kinds in a fleet, relative weights
+  struct PayloadMix {
+    // Apple iBeacon, fixed payload
+    double ibeacon = 40;
+    // Eddystone UID frames interleaved with TLM frames whose counters change
+    double eddystone = 30;
+    // Named sensor with vendor manufacturer data carrying a changing reading
+    double vendor = 30;
+  };
+
+  /// @brief Shape of a synthetic fleet
+  struct FleetConfig {
+    size_t devices = 1000;
+    // Advertisements per second of each device
+    double advertsPerSecond = 1.0;
+    double seconds = 10.0;
+    PayloadMix mix;
+    // Share of the devices with a random (private) address
+    double randomAddressShare = 0.5;
+    uint32_t seed = 1;
+  };
+
+  /// @brief Parse a payload mix like `ibeacon:40,eddystone:30,vendor:30`
+  /// @param text
+  /// @param mix the weights, the kinds not listed are set to 0
+  /// @return bool false on an unknown kind or a malformed weight
+  bool parsePayloadMix(const std::string& text, PayloadMix& mix);
+
+  /// @brief Generate the advertisements of a fleet, ordered by timestamp
+  /// @param config
+  /// @param records where to append the advertisements
+  /// @return void
+  /// @note Deterministic for a given config. Every device advertises at the configured rate with a random
+  /// phase and jitter, its RSSI does a random walk, and the changing fields (TLM counters, vendor readings)
+  /// change on every advertisement like on real sensors.
+  void generateFleet(const FleetConfig& config, std::vector<RecordedAdvertisement>& records);
+} // namespace layrz_ble::benchmarks
+
+#endif // __LAYRZ_BLE_BENCHMARKS_SYNTHETIC_FLEET_H__
@@ -0,0 +1,77 @@
+#include "ad_parser.h"
+
+#include <cstring>
+
+namespace layrz_ble {
+
+  bool parseManufacturerData(const AdStructure& structure, uint16_t& companyId, ByteView& data) {
+    if (structure.type != kAdTypeManufacturerData || structure.data.size() <= 2) {
+      return false;
+    }
+
+    companyId = static_cast<uint16_t>((structure.data[1] << 8) | structure.data[0]);
+    data = structure.data.subview(2);
+    return true;
+  } // parseManufacturerData
+
+  uint64_t fingerprintAdvertisement(ByteView payload) {
+    // Word at a time multiply-xorshift, a legacy advertisement is 4 words, the collisions do not matter much
+    // as a false hit only delays the update of a device until its payload changes again
+    constexpr uint64_t kMultiplier = 0x9E3779B97F4A7C15ULL;
+    uint64_t hash = 0xCBF29CE484222325ULL ^ (payload.size() * kMultiplier);
+
+    const uint8_t* cursor = payload.data();
+    size_t remaining = payload.size();
+    while (remaining >= sizeof(uint64_t)) {
+      uint64_t word;
+      std::memcpy(&word, cursor, sizeof(word));
+      hash = (hash ^ word) * kMultiplier;
+      hash ^= hash >> 32;
+      cursor += sizeof(word);
+      remaining -= sizeof(word);
+    }
+
+    if (remaining > 0) {
+      uint64_t word = 0;
+      std::memcpy(&word, cursor, remaining);
+      hash = (hash ^ word) * kMultiplier;
+      hash ^= hash >> 32;
+    }
+
+    return hash != 0 ? hash : 1;
+  } // fingerprintAdvertisement
+
+  bool parseServiceData(const AdStructure& structure, Uuid128& uuid, ByteView& data) {
+    size_t uuidLength = 0;
+    switch (structure.type) {
+      case kAdTypeServiceData16BitUuid:
+        uuidLength = 2;
+        break;
+      case kAdTypeServiceData32BitUuid:
+        uuidLength = 4;
+        break;
+      case kAdTypeServiceData128BitUuid:
+        uuidLength = 16;
+        break;
+      default:
+        return false;
+    }
+
+    if (structure.data.size() < uuidLength) {
+      return false;
+    }
+
+    const ByteView& bytes = structure.data;
+    if (uuidLength == 16) {
+      uuid = Uuid128::fromLittleEndian(bytes);
+    } else {
+      uint32_t shortUuid = static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8);
+      if (uuidLength == 4) {
+        shortUuid |= (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+      }
+      uuid = Uuid128::fromShort(shortUuid);
+    }
+    data = structure.data.subview(uuidLength);
+    return true;
+  } // parseServiceData
+} // namespace layrz_ble
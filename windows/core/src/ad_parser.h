@@ -0,0 +1,132 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_AD_PARSER_H__
+#define __LAYRZ_BLE_CORE_AD_PARSER_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#include "byte_view.h"
+#include "uuid.h"
+
+namespace layrz_ble {
+  // AD types from the Bluetooth Core Specification Supplement, Part A
+  constexpr uint8_t kAdTypeIncomplete16BitUuids = 0x02;
+  constexpr uint8_t kAdTypeComplete16BitUuids = 0x03;
+  constexpr uint8_t kAdTypeIncomplete32BitUuids = 0x04;
+  constexpr uint8_t kAdTypeComplete32BitUuids = 0x05;
+  constexpr uint8_t kAdTypeIncomplete128BitUuids = 0x06;
+  constexpr uint8_t kAdTypeComplete128BitUuids = 0x07;
+  constexpr uint8_t kAdTypeShortenedLocalName = 0x08;
+  constexpr uint8_t kAdTypeCompleteLocalName = 0x09;
+  constexpr uint8_t kAdTypeTxPowerLevel = 0x0A;
+  constexpr uint8_t kAdTypeServiceData16BitUuid = 0x16;
+  constexpr uint8_t kAdTypeServiceData32BitUuid = 0x20;
+  constexpr uint8_t kAdTypeServiceData128BitUuid = 0x21;
+  constexpr uint8_t kAdTypeManufacturerData = 0xFF;
+
+  /// @brief Max length of the data of a single AD structure, the length byte also counts the type
+  constexpr size_t kMaxAdStructureDataLength = 254;
+
+  /// @brief One AD structure (length, type, data) of a raw advertisement
+  /// @note The data is a view into the advertisement buffer, nothing is copied.
+  struct AdStructure {
+    uint8_t type = 0;
+    ByteView data;
+  };
+
+  /// @brief Forward iterator over the AD structures of a raw advertisement
+  /// @note Iteration stops at the first zero length (early termination) or truncated structure.
+  class AdStructureIterator {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = AdStructure;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const AdStructure*;
+      using reference = const AdStructure&;
+
+      AdStructureIterator() = default;
+      explicit AdStructureIterator(ByteView payload) : payload_(payload) { load(); }
+
+      reference operator*() const { return current_; }
+      pointer operator->() const { return &current_; }
+
+      AdStructureIterator& operator++() {
+        offset_ = next_;
+        load();
+        return *this;
+      }
+
+      AdStructureIterator operator++(int) {
+        AdStructureIterator previous = *this;
+        ++(*this);
+        return previous;
+      }
+
+      bool operator==(const AdStructureIterator& other) const { return atEnd() == other.atEnd() && (atEnd() || offset_ == other.offset_); }
+      bool operator!=(const AdStructureIterator& other) const { return !(*this == other); }
+
+    private:
+      bool atEnd() const { return offset_ >= payload_.size(); }
+
+      void load() {
+        if (atEnd()) return;
+
+        size_t sectionLength = payload_[offset_];
+        if (sectionLength == 0 || offset_ + 1 + sectionLength > payload_.size()) {
+          offset_ = payload_.size();
+          return;
+        }
+
+        current_.type = payload_[offset_ + 1];
+        current_.data = payload_.subview(offset_ + 2, sectionLength - 1);
+        next_ = offset_ + 1 + sectionLength;
+      }
+
+      ByteView payload_;
+      size_t offset_ = 0;
+      size_t next_ = 0;
+      AdStructure current_;
+  }; // class AdStructureIterator
+
+  /// @brief Range over the AD structures of a raw advertisement, usable in range-based for loops
+  class AdStructures {
+    public:
+      explicit AdStructures(ByteView payload) : payload_(payload) {}
+
+      AdStructureIterator begin() const { return AdStructureIterator(payload_); }
+      AdStructureIterator end() const { return AdStructureIterator(); }
+
+    private:
+      ByteView payload_;
+  }; // class AdStructures
+
+  /// @brief Split a manufacturer specific data structure into its company ID and its data
+  /// @param structure the AD structure, must be of type kAdTypeManufacturerData
+  /// @param companyId the company identifier
+  /// @param data view of the bytes after the company identifier
+  /// @return bool false if the structure is not manufacturer data or it carries no data
+  bool parseManufacturerData(const AdStructure& structure, uint16_t& companyId, ByteView& data);
+
+  /// @brief Split a service data structure into its service UUID and its data
+  /// @param structure the AD structure, of type kAdTypeServiceData16BitUuid, 32BitUuid or 128BitUuid
+  /// @param uuid the full service UUID, the 16 and 32 bits ones expanded over the Bluetooth base UUID
+  /// @param data view of the bytes after the UUID
+  /// @return bool false if the structure is not service data or it is truncated
+  bool parseServiceData(const AdStructure& structure, Uuid128& uuid, ByteView& data);
+
+  /// @brief Check if a structure carries a local name (complete or shortened)
+  /// @param structure
+  /// @return bool
+  inline bool isLocalName(const AdStructure& structure) {
+    return (structure.type == kAdTypeCompleteLocalName || structure.type == kAdTypeShortenedLocalName) && !structure.data.empty();
+  }
+
+  /// @brief Cheap 64 bits hash of a raw advertisement, to detect a repeated payload without parsing it
+  /// @param payload the raw advertisement
+  /// @return uint64_t never 0, so 0 can stand for "no fingerprint"
+  uint64_t fingerprintAdvertisement(ByteView payload);
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_AD_PARSER_H__
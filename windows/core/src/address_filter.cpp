@@ -0,0 +1,71 @@
+#include "address_filter.h"
+
+namespace layrz_ble {
+
+  /// @brief Check if the filter discards anything
+  /// @return bool
+  bool AddressFilter::isEnabled() const {
+    return !allowed_.empty() || !denied_.empty();
+  }
+
+  /// @brief Check if an address passes the filter
+  /// @param address the 48 bits address, the address type bits are ignored
+  /// @return bool false if the address is denied, or there is an allowlist and it is not in it
+  bool AddressFilter::allows(uint64_t address) const {
+    DeviceKey key = address & kBluetoothAddressMask;
+    if (!denied_.empty() && denied_.find(key) != DeviceIndex::kNotFound) {
+      return false;
+    }
+    return allowed_.empty() || allowed_.find(key) != DeviceIndex::kNotFound;
+  } // allows
+
+  /// @brief Replace the allowlist
+  /// @param addresses an empty list removes the allowlist
+  /// @return void
+  void AddressFilter::setAllowed(const std::vector<uint64_t>& addresses) {
+    fill(allowed_, addresses);
+  }
+
+  /// @brief Replace the denylist
+  /// @param addresses
+  /// @return void
+  void AddressFilter::setDenied(const std::vector<uint64_t>& addresses) {
+    fill(denied_, addresses);
+  }
+
+  /// @brief Remove both lists, every address passes
+  /// @return void
+  void AddressFilter::clear() {
+    allowed_.clear();
+    denied_.clear();
+  }
+
+  /// @brief Get the number of allowed addresses
+  /// @return size_t 0 if there is no allowlist
+  size_t AddressFilter::AllowedCount() const {
+    return allowed_.size();
+  }
+
+  /// @brief Get the number of denied addresses
+  /// @return size_t
+  size_t AddressFilter::DeniedCount() const {
+    return denied_.size();
+  }
+
+  /// @brief Replace the content of a set, the duplicated addresses are stored once
+  /// @param set
+  /// @param addresses
+  /// @return void
+  /// @note The set is rebuilt from scratch, so replacing a large list by a small one releases its memory
+  void AddressFilter::fill(DeviceIndex& set, const std::vector<uint64_t>& addresses) {
+    set = DeviceIndex();
+    if (addresses.empty()) {
+      return;
+    }
+
+    set.reserve(addresses.size());
+    for (uint64_t address : addresses) {
+      set.insert(address & kBluetoothAddressMask, 0);
+    }
+  } // fill
+} // namespace layrz_ble
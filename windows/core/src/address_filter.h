@@ -0,0 +1,40 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_ADDRESS_FILTER_H__
+#define __LAYRZ_BLE_CORE_ADDRESS_FILTER_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "device_index.h"
+
+namespace layrz_ble {
+  /// @brief Allowlist and denylist of Bluetooth addresses, checked before any parsing of an advertisement
+  /// @note The addresses are kept in open addressing integer sets (DeviceIndex), a lookup costs one hash
+  /// whatever the size of the lists, so a fleet of thousands of known tags filters as fast as a single one.
+  /// The address type is ignored, the lists hold the 48 bits addresses the user knows as MAC addresses.
+  class AddressFilter {
+    public:
+      AddressFilter() = default;
+
+      bool isEnabled() const;
+      bool allows(uint64_t address) const;
+
+      void setAllowed(const std::vector<uint64_t>& addresses);
+      void setDenied(const std::vector<uint64_t>& addresses);
+      void clear();
+
+      size_t AllowedCount() const;
+      size_t DeniedCount() const;
+
+    private:
+      static void fill(DeviceIndex& set, const std::vector<uint64_t>& addresses);
+
+      // An empty allowlist allows every address not denied
+      DeviceIndex allowed_;
+      DeviceIndex denied_;
+  }; // class AddressFilter
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_ADDRESS_FILTER_H__
@@ -0,0 +1,398 @@
+#include "adv_capture.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace layrz_ble {
+  namespace {
+    void writeLittleEndian(uint8_t* out, uint64_t value, size_t size) {
+      for (size_t i = 0; i < size; i++) {
+        out[i] = static_cast<uint8_t>(value >> (8 * i));
+      }
+    }
+
+    uint64_t readLittleEndian(const uint8_t* in, size_t size) {
+      uint64_t value = 0;
+      for (size_t i = 0; i < size; i++) {
+        value |= static_cast<uint64_t>(in[i]) << (8 * i);
+      }
+      return value;
+    }
+
+    void buildFileHeader(uint8_t* header) {
+      std::memcpy(header, capture::kMagic, sizeof(capture::kMagic));
+      writeLittleEndian(header + 8, capture::kVersion, 2);
+      writeLittleEndian(header + 10, capture::kFileHeaderSize, 2);
+      writeLittleEndian(header + 12, 0, 4);
+    }
+  } // namespace
+
+  /// @brief Destroy the CaptureWriter object, the pending records are written
+  CaptureWriter::~CaptureWriter() {
+    close();
+  }
+
+  /// @brief Open a capture file, a new one is created and an existing one is appended to
+  /// @param path
+  /// @param error the reason of the failure, if any
+  /// @return bool false if the file cannot be opened or is not a capture
+  bool CaptureWriter::open(const std::string& path, std::string& error) {
+    close();
+
+    std::FILE* file = std::fopen(path.c_str(), "ab+");
+    if (file == nullptr) {
+      error = "Cannot open " + path;
+      return false;
+    }
+
+    std::fseek(file, 0, SEEK_END);
+    long size = std::ftell(file);
+    if (size == 0) {
+      uint8_t header[capture::kFileHeaderSize];
+      buildFileHeader(header);
+      std::fwrite(header, 1, sizeof(header), file);
+      bytesWritten_ = sizeof(header);
+    } else {
+      uint8_t header[capture::kFileHeaderSize] = {};
+      std::fseek(file, 0, SEEK_SET);
+      size_t read = std::fread(header, 1, sizeof(header), file);
+      if (read != sizeof(header) || !CaptureReader::isCapture(ByteView(header, read))) {
+        std::fclose(file);
+        error = path + " is not a capture file";
+        return false;
+      }
+
+      // Walk the records, appending after a torn one would shift every following record
+      size_t offset = capture::kFileHeaderSize;
+      uint8_t recordHeader[capture::kRecordHeaderSize];
+      std::fseek(file, static_cast<long>(offset), SEEK_SET);
+      while (std::fread(recordHeader, 1, sizeof(recordHeader), file) == sizeof(recordHeader)) {
+        offset += sizeof(recordHeader) + static_cast<size_t>(readLittleEndian(recordHeader + 18, 2));
+        std::fseek(file, static_cast<long>(offset), SEEK_SET);
+      }
+      if (offset != static_cast<size_t>(size)) {
+        std::fclose(file);
+        error = path + " ends with a torn record";
+        return false;
+      }
+
+      // Appending mode, the writes go to the end whatever the position
+      bytesWritten_ = 0;
+    }
+
+    file_ = file;
+    path_ = path;
+    recordCount_ = 0;
+    return true;
+  } // open
+
+  /// @brief Check if a capture is being written
+  /// @return bool
+  bool CaptureWriter::isOpen() const {
+    return file_ != nullptr;
+  }
+
+  /// @brief Append an advertisement
+  /// @param advertisement
+  /// @return bool false if no file is open or the write failed
+  /// @note The payload is clamped to 65535 bytes and the RSSI and tx power to a signed byte
+  bool CaptureWriter::append(const AdvertisementView& advertisement) {
+    if (file_ == nullptr) {
+      return false;
+    }
+
+    size_t payloadLength = std::min<size_t>(advertisement.payload.size(), UINT16_MAX);
+    int64_t rssi = std::max<int64_t>(INT8_MIN, std::min<int64_t>(INT8_MAX, advertisement.rssi));
+    int16_t txPower = advertisement.txPower ? static_cast<int16_t>(*advertisement.txPower) : 0;
+    txPower = std::max<int16_t>(INT8_MIN, std::min<int16_t>(INT8_MAX, txPower));
+
+    uint8_t header[capture::kRecordHeaderSize];
+    writeLittleEndian(header, static_cast<uint64_t>(advertisement.timestampUs), 8);
+    writeLittleEndian(header + 8, advertisement.address & kBluetoothAddressMask, 6);
+    header[14] = advertisement.addressType;
+    header[15] = static_cast<uint8_t>(static_cast<int8_t>(rssi));
+    header[16] = static_cast<uint8_t>(static_cast<int8_t>(txPower));
+    header[17] = static_cast<uint8_t>((advertisement.txPower ? capture::kFlagTxPower : 0)
+      | ((advertisement.primaryPhy & capture::kFlagPhyMask) << capture::kFlagPrimaryPhyShift)
+      | ((advertisement.secondaryPhy & capture::kFlagPhyMask) << capture::kFlagSecondaryPhyShift));
+    writeLittleEndian(header + 18, payloadLength, 2);
+
+    if (std::fwrite(header, 1, sizeof(header), file_) != sizeof(header)
+      || (payloadLength > 0 && std::fwrite(advertisement.payload.data(), 1, payloadLength, file_) != payloadLength)) {
+      return false;
+    }
+
+    recordCount_++;
+    bytesWritten_ += sizeof(header) + payloadLength;
+    return true;
+  } // append
+
+  /// @brief Write the buffered records to the file
+  /// @return void
+  void CaptureWriter::flush() {
+    if (file_ != nullptr) {
+      std::fflush(file_);
+    }
+  } // flush
+
+  /// @brief Write the buffered records and close the file
+  /// @return void
+  void CaptureWriter::close() {
+    if (file_ != nullptr) {
+      std::fclose(file_);
+      file_ = nullptr;
+    }
+  } // close
+
+  /// @brief Get the path of the capture
+  /// @return const std::string& the last opened one
+  const std::string& CaptureWriter::Path() const {
+    return path_;
+  }
+
+  /// @brief Get the number of records appended since the file was opened
+  /// @return uint64_t
+  uint64_t CaptureWriter::RecordCount() const {
+    return recordCount_;
+  }
+
+  /// @brief Get the number of bytes appended since the file was opened, the file header included
+  /// @return uint64_t
+  uint64_t CaptureWriter::BytesWritten() const {
+    return bytesWritten_;
+  }
+
+  /// @brief Destroy the MappedFile object
+  MappedFile::~MappedFile() {
+    close();
+  }
+
+  /// @brief Map a whole file in memory, read-only
+  /// @param path
+  /// @param error the reason of the failure, if any
+  /// @return bool
+  bool MappedFile::open(const std::string& path, std::string& error) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+      error = "Cannot open " + path;
+      return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+      CloseHandle(file);
+      error = "Cannot map the empty file " + path;
+      return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* data = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (data == nullptr) {
+      if (mapping != nullptr) CloseHandle(mapping);
+      CloseHandle(file);
+      error = "Cannot map " + path;
+      return false;
+    }
+
+    file_ = file;
+    mapping_ = mapping;
+    data_ = static_cast<const uint8_t*>(data);
+    size_ = static_cast<size_t>(size.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      error = "Cannot open " + path;
+      return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+      ::close(fd);
+      error = "Cannot map the empty file " + path;
+      return false;
+    }
+
+    void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps the file alive
+    ::close(fd);
+    if (data == MAP_FAILED) {
+      error = "Cannot map " + path;
+      return false;
+    }
+
+    data_ = static_cast<const uint8_t*>(data);
+    size_ = static_cast<size_t>(info.st_size);
+#endif
+    return true;
+  } // open
+
+  /// @brief Unmap the file
+  /// @return void
+  void MappedFile::close() {
+    if (data_ == nullptr) {
+      return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(data_);
+    CloseHandle(static_cast<HANDLE>(mapping_));
+    CloseHandle(static_cast<HANDLE>(file_));
+    mapping_ = nullptr;
+    file_ = nullptr;
+#else
+    munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+  } // close
+
+  /// @brief Get the mapped bytes
+  /// @return ByteView empty if no file is mapped
+  ByteView MappedFile::view() const {
+    return ByteView(data_, size_);
+  }
+
+  /// @brief Start reading a capture
+  /// @param data the whole capture, it must outlive the reader and the views it returns
+  /// @param error the reason of the failure, if any
+  /// @return bool false if the data is not a capture of a supported version
+  bool CaptureReader::open(ByteView data, std::string& error) {
+    if (!isCapture(data)) {
+      error = "Not a capture file";
+      return false;
+    }
+
+    uint16_t version = static_cast<uint16_t>(readLittleEndian(data.data() + 8, 2));
+    if (version > capture::kVersion) {
+      error = "Unsupported capture version " + std::to_string(version);
+      return false;
+    }
+
+    size_t headerSize = static_cast<size_t>(readLittleEndian(data.data() + 10, 2));
+    if (headerSize < capture::kFileHeaderSize || headerSize > data.size()) {
+      error = "Invalid capture header";
+      return false;
+    }
+
+    data_ = data;
+    firstRecord_ = headerSize;
+    rewind();
+    return true;
+  } // open
+
+  /// @brief Read the next record
+  /// @param advertisement the record, its payload is a view into the capture
+  /// @return bool false at the end of the capture, or before a torn record (see isTruncated())
+  bool CaptureReader::next(AdvertisementView& advertisement) {
+    if (offset_ + capture::kRecordHeaderSize > data_.size()) {
+      truncated_ = offset_ < data_.size();
+      return false;
+    }
+
+    const uint8_t* header = data_.data() + offset_;
+    size_t payloadLength = static_cast<size_t>(readLittleEndian(header + 18, 2));
+    if (offset_ + capture::kRecordHeaderSize + payloadLength > data_.size()) {
+      truncated_ = true;
+      return false;
+    }
+
+    advertisement.timestampUs = static_cast<int64_t>(readLittleEndian(header, 8));
+    advertisement.address = readLittleEndian(header + 8, 6);
+    advertisement.addressType = header[14];
+    advertisement.rssi = static_cast<int8_t>(header[15]);
+    if (header[17] & capture::kFlagTxPower) {
+      advertisement.txPower = static_cast<uint16_t>(static_cast<int16_t>(static_cast<int8_t>(header[16])));
+    } else {
+      advertisement.txPower.reset();
+    }
+    advertisement.primaryPhy = (header[17] >> capture::kFlagPrimaryPhyShift) & capture::kFlagPhyMask;
+    advertisement.secondaryPhy = (header[17] >> capture::kFlagSecondaryPhyShift) & capture::kFlagPhyMask;
+    advertisement.advertisingSid = kAdvertisingSidUnknown;
+    advertisement.payload = ByteView(header + capture::kRecordHeaderSize, payloadLength);
+
+    offset_ += capture::kRecordHeaderSize + payloadLength;
+    return true;
+  } // next
+
+  /// @brief Go back to the first record
+  /// @return void
+  void CaptureReader::rewind() {
+    offset_ = firstRecord_;
+    truncated_ = false;
+  } // rewind
+
+  /// @brief Check if the capture ends with a torn record
+  /// @return bool set once next() reached it
+  bool CaptureReader::isTruncated() const {
+    return truncated_;
+  }
+
+  /// @brief Get the position of the next record
+  /// @return size_t bytes from the start of the capture
+  size_t CaptureReader::Offset() const {
+    return offset_;
+  }
+
+  /// @brief Check if bytes start like a capture
+  /// @param data
+  /// @return bool
+  bool CaptureReader::isCapture(ByteView data) {
+    return data.size() >= capture::kFileHeaderSize && std::memcmp(data.data(), capture::kMagic, sizeof(capture::kMagic)) == 0;
+  } // isCapture
+
+  /// @brief Construct a new CaptureReplayer object
+  /// @param speed the replay speed factor, 0 (or less) for as fast as possible
+  CaptureReplayer::CaptureReplayer(double speed) : speed_(speed > 0 ? speed : 0) {}
+
+  /// @brief Get the replay speed factor
+  /// @return double 0 for as fast as possible
+  double CaptureReplayer::Speed() const {
+    return speed_;
+  }
+
+  /// @brief Feed the remaining records of a capture to a handler
+  /// @param reader
+  /// @param handler called on the calling thread with every record
+  /// @return uint64_t the number of records fed
+  uint64_t CaptureReplayer::replay(CaptureReader& reader, const Handler& handler) const {
+    AdvertisementView advertisement;
+    uint64_t count = 0;
+    int64_t firstTimestampUs = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    while (reader.next(advertisement)) {
+      if (count == 0) {
+        firstTimestampUs = advertisement.timestampUs;
+      }
+
+      if (speed_ > 0) {
+        auto offsetUs = static_cast<double>(advertisement.timestampUs - firstTimestampUs) / speed_;
+        std::this_thread::sleep_until(start + std::chrono::microseconds(static_cast<int64_t>(offsetUs)));
+      }
+
+      handler(advertisement);
+      count++;
+    }
+    return count;
+  } // replay
+} // namespace layrz_ble
@@ -0,0 +1,126 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_ADV_CAPTURE_H__
+#define __LAYRZ_BLE_CORE_ADV_CAPTURE_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+
+#include "byte_view.h"
+#include "scan_engine.h"
+
+namespace layrz_ble {
+  /// @brief Binary log of raw advertisements, to replay a field capture through the scan pipeline.
+  /// @note Layout, every integer little endian:
+  ///   - file header (16 bytes): magic `LZBLECAP`, uint16 version, uint16 header size, uint32 reserved
+  ///   - records, back to back (20 bytes + payload): int64 timestamp (us), 6 bytes address, uint8 address
+  ///     type, int8 RSSI, int8 tx power, uint8 flags, uint16 payload length, then the raw AD structures
+  /// The file is append-only: a capture is resumed by appending records. A record torn by a crash only
+  /// loses itself, the reader stops before it, and the writer refuses to append after it.
+  namespace capture {
+    constexpr char kMagic[8] = {'L', 'Z', 'B', 'L', 'E', 'C', 'A', 'P'};
+    constexpr uint16_t kVersion = 1;
+    constexpr size_t kFileHeaderSize = 16;
+    constexpr size_t kRecordHeaderSize = 20;
+    constexpr uint8_t kFlagTxPower = 0x01;
+    // Bits 1-2 hold the primary PHY and bits 3-4 the secondary PHY (AdvertisingPhy), zero is unknown
+    constexpr uint8_t kFlagPrimaryPhyShift = 1;
+    constexpr uint8_t kFlagSecondaryPhyShift = 3;
+    constexpr uint8_t kFlagPhyMask = 0x03;
+  } // namespace capture
+
+  /// @brief Appends advertisements to a capture file
+  /// @note Buffered, a record reaches the disk on flush(), close() or when the buffer fills up.
+  /// Not thread safe, it is fed by a single thread (the ingest worker).
+  class CaptureWriter {
+    public:
+      CaptureWriter() = default;
+      ~CaptureWriter();
+
+      // Disallow copy and assign.
+      CaptureWriter(const CaptureWriter &) = delete;
+      CaptureWriter &operator=(const CaptureWriter &) = delete;
+
+      bool open(const std::string& path, std::string& error);
+      bool isOpen() const;
+      bool append(const AdvertisementView& advertisement);
+      void flush();
+      void close();
+
+      const std::string& Path() const;
+      uint64_t RecordCount() const;
+      uint64_t BytesWritten() const;
+
+    private:
+      std::FILE* file_ = nullptr;
+      std::string path_;
+      uint64_t recordCount_ = 0;
+      uint64_t bytesWritten_ = 0;
+  }; // class CaptureWriter
+
+  /// @brief Read-only view of a whole file, memory mapped
+  class MappedFile {
+    public:
+      MappedFile() = default;
+      ~MappedFile();
+
+      // Disallow copy and assign.
+      MappedFile(const MappedFile &) = delete;
+      MappedFile &operator=(const MappedFile &) = delete;
+
+      bool open(const std::string& path, std::string& error);
+      void close();
+      ByteView view() const;
+
+    private:
+      const uint8_t* data_ = nullptr;
+      size_t size_ = 0;
+#ifdef _WIN32
+      void* file_ = nullptr;
+      void* mapping_ = nullptr;
+#endif
+  }; // class MappedFile
+
+  /// @brief Reads the records of a capture in place, the payloads are views into the capture bytes
+  class CaptureReader {
+    public:
+      CaptureReader() = default;
+
+      bool open(ByteView data, std::string& error);
+      bool next(AdvertisementView& advertisement);
+      void rewind();
+
+      bool isTruncated() const;
+      size_t Offset() const;
+
+      static bool isCapture(ByteView data);
+
+    private:
+      ByteView data_;
+      size_t offset_ = 0;
+      size_t firstRecord_ = 0;
+      bool truncated_ = false;
+  }; // class CaptureReader
+
+  /// @brief Feeds the records of a capture to a handler, at the pace they were captured
+  /// @note With a speed of 2 the gaps between the records are halved, with 0 the records are fed as fast
+  /// as possible. The records keep their captured timestamps, the pipeline ages and coalesces the devices
+  /// on the captured clock whatever the speed.
+  class CaptureReplayer {
+    public:
+      using Handler = std::function<void(const AdvertisementView& advertisement)>;
+
+      explicit CaptureReplayer(double speed = 1.0);
+
+      double Speed() const;
+      uint64_t replay(CaptureReader& reader, const Handler& handler) const;
+
+    private:
+      double speed_;
+  }; // class CaptureReplayer
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_ADV_CAPTURE_H__
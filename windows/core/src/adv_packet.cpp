@@ -0,0 +1,209 @@
+#include "adv_packet.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace layrz_ble {
+
+  /// @brief Construct a new AdvPayload object
+  /// @param data the bytes to copy
+  AdvPayload::AdvPayload(ByteView data) {
+    assign(data);
+  }
+
+  /// @brief Copy constructor
+  /// @param other
+  AdvPayload::AdvPayload(const AdvPayload& other) {
+    assign(other.view());
+  }
+
+  /// @brief Move constructor, steals the heap storage if any
+  /// @param other
+  AdvPayload::AdvPayload(AdvPayload&& other) noexcept
+    : size_(other.size_), heapCapacity_(other.heapCapacity_), heap_(std::move(other.heap_)) {
+    if (heap_ == nullptr) {
+      std::memcpy(inline_.data(), other.inline_.data(), size_);
+    }
+    other.size_ = 0;
+    other.heapCapacity_ = 0;
+  }
+
+  /// @brief Copy assignment operator
+  /// @param other
+  /// @return AdvPayload&
+  AdvPayload& AdvPayload::operator=(const AdvPayload& other) {
+    if (this != &other) {
+      assign(other.view());
+    }
+    return *this;
+  }
+
+  /// @brief Move assignment operator
+  /// @param other
+  /// @return AdvPayload&
+  AdvPayload& AdvPayload::operator=(AdvPayload&& other) noexcept {
+    if (this != &other) {
+      size_ = other.size_;
+      heapCapacity_ = other.heapCapacity_;
+      heap_ = std::move(other.heap_);
+      if (heap_ == nullptr) {
+        std::memcpy(inline_.data(), other.inline_.data(), size_);
+      }
+      other.size_ = 0;
+      other.heapCapacity_ = 0;
+    }
+    return *this;
+  }
+
+  /// @brief Replace the payload, the heap is used only when the data does not fit inline
+  /// @param data
+  /// @return void
+  /// @note A heap buffer is kept (and reused) once allocated, payloads of a device rarely shrink.
+  void AdvPayload::assign(ByteView data) {
+    size_t size = std::min<size_t>(data.size(), UINT16_MAX);
+    if (heap_ == nullptr && size > kInlineCapacity) {
+      heap_ = std::make_unique<uint8_t[]>(size);
+      heapCapacity_ = static_cast<uint16_t>(size);
+    } else if (heap_ != nullptr && size > heapCapacity_) {
+      heap_ = std::make_unique<uint8_t[]>(size);
+      heapCapacity_ = static_cast<uint16_t>(size);
+    }
+
+    if (size > 0) {
+      std::memmove(heap_ ? heap_.get() : inline_.data(), data.data(), size);
+    }
+    size_ = static_cast<uint16_t>(size);
+  } // assign
+
+  /// @brief Find the entry of a key
+  /// @param key
+  /// @return const_iterator end() if not found
+  template <typename Key>
+  typename AdvSectionMap<Key>::const_iterator AdvSectionMap<Key>::find(const Key& key) const {
+    size_t index = lowerBound(key);
+    if (index < size() && entries()[index].first == key) {
+      return entries() + index;
+    }
+    return end();
+  } // find
+
+  /// @brief Get the payload of a key
+  /// @param key
+  /// @return const AdvPayload* nullptr if not found
+  template <typename Key>
+  const AdvPayload* AdvSectionMap<Key>::get(const Key& key) const {
+    auto it = find(key);
+    return it != end() ? &it->second : nullptr;
+  } // get
+
+  /// @brief Set the payload of a key only if it changed
+  /// @param key
+  /// @param data
+  /// @return bool true if the entry was added or changed
+  template <typename Key>
+  bool AdvSectionMap<Key>::update(const Key& key, ByteView data) {
+    size_t index = lowerBound(key);
+    size_t count = size();
+    value_type* first = entries();
+    if (index < count && first[index].first == key) {
+      auto &payload = first[index].second;
+      if (payload.view() == data) {
+        return false;
+      }
+      payload.assign(data);
+      return true;
+    }
+
+    if (overflow_.empty() && count < kInlineEntries) {
+      // Shift the bigger keys to keep the inline array sorted
+      for (size_t i = count; i > index; i--) {
+        inline_[i] = std::move(inline_[i - 1]);
+      }
+      inline_[index].first = key;
+      inline_[index].second.assign(data);
+      inlineSize_++;
+      return true;
+    }
+
+    if (overflow_.empty()) {
+      // Spill every inline entry to the heap
+      overflow_.reserve(kInlineEntries * 2);
+      for (size_t i = 0; i < inlineSize_; i++) {
+        overflow_.push_back(std::move(inline_[i]));
+      }
+      inlineSize_ = 0;
+    }
+
+    overflow_.insert(overflow_.begin() + index, value_type(key, AdvPayload(data)));
+    return true;
+  } // update
+
+  /// @brief Set the payload of a key
+  /// @param key
+  /// @param data
+  /// @return void
+  template <typename Key>
+  void AdvSectionMap<Key>::insert_or_assign(const Key& key, ByteView data) {
+    update(key, data);
+  } // insert_or_assign
+
+  /// @brief Remove every entry
+  /// @return void
+  template <typename Key>
+  void AdvSectionMap<Key>::clear() {
+    for (size_t i = 0; i < inlineSize_; i++) {
+      inline_[i].second.assign(ByteView());
+    }
+    inlineSize_ = 0;
+    overflow_.clear();
+  } // clear
+
+  /// @brief Get the heap memory held by the map
+  /// @return size_t bytes of the spilled entries and of the payloads that do not fit inline
+  template <typename Key>
+  size_t AdvSectionMap<Key>::heapBytes() const {
+    size_t bytes = overflow_.capacity() * sizeof(value_type);
+    for (const auto& entry : *this) {
+      bytes += entry.second.heapBytes();
+    }
+    return bytes;
+  } // heapBytes
+
+  /// @brief Compare the entries of two maps
+  /// @param other
+  /// @return bool true if both hold the same keys with the same payloads
+  template <typename Key>
+  bool AdvSectionMap<Key>::operator==(const AdvSectionMap& other) const {
+    if (size() != other.size()) {
+      return false;
+    }
+
+    // Both are sorted by key, so the entries are compared pairwise
+    const value_type* mine = entries();
+    const value_type* theirs = other.entries();
+    for (size_t i = 0; i < size(); i++) {
+      if (mine[i].first != theirs[i].first || mine[i].second != theirs[i].second) {
+        return false;
+      }
+    }
+    return true;
+  } // operator==
+
+  /// @brief Get the index of the first entry with a key not lower than the given one
+  /// @param key
+  /// @return size_t
+  template <typename Key>
+  size_t AdvSectionMap<Key>::lowerBound(const Key& key) const {
+    const value_type* first = entries();
+    size_t count = size();
+    size_t index = 0;
+    // Linear scan, the maps hold a handful of entries
+    while (index < count && first[index].first < key) {
+      index++;
+    }
+    return index;
+  } // lowerBound
+
+  template class AdvSectionMap<uint16_t>;
+  template class AdvSectionMap<Uuid128>;
+} // namespace layrz_ble
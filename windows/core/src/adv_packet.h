@@ -0,0 +1,104 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_ADV_PACKET_H__
+#define __LAYRZ_BLE_CORE_ADV_PACKET_H__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "byte_view.h"
+#include "uuid.h"
+
+namespace layrz_ble {
+  /// @brief Payload of a manufacturer or service data section with inline storage
+  /// @note A legacy advertisement is 31 bytes, so after the length, type and company ID there is room for
+  /// at most 27 bytes of data, those never touch the heap. Bigger (extended advertising) payloads spill.
+  class AdvPayload {
+    public:
+      static constexpr size_t kInlineCapacity = 27;
+
+      AdvPayload() = default;
+      explicit AdvPayload(ByteView data);
+      AdvPayload(const AdvPayload& other);
+      AdvPayload(AdvPayload&& other) noexcept;
+      AdvPayload& operator=(const AdvPayload& other);
+      AdvPayload& operator=(AdvPayload&& other) noexcept;
+      ~AdvPayload() = default;
+
+      const uint8_t* data() const { return heap_ ? heap_.get() : inline_.data(); }
+      size_t size() const { return size_; }
+      bool empty() const { return size_ == 0; }
+      bool isInline() const { return heap_ == nullptr; }
+      size_t heapBytes() const { return heapCapacity_; }
+
+      const uint8_t* begin() const { return data(); }
+      const uint8_t* end() const { return data() + size_; }
+
+      ByteView view() const { return ByteView(data(), size_); }
+      std::vector<uint8_t> toVector() const { return std::vector<uint8_t>(begin(), end()); }
+
+      void assign(ByteView data);
+
+      bool operator==(const AdvPayload& other) const { return view() == other.view(); }
+      bool operator!=(const AdvPayload& other) const { return !(*this == other); }
+
+    private:
+      // Left uninitialized on purpose, only the first size_ bytes are ever read
+      std::array<uint8_t, kInlineCapacity> inline_;
+      uint16_t size_ = 0;
+      uint16_t heapCapacity_ = 0;
+      std::unique_ptr<uint8_t[]> heap_;
+  }; // class AdvPayload
+
+  /// @brief Flat map of advertisement sections (company ID or service UUID to payload)
+  /// @note Entries are kept sorted by key in a small inline array, so a device with up to kInlineEntries
+  /// sections per kind needs no allocation at all. Iteration yields pairs, like the std::map it replaces.
+  /// Instantiated for the company IDs (AdvPacketMap) and the service UUIDs (ServiceDataMap) only.
+  template <typename Key>
+  class AdvSectionMap {
+    public:
+      using value_type = std::pair<Key, AdvPayload>;
+      using const_iterator = const value_type*;
+
+      static constexpr size_t kInlineEntries = 2;
+
+      AdvSectionMap() = default;
+
+      const_iterator begin() const { return entries(); }
+      const_iterator end() const { return entries() + size(); }
+      size_t size() const { return overflow_.empty() ? inlineSize_ : overflow_.size(); }
+      bool empty() const { return size() == 0; }
+
+      const_iterator find(const Key& key) const;
+      const AdvPayload* get(const Key& key) const;
+
+      bool update(const Key& key, ByteView data);
+      void insert_or_assign(const Key& key, ByteView data);
+      void clear();
+      size_t heapBytes() const;
+
+      bool operator==(const AdvSectionMap& other) const;
+      bool operator!=(const AdvSectionMap& other) const { return !(*this == other); }
+
+    private:
+      const value_type* entries() const { return overflow_.empty() ? inline_.data() : overflow_.data(); }
+      value_type* entries() { return overflow_.empty() ? inline_.data() : overflow_.data(); }
+      size_t lowerBound(const Key& key) const;
+
+      std::array<value_type, kInlineEntries> inline_{};
+      uint8_t inlineSize_ = 0;
+      std::vector<value_type> overflow_;
+  }; // class AdvSectionMap
+
+  /// @brief Manufacturer data sections, by company ID
+  using AdvPacketMap = AdvSectionMap<uint16_t>;
+
+  /// @brief Service data sections, by full service UUID, so 16, 32 and 128 bits sections never collide
+  using ServiceDataMap = AdvSectionMap<Uuid128>;
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_ADV_PACKET_H__
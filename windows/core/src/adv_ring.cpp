@@ -0,0 +1,275 @@
+#include "adv_ring.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace layrz_ble {
+
+  /// @brief Construct a new ExtendedPayloadPool object
+  /// @param blocks number of blocks of kBlockSize bytes, at least 1
+  ExtendedPayloadPool::ExtendedPayloadPool(size_t blocks) : blocks_(blocks > 0 ? blocks : 1) {
+    storage_ = std::make_unique<uint8_t[]>(blocks_ * kBlockSize);
+  }
+
+  /// @brief Get the number of blocks
+  /// @return size_t
+  size_t ExtendedPayloadPool::Blocks() const {
+    return blocks_;
+  }
+
+  /// @brief Lend the next block
+  /// @return uint8_t* kBlockSize bytes, nullptr if every block is lent (counted)
+  /// @note Producer only
+  uint8_t* ExtendedPayloadPool::acquire() {
+    uint64_t lent = lent_.load(std::memory_order_relaxed);
+    if (lent - returned_.load(std::memory_order_acquire) >= blocks_) {
+      exhausted_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+
+    uint8_t* block = storage_.get() + (lent % blocks_) * kBlockSize;
+    lent_.store(lent + 1, std::memory_order_release);
+    return block;
+  } // acquire
+
+  /// @brief Give back the oldest lent block
+  /// @return void
+  /// @note Consumer only, the blocks must come back in the order they were lent
+  void ExtendedPayloadPool::release() {
+    returned_.store(returned_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  } // release
+
+  /// @brief Get the number of blocks lent and not given back
+  /// @return size_t
+  size_t ExtendedPayloadPool::InUse() const {
+    uint64_t returned = returned_.load(std::memory_order_acquire);
+    uint64_t lent = lent_.load(std::memory_order_acquire);
+    return lent > returned ? static_cast<size_t>(lent - returned) : 0;
+  }
+
+  /// @brief Get the number of blocks lent so far
+  /// @return uint64_t
+  uint64_t ExtendedPayloadPool::Lent() const {
+    return lent_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Get the number of times no block was left
+  /// @return uint64_t
+  uint64_t ExtendedPayloadPool::Exhausted() const {
+    return exhausted_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Clear the record before it is filled again
+  /// @return void
+  /// @note A block lent to a fill that was never committed is kept and reused, so the blocks still come
+  /// back in the order they were lent
+  void RawAdvertisement::reset() {
+    address = 0;
+    timestampUs = 0;
+    rssi = 0;
+    txPower = 0;
+    addressType = kAddressTypePublic;
+    hasTxPower = false;
+    truncated = false;
+    payloadLength = 0;
+    primaryPhy = kPhyUnknown;
+    secondaryPhy = kPhyUnknown;
+    advertisingSid = kAdvertisingSidUnknown;
+  } // reset
+
+  /// @brief Append an AD structure to the payload
+  /// @param type the AD type
+  /// @param data the AD data, without the length and type bytes
+  /// @param length
+  /// @return bool false if the structure does not fit, the record is marked as truncated
+  /// @note Beyond the inline storage the payload moves to a block of the pool, a structure that does not
+  /// fit 1650 bytes or finds no block left is dropped.
+  bool RawAdvertisement::appendSection(uint8_t type, const uint8_t* data, size_t length) {
+    size_t needed = payloadLength + length + 2;
+    if (length == 0 || length > kMaxAdStructureDataLength || needed > kMaxExtendedAdvertisingDataLength) {
+      truncated = true;
+      return false;
+    }
+
+    if (needed > kMaxPayloadLength && extendedPayload == nullptr) {
+      extendedPayload = pool != nullptr ? pool->acquire() : nullptr;
+      if (extendedPayload == nullptr) {
+        truncated = true;
+        return false;
+      }
+      std::memcpy(extendedPayload, payload.data(), payloadLength);
+    }
+
+    uint8_t* out = extendedPayload != nullptr ? extendedPayload : payload.data();
+    out[payloadLength] = static_cast<uint8_t>(length + 1);
+    out[payloadLength + 1] = type;
+    std::memcpy(out + payloadLength + 2, data, length);
+    payloadLength = static_cast<uint16_t>(needed);
+    return true;
+  } // appendSection
+
+  /// @brief Get the payload bytes, inline or in the lent block
+  /// @return const uint8_t* payloadLength bytes
+  const uint8_t* RawAdvertisement::data() const {
+    return extendedPayload != nullptr ? extendedPayload : payload.data();
+  } // data
+
+  /// @brief Get the record as the view the scan engine merges
+  /// @return AdvertisementView valid as long as the record is not reused
+  AdvertisementView RawAdvertisement::view() const {
+    AdvertisementView advertisement;
+    advertisement.address = address;
+    advertisement.addressType = addressType;
+    advertisement.rssi = rssi;
+    if (hasTxPower) {
+      advertisement.txPower = txPower;
+    }
+    advertisement.payload = ByteView(data(), payloadLength);
+    advertisement.timestampUs = timestampUs;
+    advertisement.primaryPhy = primaryPhy;
+    advertisement.secondaryPhy = secondaryPhy;
+    advertisement.advertisingSid = advertisingSid;
+    return advertisement;
+  } // view
+
+  /// @brief Construct a new AdvertisementRing object
+  /// @param capacity the number of slots, rounded up to a power of two
+  /// @param extendedBlocks the number of blocks for the payloads that outgrow a slot
+  AdvertisementRing::AdvertisementRing(size_t capacity, size_t extendedBlocks) : pool_(extendedBlocks) {
+    size_t slots = 2;
+    while (slots < capacity) {
+      slots <<= 1;
+    }
+    mask_ = slots - 1;
+    slots_ = std::make_unique<RawAdvertisement[]>(slots);
+    for (size_t i = 0; i < slots; i++) {
+      slots_[i].pool = &pool_;
+    }
+  }
+
+  /// @brief Get the number of slots
+  /// @return size_t
+  size_t AdvertisementRing::Capacity() const {
+    return mask_ + 1;
+  }
+
+  /// @brief Get the next free slot to fill
+  /// @return RawAdvertisement* nullptr if the ring is full, the advertisement is then counted as an overrun
+  /// @note Producer only. The slot is only visible to the consumer once commitPush() is called, calling
+  /// beginPush() again without committing returns the same slot.
+  RawAdvertisement* AdvertisementRing::beginPush() {
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    if (head - tailCache_ > mask_) {
+      tailCache_ = tail_.load(std::memory_order_acquire);
+      if (head - tailCache_ > mask_) {
+        overruns_.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+      }
+    }
+
+    RawAdvertisement* slot = &slots_[head & mask_];
+    slot->reset();
+    return slot;
+  } // beginPush
+
+  /// @brief Publish the slot returned by the last beginPush()
+  /// @return void
+  /// @note Producer only
+  void AdvertisementRing::commitPush() {
+    head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  } // commitPush
+
+  /// @brief Get the oldest record
+  /// @return const RawAdvertisement* nullptr if the ring is empty
+  /// @note Consumer only, the record stays valid until it is popped
+  const RawAdvertisement* AdvertisementRing::front() const {
+    return available() > 0 ? &at(0) : nullptr;
+  } // front
+
+  /// @brief Get a pending record by its position from the oldest one
+  /// @param offset lower than the last available()
+  /// @return const RawAdvertisement&
+  /// @note Consumer only, not checked, a batch reads available() once and then every record up to it
+  const RawAdvertisement& AdvertisementRing::at(size_t offset) const {
+    return slots_[(tail_.load(std::memory_order_relaxed) + offset) & mask_];
+  } // at
+
+  /// @brief Get the number of records ready to be read
+  /// @return size_t
+  /// @note Consumer only, also records the deepest fill seen
+  size_t AdvertisementRing::available() const {
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    if (headCache_ == tail) {
+      headCache_ = head_.load(std::memory_order_acquire);
+    }
+
+    size_t count = static_cast<size_t>(headCache_ - tail);
+    if (count > highWatermark_.load(std::memory_order_relaxed)) {
+      highWatermark_.store(count, std::memory_order_relaxed);
+    }
+    return count;
+  } // available
+
+  /// @brief Release the oldest records, their slots can be filled again
+  /// @param count clamped to the number of records seen by the last available()
+  /// @return void
+  /// @note Consumer only, the blocks lent to the popped records go back to the pool first
+  void AdvertisementRing::pop(size_t count) {
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    uint64_t popped = std::min<uint64_t>(count, headCache_ - tail);
+    for (uint64_t i = 0; i < popped; i++) {
+      auto &slot = slots_[(tail + i) & mask_];
+      if (slot.extendedPayload != nullptr) {
+        slot.extendedPayload = nullptr;
+        pool_.release();
+      }
+    }
+    tail_.store(tail + popped, std::memory_order_release);
+  } // pop
+
+  /// @brief Get the number of records waiting, from any thread
+  /// @return size_t approximate while both sides are running
+  size_t AdvertisementRing::Depth() const {
+    uint64_t tail = tail_.load(std::memory_order_acquire);
+    uint64_t head = head_.load(std::memory_order_acquire);
+    return head > tail ? static_cast<size_t>(head - tail) : 0;
+  }
+
+  /// @brief Get the deepest fill seen by the consumer
+  /// @return size_t Capacity() means the ring was full at least once
+  size_t AdvertisementRing::HighWatermark() const {
+    return highWatermark_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Get the number of committed records
+  /// @return uint64_t
+  uint64_t AdvertisementRing::Pushed() const {
+    return head_.load(std::memory_order_acquire);
+  }
+
+  /// @brief Get the number of released records
+  /// @return uint64_t
+  uint64_t AdvertisementRing::Popped() const {
+    return tail_.load(std::memory_order_acquire);
+  }
+
+  /// @brief Get the number of advertisements dropped because the ring was full
+  /// @return uint64_t
+  uint64_t AdvertisementRing::Overruns() const {
+    return overruns_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Get the pool of the extended payloads
+  /// @return const ExtendedPayloadPool&
+  const ExtendedPayloadPool& AdvertisementRing::ExtendedPayloads() const {
+    return pool_;
+  }
+
+  /// @brief Reset the overruns and the high watermark
+  /// @return void
+  /// @note Pushed() and Popped() are the ring indexes and keep counting
+  void AdvertisementRing::resetStats() {
+    overruns_.store(0, std::memory_order_relaxed);
+    highWatermark_.store(0, std::memory_order_relaxed);
+  } // resetStats
+} // namespace layrz_ble
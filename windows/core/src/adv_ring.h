@@ -0,0 +1,135 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_ADV_RING_H__
+#define __LAYRZ_BLE_CORE_ADV_RING_H__
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "ad_parser.h"
+#include "byte_view.h"
+#include "scan_engine.h"
+
+namespace layrz_ble {
+  /// @brief Fixed blocks for the extended advertisements that outgrow the inline payload of a ring slot
+  /// @note The blocks are lent by the producer in the order the slots are filled and given back by the
+  /// consumer in the order the slots are popped, so two counters make the whole allocator: no free list,
+  /// no lock, and the storage is allocated once. When every block is lent the advertisement is truncated.
+  class ExtendedPayloadPool {
+    public:
+      static constexpr size_t kBlockSize = kMaxExtendedAdvertisingDataLength;
+      static constexpr size_t kDefaultBlocks = 64;
+
+      explicit ExtendedPayloadPool(size_t blocks = kDefaultBlocks);
+
+      // Disallow copy and assign.
+      ExtendedPayloadPool(const ExtendedPayloadPool &) = delete;
+      ExtendedPayloadPool &operator=(const ExtendedPayloadPool &) = delete;
+
+      size_t Blocks() const;
+
+      // Producer side
+      uint8_t* acquire();
+      // Consumer side, gives back the oldest lent block
+      void release();
+
+      size_t InUse() const;
+      uint64_t Lent() const;
+      uint64_t Exhausted() const;
+
+    private:
+      size_t blocks_;
+      std::unique_ptr<uint8_t[]> storage_;
+
+      alignas(64) std::atomic<uint64_t> lent_{0};
+      std::atomic<uint64_t> exhausted_{0};
+      alignas(64) std::atomic<uint64_t> returned_{0};
+  }; // class ExtendedPayloadPool
+
+  /// @brief A received advertisement copied into a fixed-size record, so it can cross threads without
+  /// any allocation. The payload holds the AD structures flattened back to back, as on the air.
+  /// @note Legacy advertisements (and most extended ones) fit the inline payload, a longer extended
+  /// advertisement moves to a block of the ring ExtendedPayloadPool, up to 1650 bytes.
+  struct RawAdvertisement {
+    static constexpr size_t kMaxPayloadLength = 255;
+
+    uint64_t address = 0;
+    int64_t timestampUs = 0;
+    int16_t rssi = 0;
+    uint16_t txPower = 0;
+    uint8_t addressType = kAddressTypePublic;
+    bool hasTxPower = false;
+    // Set when a section did not fit and was left out
+    bool truncated = false;
+    uint16_t payloadLength = 0;
+    uint8_t primaryPhy = kPhyUnknown;
+    uint8_t secondaryPhy = kPhyUnknown;
+    uint8_t advertisingSid = kAdvertisingSidUnknown;
+    // Set by the ring, extendedPayload is the block lent once the payload outgrew the inline storage
+    ExtendedPayloadPool* pool = nullptr;
+    uint8_t* extendedPayload = nullptr;
+    std::array<uint8_t, kMaxPayloadLength> payload;
+
+    void reset();
+    bool appendSection(uint8_t type, const uint8_t* data, size_t length);
+    const uint8_t* data() const;
+    AdvertisementView view() const;
+  }; // struct RawAdvertisement
+
+  /// @brief Bounded lock-free single producer, single consumer queue of raw advertisements
+  /// @note The producer (the `Received` handler) writes straight into the next free slot with
+  /// beginPush()/commitPush(), the consumer reads the slots in place with front()/pop(), so a record
+  /// is never copied twice. When the ring is full the new advertisement is dropped and counted as an
+  /// overrun, the consumer side is never blocked nor overwritten.
+  /// Exactly one thread may push and one thread may pop at a time.
+  class AdvertisementRing {
+    public:
+      static constexpr size_t kDefaultCapacity = 1024;
+
+      explicit AdvertisementRing(size_t capacity = kDefaultCapacity, size_t extendedBlocks = ExtendedPayloadPool::kDefaultBlocks);
+
+      // Disallow copy and assign.
+      AdvertisementRing(const AdvertisementRing &) = delete;
+      AdvertisementRing &operator=(const AdvertisementRing &) = delete;
+
+      size_t Capacity() const;
+
+      // Producer side
+      RawAdvertisement* beginPush();
+      void commitPush();
+
+      // Consumer side
+      const RawAdvertisement* front() const;
+      const RawAdvertisement& at(size_t offset) const;
+      size_t available() const;
+      void pop(size_t count = 1);
+
+      size_t Depth() const;
+      size_t HighWatermark() const;
+      uint64_t Pushed() const;
+      uint64_t Popped() const;
+      uint64_t Overruns() const;
+      const ExtendedPayloadPool& ExtendedPayloads() const;
+      void resetStats();
+
+    private:
+      ExtendedPayloadPool pool_;
+      size_t mask_;
+      std::unique_ptr<RawAdvertisement[]> slots_;
+
+      // Written by the producer only, each side on its own cache line. Both sides keep the last index
+      // they read from the other one and only read it again when the ring looks full (or empty).
+      alignas(64) std::atomic<uint64_t> head_{0};
+      std::atomic<uint64_t> overruns_{0};
+      uint64_t tailCache_ = 0;
+      // Written by the consumer only
+      alignas(64) std::atomic<uint64_t> tail_{0};
+      mutable std::atomic<size_t> highWatermark_{0};
+      mutable uint64_t headCache_ = 0;
+  }; // class AdvertisementRing
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_ADV_RING_H__
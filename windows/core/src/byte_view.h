@@ -0,0 +1,53 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_BYTE_VIEW_H__
+#define __LAYRZ_BLE_CORE_BYTE_VIEW_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace layrz_ble {
+  /// @brief Non-owning view over a contiguous range of bytes, in the spirit of std::span<const uint8_t>
+  /// @note The plugin is built as C++17, so std::span is not available.
+  class ByteView {
+    public:
+      constexpr ByteView() = default;
+      constexpr ByteView(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+      ByteView(const std::vector<uint8_t>& data) : data_(data.data()), size_(data.size()) {}
+
+      constexpr const uint8_t* data() const { return data_; }
+      constexpr size_t size() const { return size_; }
+      constexpr bool empty() const { return size_ == 0; }
+
+      constexpr const uint8_t* begin() const { return data_; }
+      constexpr const uint8_t* end() const { return data_ + size_; }
+      constexpr uint8_t operator[](size_t index) const { return data_[index]; }
+
+      /// @brief Get a view of a part of this view, clamped to its bounds
+      /// @param offset
+      /// @param count
+      /// @return ByteView
+      constexpr ByteView subview(size_t offset, size_t count = SIZE_MAX) const {
+        if (offset > size_) return ByteView(data_ + size_, 0);
+        size_t available = size_ - offset;
+        return ByteView(data_ + offset, count < available ? count : available);
+      }
+
+      /// @brief Copy the viewed bytes into an owned vector
+      /// @return std::vector<uint8_t>
+      std::vector<uint8_t> toVector() const { return std::vector<uint8_t>(begin(), end()); }
+
+      bool operator==(const ByteView& other) const {
+        return size_ == other.size_ && (size_ == 0 || std::memcmp(data_, other.data_, size_) == 0);
+      }
+      bool operator!=(const ByteView& other) const { return !(*this == other); }
+
+    private:
+      const uint8_t* data_ = nullptr;
+      size_t size_ = 0;
+  }; // class ByteView
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_BYTE_VIEW_H__
@@ -0,0 +1,153 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_CHARACTERISTIC_TABLE_H__
+#define __LAYRZ_BLE_CORE_CHARACTERISTIC_TABLE_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "uuid.h"
+
+namespace layrz_ble {
+  // Never a handle of a CharacteristicTable
+  constexpr int64_t kInvalidCharacteristicHandle = 0;
+
+  /// @brief A characteristic addressed by its service
+  struct CharacteristicKey {
+    Uuid128 service;
+    Uuid128 characteristic;
+
+    bool operator==(const CharacteristicKey& other) const {
+      return service == other.service && characteristic == other.characteristic;
+    }
+  };
+
+  /// @brief Hash of a CharacteristicKey, for the unordered containers
+  struct CharacteristicKeyHash {
+    size_t operator()(const CharacteristicKey& key) const {
+      Uuid128Hash hash;
+      return hash(key.service) ^ (hash(key.characteristic) * 0x9E3779B97F4A7C15ULL);
+    }
+  };
+
+  /// @brief Characteristics of a connection by service and characteristic UUID.
+  /// @note Lookups neither copy nor allocate: the UUIDs are parsed in place (any case, 16, 32 or 128 bits
+  /// form) and the value is returned by pointer. The values live in a deque, so the pointers stay valid
+  /// while characteristics are added, until clear().
+  /// Each characteristic also gets an integer handle, its index tagged with the generation of the table:
+  /// clear() starts a new generation, so a handle from before resolves to nothing rather than to another
+  /// characteristic.
+  template <typename Value>
+  class CharacteristicTable {
+    public:
+      CharacteristicTable() = default;
+
+      // Disallow copy and assign.
+      CharacteristicTable(const CharacteristicTable &) = delete;
+      CharacteristicTable &operator=(const CharacteristicTable &) = delete;
+
+      /// @brief Record a service, known even without characteristics
+      /// @param service
+      /// @return void
+      void addService(const Uuid128& service) {
+        services_.insert(service);
+      }
+
+      /// @brief Add a characteristic, its service is recorded too
+      /// @param service
+      /// @param characteristic
+      /// @param value replaces the value of a characteristic already present
+      /// @return Value& stable until clear()
+      Value& insert(const Uuid128& service, const Uuid128& characteristic, Value value) {
+        services_.insert(service);
+        auto [it, inserted] = indexes_.emplace(CharacteristicKey{service, characteristic}, values_.size());
+        if (!inserted) {
+          values_[it->second] = std::move(value);
+          return values_[it->second];
+        }
+        values_.push_back(std::move(value));
+        return values_.back();
+      }
+
+      /// @brief Check if a service is known
+      /// @param service
+      /// @return bool
+      bool hasService(const Uuid128& service) const {
+        return services_.find(service) != services_.end();
+      }
+
+      /// @brief Get a characteristic
+      /// @param service
+      /// @param characteristic
+      /// @return Value* nullptr if not found
+      Value* find(const Uuid128& service, const Uuid128& characteristic) {
+        auto it = indexes_.find(CharacteristicKey{service, characteristic});
+        return it == indexes_.end() ? nullptr : &values_[it->second];
+      }
+
+      /// @brief Get the handle of a characteristic
+      /// @param service
+      /// @param characteristic
+      /// @return int64_t kInvalidCharacteristicHandle if not found
+      int64_t handleOf(const Uuid128& service, const Uuid128& characteristic) const {
+        auto it = indexes_.find(CharacteristicKey{service, characteristic});
+        if (it == indexes_.end()) {
+          return kInvalidCharacteristicHandle;
+        }
+        return static_cast<int64_t>(static_cast<uint64_t>(generation_) << 32 | it->second);
+      }
+
+      /// @brief Get a characteristic by its handle
+      /// @param handle
+      /// @return Value* nullptr if the handle is not valid or comes from before the last clear()
+      Value* at(int64_t handle) {
+        auto index = static_cast<uint64_t>(handle) & UINT32_MAX;
+        if (static_cast<uint64_t>(handle) >> 32 != generation_ || index >= values_.size()) {
+          return nullptr;
+        }
+        return &values_[index];
+      }
+
+      /// @brief Get a characteristic by the text of its UUIDs
+      /// @param service
+      /// @param characteristic
+      /// @return Value* nullptr if not found or if a UUID is not valid
+      Value* find(std::string_view service, std::string_view characteristic) {
+        Uuid128 serviceUuid;
+        Uuid128 characteristicUuid;
+        if (!Uuid128::parse(service, serviceUuid) || !Uuid128::parse(characteristic, characteristicUuid)) {
+          return nullptr;
+        }
+        return find(serviceUuid, characteristicUuid);
+      }
+
+      /// @brief Get the number of characteristics
+      /// @return size_t
+      size_t size() const {
+        return values_.size();
+      }
+
+      /// @brief Forget every service and characteristic
+      /// @return void
+      void clear() {
+        indexes_.clear();
+        services_.clear();
+        values_.clear();
+        // 31 bits, the handles stay positive
+        generation_ = generation_ == INT32_MAX ? 1 : generation_ + 1;
+      }
+
+    private:
+      std::unordered_map<CharacteristicKey, size_t, CharacteristicKeyHash> indexes_;
+      std::unordered_set<Uuid128, Uuid128Hash> services_;
+      std::deque<Value> values_;
+      uint32_t generation_ = 1;
+  }; // class CharacteristicTable
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_CHARACTERISTIC_TABLE_H__
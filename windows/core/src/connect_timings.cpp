@@ -0,0 +1,50 @@
+#include "connect_timings.h"
+
+#include <cstdio>
+
+namespace layrz_ble {
+
+  /// @brief Get the name of a GATT cache result, as printed in the log
+  /// @param result
+  /// @return const char*
+  const char* gattCacheResultName(GattCacheResult result) {
+    switch (result) {
+      case GattCacheResult::kDisabled:
+        return "disabled";
+      case GattCacheResult::kMiss:
+        return "miss";
+      case GattCacheResult::kHit:
+        return "hit";
+      case GattCacheResult::kStale:
+        return "stale";
+    }
+    return "unknown";
+  } // gattCacheResultName
+
+  /// @brief Format the timings on a single line, as printed in the log
+  /// @return std::string
+  std::string ConnectTimings::format() const {
+    char buffer[256];
+    if (lazy) {
+      std::snprintf(buffer, sizeof(buffer), "total %lld us: resolve %lld us, services discovered on demand",
+        static_cast<long long>(totalUs),
+        static_cast<long long>(resolveUs));
+      return std::string(buffer);
+    }
+
+    std::snprintf(buffer, sizeof(buffer),
+      "total %lld us: resolve %lld us, services %lld us (%zu), characteristics %lld us (%zu, slowest service "
+      "%lld us, %zu in flight, %zu failed), gatt cache %s",
+      static_cast<long long>(totalUs),
+      static_cast<long long>(resolveUs),
+      static_cast<long long>(servicesUs),
+      services,
+      static_cast<long long>(characteristicsUs),
+      characteristics,
+      static_cast<long long>(slowestServiceUs),
+      concurrency,
+      failedServices,
+      gattCacheResultName(gattCache));
+    return std::string(buffer);
+  } // format
+} // namespace layrz_ble
@@ -0,0 +1,52 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_CONNECT_TIMINGS_H__
+#define __LAYRZ_BLE_CORE_CONNECT_TIMINGS_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace layrz_ble {
+  /// @brief How the GATT layout of a connection was obtained
+  enum class GattCacheResult : uint8_t {
+    // No cache directory, discovered from the device
+    kDisabled,
+    // Cache enabled but nothing stored for the device, discovered from the device
+    kMiss,
+    // The cached layout matched what Windows holds for the device, nothing was asked to the device
+    kHit,
+    // The cached layout no longer matched, discovered again from the device
+    kStale,
+  };
+
+  const char* gattCacheResultName(GattCacheResult result);
+
+  /// @brief Time spent by each phase of a connection, in microseconds
+  /// @note The characteristics of the services are discovered concurrently, characteristicsUs is the
+  /// wall time of the whole fan-out and slowestServiceUs the longest wait for a single service.
+  struct ConnectTimings {
+    // BluetoothLEDevice::FromBluetoothAddressAsync
+    int64_t resolveUs = 0;
+    // GetGattServicesAsync
+    int64_t servicesUs = 0;
+    // Every GetCharacteristicsAsync, from the first request to the last result joined
+    int64_t characteristicsUs = 0;
+    int64_t slowestServiceUs = 0;
+    int64_t totalUs = 0;
+
+    size_t services = 0;
+    size_t characteristics = 0;
+    // Services whose characteristics could not be read, they are kept without characteristics
+    size_t failedServices = 0;
+    // Max number of GetCharacteristicsAsync in flight
+    size_t concurrency = 0;
+    GattCacheResult gattCache = GattCacheResult::kDisabled;
+    // Nothing was discovered while connecting, the services are discovered on first use
+    bool lazy = false;
+
+    std::string format() const;
+  };
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_CONNECT_TIMINGS_H__
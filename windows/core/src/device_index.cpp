@@ -0,0 +1,151 @@
+#include "device_index.h"
+
+namespace layrz_ble {
+
+  /// @brief Find the value of a key
+  /// @param key
+  /// @return uint32_t kNotFound if the key is not in the index
+  uint32_t DeviceIndex::find(DeviceKey key) const {
+    if (size_ == 0) {
+      return kNotFound;
+    }
+    return slots_[probe(key)].value;
+  } // find
+
+  /// @brief Add a key
+  /// @param key
+  /// @param value must not be kNotFound
+  /// @return bool false if the key was already in the index, its value is left untouched
+  bool DeviceIndex::insert(DeviceKey key, uint32_t value) {
+    if ((size_ + 1) * 2 > slots_.size()) {
+      rehash(slots_.empty() ? 16 : slots_.size() * 2);
+    }
+
+    auto &slot = slots_[probe(key)];
+    if (slot.value != kNotFound) {
+      return false;
+    }
+
+    slot.key = key;
+    slot.value = value;
+    size_++;
+    return true;
+  } // insert
+
+  /// @brief Replace the value of a key
+  /// @param key
+  /// @param value must not be kNotFound
+  /// @return bool false if the key is not in the index
+  bool DeviceIndex::assign(DeviceKey key, uint32_t value) {
+    if (size_ == 0) {
+      return false;
+    }
+
+    auto &slot = slots_[probe(key)];
+    if (slot.value == kNotFound) {
+      return false;
+    }
+    slot.value = value;
+    return true;
+  } // assign
+
+  /// @brief Remove a key
+  /// @param key
+  /// @return bool false if the key is not in the index
+  bool DeviceIndex::erase(DeviceKey key) {
+    if (size_ == 0) {
+      return false;
+    }
+
+    size_t mask = slots_.size() - 1;
+    size_t hole = probe(key);
+    if (slots_[hole].value == kNotFound) {
+      return false;
+    }
+
+    // Shift back the entries of the probe sequence that would not be reachable across the hole
+    size_t next = hole;
+    while (true) {
+      next = (next + 1) & mask;
+      if (slots_[next].value == kNotFound) {
+        break;
+      }
+
+      size_t home = hash(slots_[next].key) & mask;
+      bool reachable = hole <= next ? (home > hole && home <= next) : (home > hole || home <= next);
+      if (!reachable) {
+        slots_[hole] = slots_[next];
+        hole = next;
+      }
+    }
+
+    slots_[hole] = Slot();
+    size_--;
+    return true;
+  } // erase
+
+  /// @brief Make room for a number of keys without rehashing
+  /// @param count
+  /// @return void
+  void DeviceIndex::reserve(size_t count) {
+    size_t capacity = slots_.empty() ? 16 : slots_.size();
+    while (capacity < count * 2) {
+      capacity *= 2;
+    }
+    if (capacity != slots_.size()) {
+      rehash(capacity);
+    }
+  } // reserve
+
+  /// @brief Remove every key, the table keeps its capacity
+  /// @return void
+  void DeviceIndex::clear() {
+    if (size_ == 0) {
+      return;
+    }
+    for (auto &slot : slots_) {
+      slot = Slot();
+    }
+    size_ = 0;
+  } // clear
+
+  /// @brief Mix the bits of a key, the low bits of the addresses are not random enough on their own
+  /// @param key
+  /// @return size_t
+  size_t DeviceIndex::hash(DeviceKey key) {
+    // Finalizer of MurmurHash3
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    key *= 0xC4CEB9FE1A85EC53ULL;
+    key ^= key >> 33;
+    return static_cast<size_t>(key);
+  } // hash
+
+  /// @brief Get the slot of a key, or the empty slot where it would be inserted
+  /// @param key
+  /// @return size_t
+  /// @note The table is never full, so the probe always ends
+  size_t DeviceIndex::probe(DeviceKey key) const {
+    size_t mask = slots_.size() - 1;
+    size_t index = hash(key) & mask;
+    while (slots_[index].value != kNotFound && slots_[index].key != key) {
+      index = (index + 1) & mask;
+    }
+    return index;
+  } // probe
+
+  /// @brief Move every key to a table of a new capacity
+  /// @param capacity a power of two
+  /// @return void
+  void DeviceIndex::rehash(size_t capacity) {
+    std::vector<Slot> previous(capacity);
+    previous.swap(slots_);
+
+    for (const auto &slot : previous) {
+      if (slot.value != kNotFound) {
+        slots_[probe(slot.key)] = slot;
+      }
+    }
+  } // rehash
+} // namespace layrz_ble
@@ -0,0 +1,73 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_DEVICE_INDEX_H__
+#define __LAYRZ_BLE_CORE_DEVICE_INDEX_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace layrz_ble {
+  /// @brief Identity of a scanned device, the 48 bits address plus the address type above it
+  typedef uint64_t DeviceKey;
+
+  // Address types, same values as the WinRT BluetoothAddressType
+  constexpr uint8_t kAddressTypePublic = 0;
+  constexpr uint8_t kAddressTypeRandom = 1;
+  constexpr uint8_t kAddressTypeUnspecified = 2;
+
+  constexpr uint64_t kBluetoothAddressMask = 0xFFFFFFFFFFFFULL;
+
+  /// @brief Build the key of a device
+  /// @param address the 48 bits Bluetooth address
+  /// @param addressType one of kAddressTypePublic, kAddressTypeRandom or kAddressTypeUnspecified
+  /// @return DeviceKey
+  inline DeviceKey makeDeviceKey(uint64_t address, uint8_t addressType) {
+    return (address & kBluetoothAddressMask) | (static_cast<uint64_t>(addressType) << 48);
+  }
+
+  /// @brief Get the 48 bits Bluetooth address of a key
+  /// @param key
+  /// @return uint64_t
+  inline uint64_t deviceKeyAddress(DeviceKey key) {
+    return key & kBluetoothAddressMask;
+  }
+
+  /// @brief Open addressing hash table from a DeviceKey to a 32 bits value (an index into a dense array)
+  /// @note Linear probing over a power of two table kept at most half full, erase shifts the following
+  /// entries back instead of leaving tombstones, so the lookups never degrade on a long scan with
+  /// rotating addresses. A lookup hashes one integer, no string is built nor compared.
+  class DeviceIndex {
+    public:
+      static constexpr uint32_t kNotFound = UINT32_MAX;
+
+      DeviceIndex() = default;
+
+      uint32_t find(DeviceKey key) const;
+      bool insert(DeviceKey key, uint32_t value);
+      bool assign(DeviceKey key, uint32_t value);
+      bool erase(DeviceKey key);
+
+      size_t size() const { return size_; }
+      bool empty() const { return size_ == 0; }
+      size_t heapBytes() const { return slots_.capacity() * sizeof(Slot); }
+      void reserve(size_t count);
+      void clear();
+
+    private:
+      /// @brief A slot is empty when its value is kNotFound
+      struct Slot {
+        DeviceKey key = 0;
+        uint32_t value = kNotFound;
+      };
+
+      static size_t hash(DeviceKey key);
+      size_t probe(DeviceKey key) const;
+      void rehash(size_t capacity);
+
+      std::vector<Slot> slots_;
+      size_t size_ = 0;
+  }; // class DeviceIndex
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_DEVICE_INDEX_H__
@@ -0,0 +1,355 @@
+#include "gatt_layout.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+#include "string_utils.h"
+
+namespace layrz_ble {
+  namespace {
+    constexpr char kMagic[8] = {'L', 'Z', 'B', 'L', 'E', 'G', 'A', 'T'};
+    constexpr uint16_t kVersion = 1;
+    constexpr size_t kHeaderSize = 16;
+    constexpr char kExtension[] = ".gatt";
+
+    void appendLittleEndian(std::vector<uint8_t>& out, uint64_t value, size_t size) {
+      for (size_t i = 0; i < size; i++) {
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+      }
+    }
+
+    /// @brief Bounds checked little endian reader over the body of a layout
+    class BodyReader {
+      public:
+        explicit BodyReader(ByteView data) : data_(data) {}
+
+        bool read(uint64_t& value, size_t size) {
+          if (offset_ + size > data_.size()) {
+            return false;
+          }
+          value = 0;
+          for (size_t i = 0; i < size; i++) {
+            value |= static_cast<uint64_t>(data_[offset_ + i]) << (8 * i);
+          }
+          offset_ += size;
+          return true;
+        }
+
+        bool read(Uuid128& uuid) {
+          return read(uuid.msb, 8) && read(uuid.lsb, 8);
+        }
+
+        bool atEnd() const { return offset_ == data_.size(); }
+
+      private:
+        ByteView data_;
+        size_t offset_ = 0;
+    }; // class BodyReader
+
+    uint32_t fnv1a(const uint8_t* data, size_t size) {
+      uint32_t hash = 0x811C9DC5u;
+      for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 0x01000193u;
+      }
+      return hash;
+    }
+  } // namespace
+
+  /// @brief Check if two layouts have the same services and characteristics, the Database Hash aside
+  /// @param other
+  /// @return bool
+  bool GattLayout::sameStructure(const GattLayout& other) const {
+    return services == other.services;
+  } // sameStructure
+
+  /// @brief Get the number of characteristics of every service
+  /// @return size_t
+  size_t GattLayout::characteristicCount() const {
+    size_t count = 0;
+    for (const auto &service : services) {
+      count += service.characteristics.size();
+    }
+    return count;
+  } // characteristicCount
+
+  /// @brief Serialize the layout, header included
+  /// @return std::vector<uint8_t>
+  /// @note Services beyond 65535, characteristics beyond 65535 per service and hashes beyond 255 bytes are
+  /// not stored, no real device comes close
+  std::vector<uint8_t> GattLayout::serialize() const {
+    std::vector<uint8_t> out(kHeaderSize, 0);
+    out.reserve(kHeaderSize + 32 + services.size() * 20 + characteristicCount() * 22);
+
+    size_t hashLength = std::min<size_t>(databaseHash.size(), UINT8_MAX);
+    appendLittleEndian(out, address, 8);
+    appendLittleEndian(out, hashLength, 1);
+    out.insert(out.end(), databaseHash.begin(), databaseHash.begin() + hashLength);
+
+    size_t serviceCount = std::min<size_t>(services.size(), UINT16_MAX);
+    appendLittleEndian(out, serviceCount, 2);
+    for (size_t i = 0; i < serviceCount; i++) {
+      const auto &service = services[i];
+      size_t characteristicCount = std::min<size_t>(service.characteristics.size(), UINT16_MAX);
+      appendLittleEndian(out, service.uuid.msb, 8);
+      appendLittleEndian(out, service.uuid.lsb, 8);
+      appendLittleEndian(out, service.handle, 2);
+      appendLittleEndian(out, characteristicCount, 2);
+      for (size_t j = 0; j < characteristicCount; j++) {
+        const auto &characteristic = service.characteristics[j];
+        appendLittleEndian(out, characteristic.uuid.msb, 8);
+        appendLittleEndian(out, characteristic.uuid.lsb, 8);
+        appendLittleEndian(out, characteristic.handle, 2);
+        appendLittleEndian(out, characteristic.properties, 4);
+      }
+    }
+
+    uint32_t checksum = fnv1a(out.data() + kHeaderSize, out.size() - kHeaderSize);
+    std::memcpy(out.data(), kMagic, sizeof(kMagic));
+    out[8] = static_cast<uint8_t>(kVersion);
+    out[9] = static_cast<uint8_t>(kVersion >> 8);
+    out[10] = static_cast<uint8_t>(kHeaderSize);
+    out[11] = 0;
+    for (size_t i = 0; i < 4; i++) {
+      out[12 + i] = static_cast<uint8_t>(checksum >> (8 * i));
+    }
+    return out;
+  } // serialize
+
+  /// @brief Read back a serialized layout
+  /// @param data
+  /// @param layout
+  /// @return bool false if the data is not a layout of this version, is torn or fails its checksum
+  bool GattLayout::deserialize(ByteView data, GattLayout& layout) {
+    if (data.size() < kHeaderSize || std::memcmp(data.data(), kMagic, sizeof(kMagic)) != 0) {
+      return false;
+    }
+
+    uint16_t version = static_cast<uint16_t>(data[8] | (data[9] << 8));
+    uint16_t headerSize = static_cast<uint16_t>(data[10] | (data[11] << 8));
+    if (version != kVersion || headerSize != kHeaderSize) {
+      return false;
+    }
+
+    uint32_t checksum = 0;
+    for (size_t i = 0; i < 4; i++) {
+      checksum |= static_cast<uint32_t>(data[12 + i]) << (8 * i);
+    }
+    if (checksum != fnv1a(data.data() + kHeaderSize, data.size() - kHeaderSize)) {
+      return false;
+    }
+
+    BodyReader reader(data.subview(kHeaderSize));
+    GattLayout parsed;
+    uint64_t value = 0;
+    if (!reader.read(parsed.address, 8) || !reader.read(value, 1)) {
+      return false;
+    }
+
+    parsed.databaseHash.resize(static_cast<size_t>(value));
+    for (auto &byte : parsed.databaseHash) {
+      if (!reader.read(value, 1)) {
+        return false;
+      }
+      byte = static_cast<uint8_t>(value);
+    }
+
+    if (!reader.read(value, 2)) {
+      return false;
+    }
+    parsed.services.resize(static_cast<size_t>(value));
+    for (auto &service : parsed.services) {
+      if (!reader.read(service.uuid) || !reader.read(value, 2)) {
+        return false;
+      }
+      service.handle = static_cast<uint16_t>(value);
+
+      if (!reader.read(value, 2)) {
+        return false;
+      }
+      service.characteristics.resize(static_cast<size_t>(value));
+      for (auto &characteristic : service.characteristics) {
+        if (!reader.read(characteristic.uuid) || !reader.read(value, 2)) {
+          return false;
+        }
+        characteristic.handle = static_cast<uint16_t>(value);
+
+        if (!reader.read(value, 4)) {
+          return false;
+        }
+        characteristic.properties = static_cast<uint32_t>(value);
+      }
+    }
+
+    if (!reader.atEnd()) {
+      return false;
+    }
+    layout = std::move(parsed);
+    return true;
+  } // deserialize
+
+  /// @brief Use a directory for the cache, created if missing
+  /// @param directory
+  /// @param error the reason of the failure, if any
+  /// @return bool false if the directory cannot be created, the cache is then disabled
+  bool GattLayoutCache::open(const std::string& directory, std::string& error) {
+    std::error_code code;
+    std::filesystem::create_directories(std::filesystem::u8path(directory), code);
+    if (code) {
+      error = "Cannot create " + directory + ": " + code.message();
+      close();
+      return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    directory_ = directory;
+    return true;
+  } // open
+
+  /// @brief Disable the cache, the files are kept
+  /// @return void
+  void GattLayoutCache::close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    directory_.clear();
+  } // close
+
+  /// @brief Check if a directory is in use
+  /// @return bool
+  bool GattLayoutCache::isEnabled() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !directory_.empty();
+  }
+
+  /// @brief Get the directory in use
+  /// @return std::string empty when the cache is disabled
+  std::string GattLayoutCache::Directory() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return directory_;
+  }
+
+  /// @brief Get the file of a device, mutex_ held
+  /// @param address
+  /// @return std::string
+  std::string GattLayoutCache::pathOf(uint64_t address) const {
+    std::string name = formatBluetoothAddress(address, true);
+    name.erase(std::remove(name.begin(), name.end(), ':'), name.end());
+    return (std::filesystem::u8path(directory_) / std::filesystem::u8path(name + kExtension)).u8string();
+  } // pathOf
+
+  /// @brief Load the layout of a device
+  /// @param address
+  /// @param layout
+  /// @return bool false if the cache is disabled, the device has no layout or its file is corrupt (then
+  /// deleted)
+  bool GattLayoutCache::load(uint64_t address, GattLayout& layout) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (directory_.empty()) {
+      return false;
+    }
+
+    std::string path = pathOf(address);
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+      stats_.misses++;
+      return false;
+    }
+
+    std::vector<uint8_t> data;
+    uint8_t buffer[4096];
+    size_t read;
+    while ((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+      data.insert(data.end(), buffer, buffer + read);
+    }
+    std::fclose(file);
+
+    GattLayout parsed;
+    if (!GattLayout::deserialize(ByteView(data.data(), data.size()), parsed) || parsed.address != address) {
+      stats_.corrupt++;
+      std::error_code code;
+      std::filesystem::remove(std::filesystem::u8path(path), code);
+      return false;
+    }
+
+    stats_.hits++;
+    layout = std::move(parsed);
+    return true;
+  } // load
+
+  /// @brief Store the layout of a device, replacing the previous one
+  /// @param layout
+  /// @return bool false if the cache is disabled or the file cannot be written
+  bool GattLayoutCache::store(const GattLayout& layout) {
+    auto data = layout.serialize();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (directory_.empty()) {
+      return false;
+    }
+
+    std::string path = pathOf(layout.address);
+    std::string temporary = path + ".tmp";
+    std::FILE* file = std::fopen(temporary.c_str(), "wb");
+    if (file == nullptr) {
+      return false;
+    }
+    bool written = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    written = std::fclose(file) == 0 && written;
+
+    std::error_code code;
+    if (written) {
+      std::filesystem::rename(std::filesystem::u8path(temporary), std::filesystem::u8path(path), code);
+    }
+    if (!written || code) {
+      std::filesystem::remove(std::filesystem::u8path(temporary), code);
+      return false;
+    }
+
+    stats_.stores++;
+    return true;
+  } // store
+
+  /// @brief Forget the layout of a device
+  /// @param address
+  /// @return bool false if the device had no layout
+  bool GattLayoutCache::erase(uint64_t address) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (directory_.empty()) {
+      return false;
+    }
+
+    std::error_code code;
+    if (!std::filesystem::remove(std::filesystem::u8path(pathOf(address)), code)) {
+      return false;
+    }
+    stats_.erased++;
+    return true;
+  } // erase
+
+  /// @brief Forget every layout of the directory
+  /// @return size_t number of layouts deleted
+  size_t GattLayoutCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (directory_.empty()) {
+      return 0;
+    }
+
+    size_t erased = 0;
+    std::error_code code;
+    for (const auto &entry : std::filesystem::directory_iterator(std::filesystem::u8path(directory_), code)) {
+      if (entry.path().extension() == kExtension && std::filesystem::remove(entry.path(), code)) {
+        erased++;
+      }
+    }
+    stats_.erased += erased;
+    return erased;
+  } // clear
+
+  /// @brief Get the counters of the cache
+  /// @return GattLayoutCacheStats
+  GattLayoutCacheStats GattLayoutCache::Stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+} // namespace layrz_ble
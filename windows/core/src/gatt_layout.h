@@ -0,0 +1,107 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_GATT_LAYOUT_H__
+#define __LAYRZ_BLE_CORE_GATT_LAYOUT_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "byte_view.h"
+#include "uuid.h"
+
+namespace layrz_ble {
+  // Generic Attribute service and the characteristics that tell a GATT database changed
+  constexpr uint32_t kGattServiceGenericAttribute = 0x1801;
+  constexpr uint32_t kGattCharacteristicServiceChanged = 0x2A05;
+  constexpr uint32_t kGattCharacteristicDatabaseHash = 0x2B2A;
+
+  /// @brief A characteristic of a GATT database, as cached
+  struct GattCharacteristicLayout {
+    Uuid128 uuid;
+    uint16_t handle = 0;
+    // GattCharacteristicProperties bits
+    uint32_t properties = 0;
+
+    bool operator==(const GattCharacteristicLayout& other) const {
+      return uuid == other.uuid && handle == other.handle && properties == other.properties;
+    }
+    bool operator!=(const GattCharacteristicLayout& other) const { return !(*this == other); }
+  };
+
+  /// @brief A service of a GATT database and its characteristics, in discovery order
+  struct GattServiceLayout {
+    Uuid128 uuid;
+    uint16_t handle = 0;
+    std::vector<GattCharacteristicLayout> characteristics;
+
+    bool operator==(const GattServiceLayout& other) const {
+      return uuid == other.uuid && handle == other.handle && characteristics == other.characteristics;
+    }
+    bool operator!=(const GattServiceLayout& other) const { return !(*this == other); }
+  };
+
+  /// @brief The services, characteristics and properties of a device, without any value
+  /// @note Serialized layout, every integer little endian:
+  ///   - header (16 bytes): magic `LZBLEGAT`, uint16 version, uint16 header size, uint32 FNV-1a of the body
+  ///   - body: uint64 address, uint8 hash length and the Database Hash, uint16 service count, then per
+  ///     service 16 bytes UUID (msb, lsb), uint16 handle, uint16 characteristic count and per
+  ///     characteristic 16 bytes UUID, uint16 handle, uint32 properties
+  struct GattLayout {
+    uint64_t address = 0;
+    std::vector<GattServiceLayout> services;
+    // Value of the Database Hash characteristic when the layout was discovered, empty if the device has none
+    std::vector<uint8_t> databaseHash;
+
+    bool sameStructure(const GattLayout& other) const;
+    size_t characteristicCount() const;
+
+    std::vector<uint8_t> serialize() const;
+    static bool deserialize(ByteView data, GattLayout& layout);
+  };
+
+  /// @brief Counters of the GATT layout cache
+  struct GattLayoutCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    // Files that could not be read back, they are deleted
+    uint64_t corrupt = 0;
+    uint64_t stores = 0;
+    uint64_t erased = 0;
+  };
+
+  /// @brief Directory of GATT layouts, one compact file per device address.
+  /// @note A file is replaced atomically (written aside then renamed), so a crash leaves either the old
+  /// or the new layout. Thread safe.
+  class GattLayoutCache {
+    public:
+      GattLayoutCache() = default;
+
+      // Disallow copy and assign.
+      GattLayoutCache(const GattLayoutCache &) = delete;
+      GattLayoutCache &operator=(const GattLayoutCache &) = delete;
+
+      bool open(const std::string& directory, std::string& error);
+      void close();
+      bool isEnabled() const;
+      std::string Directory() const;
+
+      bool load(uint64_t address, GattLayout& layout);
+      bool store(const GattLayout& layout);
+      bool erase(uint64_t address);
+      size_t clear();
+
+      GattLayoutCacheStats Stats() const;
+
+    private:
+      std::string pathOf(uint64_t address) const;
+
+      mutable std::mutex mutex_;
+      std::string directory_;
+      GattLayoutCacheStats stats_;
+  }; // class GattLayoutCache
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_GATT_LAYOUT_H__
@@ -0,0 +1,190 @@
+#include "identity_index.h"
+#include "string_utils.h"
+
+namespace layrz_ble {
+
+  /// @brief Find the identity of an address
+  /// @param address the 48 bits address, the address type bits are ignored
+  /// @return const DeviceIdentity* nullptr if the classic watcher does not know the address
+  const DeviceIdentity* DeviceIdentityIndex::find(uint64_t address) const {
+    uint32_t index = byAddress_.find(address & kBluetoothAddressMask);
+    return index != DeviceIndex::kNotFound ? &identities_[index] : nullptr;
+  } // find
+
+  /// @brief Find the identity of a DeviceInformation ID
+  /// @param classicId
+  /// @return const DeviceIdentity* nullptr if unknown
+  const DeviceIdentity* DeviceIdentityIndex::findByClassicId(const std::string& classicId) const {
+    auto it = byClassicId_.find(classicId);
+    return it != byClassicId_.end() ? find(it->second) : nullptr;
+  } // findByClassicId
+
+  /// @brief Get the name reported by the classic watcher for an LE advertiser
+  /// @param address the 48 bits address, the address type bits are ignored
+  /// @return const std::string* nullptr if no name is known, valid until the next change of the index
+  const std::string* DeviceIdentityIndex::resolveName(uint64_t address) {
+    const DeviceIdentity* identity = find(address);
+    if (identity == nullptr || !identity->name || identity->name->empty()) {
+      unresolvedNames_++;
+      return nullptr;
+    }
+
+    resolvedNames_++;
+    return &(*identity->name);
+  } // resolveName
+
+  /// @brief Record a device enumerated by the classic watcher
+  /// @param classicId the DeviceInformation ID
+  /// @param address the 48 bits address
+  /// @param name the name, nullptr if not reported
+  /// @param rssi the signal strength, nullptr if not reported
+  /// @return const DeviceIdentity& valid until the next change of the index
+  /// @note A device already known by its ID or by its address is updated in place
+  const DeviceIdentity& DeviceIdentityIndex::addClassic(
+    const std::string& classicId,
+    uint64_t address,
+    const std::string_view* name,
+    const int64_t* rssi
+  ) {
+    address &= kBluetoothAddressMask;
+
+    // The same ID moved to another address, forget the previous one
+    auto previous = byClassicId_.find(classicId);
+    if (previous != byClassicId_.end() && previous->second != address) {
+      removeClassic(classicId);
+    }
+
+    DeviceIdentity* identity = findMutable(address);
+    if (identity == nullptr) {
+      byAddress_.insert(address, static_cast<uint32_t>(identities_.size()));
+      identities_.emplace_back();
+      identity = &identities_.back();
+      identity->address = address;
+    }
+
+    if (identity->classicId != classicId) {
+      if (!identity->classicId.empty()) {
+        byClassicId_.erase(identity->classicId);
+      }
+      identity->classicId = classicId;
+    }
+    byClassicId_.insert_or_assign(classicId, address);
+
+    apply(*identity, name, rssi);
+    return *identity;
+  } // addClassic
+
+  /// @brief Apply the properties changed by an Updated event
+  /// @param classicId the DeviceInformation ID
+  /// @param name the new name, nullptr if unchanged
+  /// @param rssi the new signal strength, nullptr if unchanged
+  /// @return const DeviceIdentity* nullptr if the ID is unknown
+  const DeviceIdentity* DeviceIdentityIndex::updateClassic(
+    const std::string& classicId,
+    const std::string_view* name,
+    const int64_t* rssi
+  ) {
+    auto it = byClassicId_.find(classicId);
+    if (it == byClassicId_.end()) {
+      return nullptr;
+    }
+
+    DeviceIdentity* identity = findMutable(it->second);
+    if (identity == nullptr) {
+      return nullptr;
+    }
+
+    apply(*identity, name, rssi);
+    return identity;
+  } // updateClassic
+
+  /// @brief Forget a device removed by the classic watcher
+  /// @param classicId the DeviceInformation ID
+  /// @return bool false if the ID is unknown
+  bool DeviceIdentityIndex::removeClassic(const std::string& classicId) {
+    auto it = byClassicId_.find(classicId);
+    if (it == byClassicId_.end()) {
+      return false;
+    }
+
+    uint64_t address = it->second;
+    byClassicId_.erase(it);
+
+    uint32_t index = byAddress_.find(address);
+    if (index == DeviceIndex::kNotFound) {
+      return true;
+    }
+
+    // Swap with the last one to keep the array dense
+    byAddress_.erase(address);
+    uint32_t last = static_cast<uint32_t>(identities_.size() - 1);
+    if (index != last) {
+      identities_[index] = std::move(identities_[last]);
+      byAddress_.assign(identities_[index].address, index);
+    }
+    identities_.pop_back();
+    return true;
+  } // removeClassic
+
+  /// @brief Forget every device, before a new scan
+  /// @return void
+  void DeviceIdentityIndex::clear() {
+    identities_.clear();
+    byAddress_.clear();
+    byClassicId_.clear();
+    resolvedNames_ = 0;
+    unresolvedNames_ = 0;
+  } // clear
+
+  /// @brief Get the number of devices known by the classic watcher
+  /// @return size_t
+  size_t DeviceIdentityIndex::size() const {
+    return identities_.size();
+  }
+
+  /// @brief Get the number of LE advertisers named after the classic watcher
+  /// @return uint64_t
+  uint64_t DeviceIdentityIndex::ResolvedNames() const {
+    return resolvedNames_;
+  }
+
+  /// @brief Get the number of name lookups without a known name
+  /// @return uint64_t
+  uint64_t DeviceIdentityIndex::UnresolvedNames() const {
+    return unresolvedNames_;
+  }
+
+  /// @brief Extract the remote address of a DeviceInformation ID
+  /// @param classicId like `Bluetooth#Bluetooth00:1a:7d:da:71:13-a4:c1:38:00:11:22`
+  /// @param address the 48 bits address of the remote device, the last one of the ID
+  /// @return bool false if the ID does not end with an address
+  bool DeviceIdentityIndex::addressFromClassicId(std::string_view classicId, uint64_t& address) {
+    constexpr size_t kAddressLength = 17;
+    if (classicId.size() < kAddressLength) {
+      return false;
+    }
+    return parseBluetoothAddress(classicId.substr(classicId.size() - kAddressLength), address);
+  } // addressFromClassicId
+
+  /// @brief Find the identity of an address, to update it
+  /// @param address the masked 48 bits address
+  /// @return DeviceIdentity* nullptr if unknown
+  DeviceIdentity* DeviceIdentityIndex::findMutable(uint64_t address) {
+    uint32_t index = byAddress_.find(address);
+    return index != DeviceIndex::kNotFound ? &identities_[index] : nullptr;
+  } // findMutable
+
+  /// @brief Copy the reported properties into an identity
+  /// @param identity
+  /// @param name nullptr to keep the current one
+  /// @param rssi nullptr to keep the current one
+  /// @return void
+  void DeviceIdentityIndex::apply(DeviceIdentity& identity, const std::string_view* name, const int64_t* rssi) {
+    if (name != nullptr && !name->empty()) {
+      identity.name = std::string(*name);
+    }
+    if (rssi != nullptr) {
+      identity.rssi = *rssi;
+    }
+  } // apply
+} // namespace layrz_ble
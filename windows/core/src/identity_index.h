@@ -0,0 +1,74 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_IDENTITY_INDEX_H__
+#define __LAYRZ_BLE_CORE_IDENTITY_INDEX_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "device_index.h"
+
+namespace layrz_ble {
+  /// @brief What the classic watcher knows of a device, extracted once from its property bag
+  struct DeviceIdentity {
+    uint64_t address = 0;
+    // DeviceInformation ID, the only key of the Updated and Removed events
+    std::string classicId;
+    std::optional<std::string> name;
+    std::optional<int64_t> rssi;
+  };
+
+  /// @brief Joins the devices enumerated by the classic watcher with the LE advertisers, by address.
+  /// @note The classic watcher identifies a device by its DeviceInformation ID, the LE watcher by its
+  /// Bluetooth address, so a name seen by one was never found by the other. Every identity is stored
+  /// once, indexed by its 48 bits address (address type ignored, the classic watcher does not report it)
+  /// and by its classic ID. The properties are copied out when the watcher reports them, the LE path
+  /// resolves a name with a single integer lookup.
+  /// Not thread safe, the caller serializes the access along with the ScanEngine.
+  class DeviceIdentityIndex {
+    public:
+      DeviceIdentityIndex() = default;
+
+      // Disallow copy and assign.
+      DeviceIdentityIndex(const DeviceIdentityIndex &) = delete;
+      DeviceIdentityIndex &operator=(const DeviceIdentityIndex &) = delete;
+
+      const DeviceIdentity* find(uint64_t address) const;
+      const DeviceIdentity* findByClassicId(const std::string& classicId) const;
+      const std::string* resolveName(uint64_t address);
+
+      const DeviceIdentity& addClassic(
+        const std::string& classicId,
+        uint64_t address,
+        const std::string_view* name,
+        const int64_t* rssi
+      );
+      const DeviceIdentity* updateClassic(const std::string& classicId, const std::string_view* name, const int64_t* rssi);
+      bool removeClassic(const std::string& classicId);
+      void clear();
+
+      size_t size() const;
+      uint64_t ResolvedNames() const;
+      uint64_t UnresolvedNames() const;
+
+      static bool addressFromClassicId(std::string_view classicId, uint64_t& address);
+
+    private:
+      DeviceIdentity* findMutable(uint64_t address);
+      static void apply(DeviceIdentity& identity, const std::string_view* name, const int64_t* rssi);
+
+      std::vector<DeviceIdentity> identities_;
+      DeviceIndex byAddress_;
+      std::unordered_map<std::string, uint64_t> byClassicId_;
+
+      uint64_t resolvedNames_ = 0;
+      uint64_t unresolvedNames_ = 0;
+  }; // class DeviceIdentityIndex
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_IDENTITY_INDEX_H__
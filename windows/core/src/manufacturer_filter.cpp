@@ -0,0 +1,150 @@
+#include "manufacturer_filter.h"
+#include "ad_parser.h"
+
+#include <algorithm>
+
+namespace layrz_ble {
+
+  /// @brief Compile a set of rules, replacing the previous ones and their hit counters
+  /// @param rules an empty list disables the filter
+  /// @return bool false if a rule is invalid (mask and value of different sizes, out of the max length
+  /// of an AD structure) or there are more than kMaxRules, the filter is left untouched then
+  bool ManufacturerDataFilter::compile(const std::vector<ManufacturerDataRule>& rules) {
+    if (rules.size() > kMaxRules) {
+      return false;
+    }
+
+    std::vector<CompiledRule> compiled;
+    std::vector<uint8_t> pool;
+    std::vector<uint32_t> groupIds;
+    std::vector<uint64_t> groups;
+    compiled.reserve(rules.size());
+
+    for (size_t i = 0; i < rules.size(); i++) {
+      const auto &rule = rules[i];
+      // The company ID takes 2 bytes of the structure data
+      if (rule.value.empty() || rule.offset + rule.value.size() > kMaxAdStructureDataLength - 2) {
+        return false;
+      }
+      if (!rule.mask.empty() && rule.mask.size() != rule.value.size()) {
+        return false;
+      }
+
+      CompiledRule entry;
+      entry.companyId = rule.companyId;
+      entry.offset = static_cast<uint8_t>(rule.offset);
+      entry.length = static_cast<uint8_t>(rule.value.size());
+      entry.poolOffset = static_cast<uint32_t>(pool.size());
+      for (size_t j = 0; j < rule.value.size(); j++) {
+        uint8_t mask = rule.mask.empty() ? 0xFF : rule.mask[j];
+        pool.push_back(rule.value[j] & mask);
+      }
+      for (size_t j = 0; j < rule.value.size(); j++) {
+        pool.push_back(rule.mask.empty() ? 0xFF : rule.mask[j]);
+      }
+      compiled.push_back(entry);
+
+      auto group = std::find(groupIds.begin(), groupIds.end(), rule.group);
+      if (group == groupIds.end()) {
+        groupIds.push_back(rule.group);
+        groups.push_back(0);
+        group = groupIds.end() - 1;
+      }
+      groups[group - groupIds.begin()] |= 1ULL << i;
+    }
+
+    rules_ = std::move(compiled);
+    pool_ = std::move(pool);
+    groups_ = std::move(groups);
+    hits_.assign(rules_.size(), 0);
+    return true;
+  } // compile
+
+  /// @brief Check if the filter discards anything
+  /// @return bool
+  bool ManufacturerDataFilter::isEnabled() const {
+    return !rules_.empty();
+  }
+
+  /// @brief Remove every rule, disabling the filter
+  /// @return void
+  void ManufacturerDataFilter::clear() {
+    rules_.clear();
+    pool_.clear();
+    groups_.clear();
+    hits_.clear();
+  }
+
+  /// @brief Get the number of rules
+  /// @return size_t
+  size_t ManufacturerDataFilter::size() const {
+    return rules_.size();
+  }
+
+  /// @brief Check if an advertisement satisfies every rule of at least one group
+  /// @param payload the raw advertisement
+  /// @return bool true when the filter is disabled
+  /// @note A rule is satisfied by any manufacturer data structure of the advertisement
+  bool ManufacturerDataFilter::matches(ByteView payload) {
+    if (rules_.empty()) {
+      return true;
+    }
+
+    uint64_t satisfied = 0;
+    for (const auto& structure : AdStructures(payload)) {
+      uint16_t companyId = 0;
+      ByteView data;
+      if (!parseManufacturerData(structure, companyId, data)) {
+        continue;
+      }
+
+      for (size_t i = 0; i < rules_.size(); i++) {
+        if (!(satisfied & (1ULL << i)) && rules_[i].companyId == companyId && test(rules_[i], data)) {
+          satisfied |= 1ULL << i;
+        }
+      }
+    }
+
+    if (satisfied == 0) {
+      return false;
+    }
+
+    for (size_t i = 0; i < rules_.size(); i++) {
+      if (satisfied & (1ULL << i)) {
+        hits_[i]++;
+      }
+    }
+
+    for (uint64_t group : groups_) {
+      if ((satisfied & group) == group) {
+        return true;
+      }
+    }
+    return false;
+  } // matches
+
+  /// @brief Get the number of advertisements matched by every rule
+  /// @return const std::vector<uint64_t>& in the order of the compiled rules
+  const std::vector<uint64_t>& ManufacturerDataFilter::Hits() const {
+    return hits_;
+  }
+
+  /// @brief Compare the masked bytes of a manufacturer data against a rule
+  /// @param rule
+  /// @param data the bytes after the company ID
+  /// @return bool
+  bool ManufacturerDataFilter::test(const CompiledRule& rule, ByteView data) const {
+    if (static_cast<size_t>(rule.offset) + rule.length > data.size()) {
+      return false;
+    }
+
+    const uint8_t* value = pool_.data() + rule.poolOffset;
+    const uint8_t* mask = value + rule.length;
+    for (size_t i = 0; i < rule.length; i++) {
+      if ((data[rule.offset + i] & mask[i]) != value[i]) {
+        return false;
+      }
+    }
+    return true;
+  } // test
+} // namespace layrz_ble
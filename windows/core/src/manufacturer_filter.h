@@ -0,0 +1,63 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_MANUFACTURER_FILTER_H__
+#define __LAYRZ_BLE_CORE_MANUFACTURER_FILTER_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "byte_view.h"
+
+namespace layrz_ble {
+  /// @brief One manufacturer data condition, as set by the user
+  /// @note The bytes at `offset` of the data (right after the company ID), masked by `mask`, must equal
+  /// `value` masked the same way. An empty mask compares every byte.
+  struct ManufacturerDataRule {
+    uint16_t companyId = 0;
+    size_t offset = 0;
+    std::vector<uint8_t> value;
+    std::vector<uint8_t> mask;
+    uint32_t group = 0;
+  };
+
+  /// @brief Manufacturer data filters compiled into a compact matcher over the raw advertisement
+  /// @note The rules of the same group must all match (AND), any matching group is enough (OR).
+  /// compile() pre-masks the values into a single byte pool, so matching an advertisement walks its AD
+  /// structures once and compares bytes in place, nothing is built nor allocated. Every rule counts the
+  /// advertisements it matched, whatever the outcome of its group.
+  class ManufacturerDataFilter {
+    public:
+      // The satisfied rules of an advertisement are tracked in a single 64 bits mask
+      static constexpr size_t kMaxRules = 64;
+
+      ManufacturerDataFilter() = default;
+
+      bool compile(const std::vector<ManufacturerDataRule>& rules);
+      bool isEnabled() const;
+      void clear();
+      size_t size() const;
+
+      bool matches(ByteView payload);
+      const std::vector<uint64_t>& Hits() const;
+
+    private:
+      /// @brief A rule once compiled, its masked value and its mask live in pool_
+      struct CompiledRule {
+        uint16_t companyId = 0;
+        uint8_t offset = 0;
+        uint8_t length = 0;
+        uint32_t poolOffset = 0;
+      };
+
+      bool test(const CompiledRule& rule, ByteView data) const;
+
+      std::vector<CompiledRule> rules_;
+      std::vector<uint8_t> pool_;
+      // One mask of rule bits per group
+      std::vector<uint64_t> groups_;
+      std::vector<uint64_t> hits_;
+  }; // class ManufacturerDataFilter
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_MANUFACTURER_FILTER_H__
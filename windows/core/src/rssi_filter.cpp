@@ -0,0 +1,146 @@
+#include "rssi_filter.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace layrz_ble {
+
+  /// @brief Get the smoothing settings
+  /// @return const RssiSmoothingConfig&
+  const RssiSmoothingConfig& RssiFilter::Config() const {
+    return config_;
+  }
+
+  /// @brief Replace the smoothing settings
+  /// @param config
+  /// @return bool false if a parameter is out of range, the settings are left untouched then
+  /// @note The state of the devices is kept, a new mode starts from their current estimate
+  bool RssiFilter::setConfig(const RssiSmoothingConfig& config) {
+    if (config.mode == RssiSmoothingMode::kEma && !(config.emaAlpha > 0 && config.emaAlpha <= 1)) {
+      return false;
+    }
+
+    if (config.mode == RssiSmoothingMode::kKalman && !(config.kalmanProcessNoise > 0 && config.kalmanMeasurementNoise > 0)) {
+      return false;
+    }
+
+    if (config.mode == RssiSmoothingMode::kMedian && (config.medianWindow == 0 || config.medianWindow % 2 == 0 ||
+        config.medianWindow > RssiSmoothingConfig::kMaxMedianWindow)) {
+      return false;
+    }
+
+    if (config.minDeltaDbm < 0 || config.maxIntervalUs < 0) {
+      return false;
+    }
+
+    config_ = config;
+    return true;
+  } // setConfig
+
+  /// @brief Check if the samples are smoothed or held back at all
+  /// @return bool
+  bool RssiFilter::isEnabled() const {
+    return config_.mode != RssiSmoothingMode::kNone || config_.minDeltaDbm > 0;
+  }
+
+  /// @brief Feed a raw sample of a device
+  /// @param state the smoothing state of the device
+  /// @param sample the raw RSSI, in dBm
+  /// @param reported the RSSI currently reported for the device, 0 if none yet
+  /// @param nowUs monotonic time of the sample
+  /// @param smoothed the value to report
+  /// @return bool false if the reported RSSI must stay as it is
+  bool RssiFilter::update(RssiFilterState& state, int64_t sample, int64_t reported, int64_t nowUs, int64_t& smoothed) {
+    samples_++;
+    bool first = state.count == 0;
+    smoothed = static_cast<int64_t>(std::lround(smooth(state, sample)));
+
+    if (smoothed == reported) {
+      return false;
+    }
+
+    bool report = first || reported == 0;
+    if (!report) {
+      int64_t delta = smoothed > reported ? smoothed - reported : reported - smoothed;
+      report = delta >= config_.minDeltaDbm || (config_.maxIntervalUs > 0 && nowUs - state.reportedAtUs >= config_.maxIntervalUs);
+    }
+
+    if (report) {
+      state.reportedAtUs = nowUs;
+      reports_++;
+    }
+    return report;
+  } // update
+
+  /// @brief Get the number of samples fed
+  /// @return uint64_t
+  uint64_t RssiFilter::Samples() const {
+    return samples_;
+  }
+
+  /// @brief Get the number of samples that changed the reported RSSI of their device
+  /// @return uint64_t
+  uint64_t RssiFilter::Reports() const {
+    return reports_;
+  }
+
+  /// @brief Add a sample to the state of a device and compute the new estimate
+  /// @param state
+  /// @param sample
+  /// @return float the smoothed RSSI
+  float RssiFilter::smooth(RssiFilterState& state, int64_t sample) const {
+    float value = static_cast<float>(sample);
+
+    // The samples are always recorded, so a switch to the median mode has a history to work with
+    state.samples[state.head] = static_cast<int8_t>(std::clamp<int64_t>(sample, INT8_MIN, INT8_MAX));
+    state.head = static_cast<uint8_t>((state.head + 1) % RssiSmoothingConfig::kMaxMedianWindow);
+    if (state.count < RssiSmoothingConfig::kMaxMedianWindow) {
+      state.count++;
+    }
+
+    if (state.count == 1) {
+      state.estimate = value;
+      state.variance = static_cast<float>(config_.kalmanMeasurementNoise);
+      return state.estimate;
+    }
+
+    switch (config_.mode) {
+      case RssiSmoothingMode::kEma:
+        state.estimate += static_cast<float>(config_.emaAlpha) * (value - state.estimate);
+        break;
+
+      case RssiSmoothingMode::kKalman: {
+        // Constant signal model: predict, then correct with the sample
+        float predicted = state.variance + static_cast<float>(config_.kalmanProcessNoise);
+        float gain = predicted / (predicted + static_cast<float>(config_.kalmanMeasurementNoise));
+        state.estimate += gain * (value - state.estimate);
+        state.variance = (1 - gain) * predicted;
+        break;
+      }
+
+      case RssiSmoothingMode::kMedian:
+        state.estimate = median(state);
+        break;
+
+      default:
+        state.estimate = value;
+        break;
+    }
+    return state.estimate;
+  } // smooth
+
+  /// @brief Median of the last samples of a device
+  /// @param state
+  /// @return float
+  float RssiFilter::median(const RssiFilterState& state) const {
+    size_t count = std::min<size_t>(state.count, config_.medianWindow);
+    int8_t window[RssiSmoothingConfig::kMaxMedianWindow];
+    for (size_t i = 0; i < count; i++) {
+      size_t index = (state.head + RssiSmoothingConfig::kMaxMedianWindow - 1 - i) % RssiSmoothingConfig::kMaxMedianWindow;
+      window[i] = state.samples[index];
+    }
+
+    std::nth_element(window, window + count / 2, window + count);
+    return static_cast<float>(window[count / 2]);
+  } // median
+} // namespace layrz_ble
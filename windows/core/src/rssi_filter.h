@@ -0,0 +1,74 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_RSSI_FILTER_H__
+#define __LAYRZ_BLE_CORE_RSSI_FILTER_H__
+
+#include <cstddef>
+#include <cstdint>
+
+namespace layrz_ble {
+  /// @brief How the raw RSSI samples of a device are smoothed, must match BleRssiSmoothingMode on the Dart side
+  enum class RssiSmoothingMode : uint8_t {
+    kNone = 0,
+    kEma = 1,
+    kKalman = 2,
+    kMedian = 3,
+  };
+
+  /// @brief Smoothing and reporting settings, shared by every device
+  struct RssiSmoothingConfig {
+    static constexpr size_t kMaxMedianWindow = 15;
+
+    RssiSmoothingMode mode = RssiSmoothingMode::kNone;
+    // Weight of the new sample, in (0, 1]
+    double emaAlpha = 0.25;
+    // Variance of the real signal change between samples, and of the measurement noise, in dBm²
+    double kalmanProcessNoise = 0.5;
+    double kalmanMeasurementNoise = 16;
+    // Number of samples of the median, odd and up to kMaxMedianWindow
+    size_t medianWindow = 5;
+
+    // The reported RSSI changes once the smoothed one moved by this much, or once maxIntervalUs elapsed
+    int64_t minDeltaDbm = 0;
+    int64_t maxIntervalUs = 0;
+  };
+
+  /// @brief Smoothing state of a device, kept along with it in the table of visible devices
+  struct RssiFilterState {
+    float estimate = 0;
+    float variance = 0;
+    int8_t samples[RssiSmoothingConfig::kMaxMedianWindow] = {};
+    uint8_t count = 0;
+    uint8_t head = 0;
+    int64_t reportedAtUs = 0;
+  };
+
+  /// @brief Smooths the RSSI samples of the devices and decides when the reported value changes
+  /// @note With the default config every sample is reported as is, like before. Otherwise the reported
+  /// RSSI of a device only moves when the smoothed value drifted by minDeltaDbm or more, or when it drifted
+  /// at all and maxIntervalUs elapsed since the last change. An unchanged RSSI is not sent by the scan
+  /// deltas, so a static device costs no message at all.
+  class RssiFilter {
+    public:
+      RssiFilter() = default;
+
+      const RssiSmoothingConfig& Config() const;
+      bool setConfig(const RssiSmoothingConfig& config);
+      bool isEnabled() const;
+
+      bool update(RssiFilterState& state, int64_t sample, int64_t reported, int64_t nowUs, int64_t& smoothed);
+
+      uint64_t Samples() const;
+      uint64_t Reports() const;
+
+    private:
+      float smooth(RssiFilterState& state, int64_t sample) const;
+      float median(const RssiFilterState& state) const;
+
+      RssiSmoothingConfig config_;
+      uint64_t samples_ = 0;
+      uint64_t reports_ = 0;
+  }; // class RssiFilter
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_RSSI_FILTER_H__
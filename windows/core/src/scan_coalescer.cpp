@@ -0,0 +1,96 @@
+#include "scan_coalescer.h"
+
+namespace layrz_ble {
+
+  /// @brief Construct a new ScanCoalescer object
+  /// @param windowUs the coalescing window in microseconds, 0 disables the coalescing
+  ScanCoalescer::ScanCoalescer(int64_t windowUs) : windowUs_(windowUs > 0 ? windowUs : 0) {}
+
+  /// @brief Get the coalescing window
+  /// @return int64_t microseconds
+  int64_t ScanCoalescer::WindowUs() const {
+    return windowUs_;
+  }
+
+  /// @brief Set the coalescing window
+  /// @param windowUs microseconds, 0 (or less) disables the coalescing
+  /// @return void
+  void ScanCoalescer::setWindowUs(int64_t windowUs) {
+    windowUs_ = windowUs > 0 ? windowUs : 0;
+  }
+
+  /// @brief Check if the scan results are coalesced at all
+  /// @return bool false when every result must be sent right away
+  bool ScanCoalescer::isEnabled() const {
+    return windowUs_ > 0;
+  }
+
+  /// @brief Mark a device as updated
+  /// @param key
+  /// @param nowUs monotonic time of the update, the first update of a batch opens the window
+  /// @return void
+  void ScanCoalescer::add(DeviceKey key, int64_t nowUs) {
+    if (!pendingSet_.insert(key, 0)) {
+      absorbedUpdates_++;
+      return;
+    }
+
+    if (pending_.empty()) {
+      windowStartUs_ = nowUs;
+    }
+    pending_.push_back(key);
+  } // add
+
+  /// @brief Check if the pending batch should be flushed
+  /// @param nowUs monotonic time
+  /// @return bool true if there are pending devices and the window is elapsed
+  bool ScanCoalescer::isDue(int64_t nowUs) const {
+    return !pending_.empty() && nowUs - windowStartUs_ >= windowUs_;
+  } // isDue
+
+  /// @brief Take the pending devices, the coalescer is left empty
+  /// @param keys receives the pending device keys, its previous content is discarded
+  /// @return void
+  /// @note The vectors are swapped, so passing the same vector on every flush recycles the storage
+  void ScanCoalescer::take(std::vector<DeviceKey>& keys) {
+    keys.clear();
+    keys.swap(pending_);
+    pendingSet_.clear();
+
+    if (!keys.empty()) {
+      flushedBatches_++;
+      flushedDevices_ += keys.size();
+    }
+  } // take
+
+  /// @brief Get the number of pending devices
+  /// @return size_t
+  size_t ScanCoalescer::pending() const {
+    return pending_.size();
+  }
+
+  /// @brief Drop the pending devices without flushing them
+  /// @return void
+  void ScanCoalescer::clear() {
+    pending_.clear();
+    pendingSet_.clear();
+  }
+
+  /// @brief Get the number of updates merged into an already pending device
+  /// @return uint64_t messages saved by the coalescing
+  uint64_t ScanCoalescer::AbsorbedUpdates() const {
+    return absorbedUpdates_;
+  }
+
+  /// @brief Get the number of flushed batches
+  /// @return uint64_t
+  uint64_t ScanCoalescer::FlushedBatches() const {
+    return flushedBatches_;
+  }
+
+  /// @brief Get the number of devices sent in the flushed batches
+  /// @return uint64_t
+  uint64_t ScanCoalescer::FlushedDevices() const {
+    return flushedDevices_;
+  }
+} // namespace layrz_ble
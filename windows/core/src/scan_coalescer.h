@@ -0,0 +1,55 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_SCAN_COALESCER_H__
+#define __LAYRZ_BLE_CORE_SCAN_COALESCER_H__
+
+#include <cstdint>
+#include <vector>
+
+#include "device_index.h"
+
+namespace layrz_ble {
+  /// @brief Collects the devices updated during a coalescing window, so the plugin sends one batch of
+  /// scan results per window instead of one platform channel message per advertisement.
+  /// @note Only the device keys are kept, the latest merged state lives in the ScanEngine and is read when
+  /// the batch is flushed. A device updated several times within a window is sent once.
+  /// Not thread safe, the caller serializes the access along with the ScanEngine.
+  class ScanCoalescer {
+    public:
+      static constexpr int64_t kDefaultWindowUs = 100000;
+
+      explicit ScanCoalescer(int64_t windowUs = kDefaultWindowUs);
+
+      // Disallow copy and assign.
+      ScanCoalescer(const ScanCoalescer &) = delete;
+      ScanCoalescer &operator=(const ScanCoalescer &) = delete;
+
+      int64_t WindowUs() const;
+      void setWindowUs(int64_t windowUs);
+      bool isEnabled() const;
+
+      void add(DeviceKey key, int64_t nowUs);
+      bool isDue(int64_t nowUs) const;
+      void take(std::vector<DeviceKey>& keys);
+      size_t pending() const;
+      void clear();
+
+      uint64_t AbsorbedUpdates() const;
+      uint64_t FlushedBatches() const;
+      uint64_t FlushedDevices() const;
+
+    private:
+      int64_t windowUs_;
+      int64_t windowStartUs_ = 0;
+
+      // Insertion order is kept, so the devices are sent in the order they were first updated
+      std::vector<DeviceKey> pending_;
+      DeviceIndex pendingSet_;
+
+      uint64_t absorbedUpdates_ = 0;
+      uint64_t flushedBatches_ = 0;
+      uint64_t flushedDevices_ = 0;
+  }; // class ScanCoalescer
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_SCAN_COALESCER_H__
@@ -0,0 +1,147 @@
+#include "scan_delta.h"
+
+namespace layrz_ble {
+
+  /// @brief Check if the deltas are computed at all
+  /// @return bool false when every emission must be a full snapshot
+  bool ScanDeltaTracker::isEnabled() const {
+    return enabled_;
+  }
+
+  /// @brief Enable or disable the deltas
+  /// @param enabled
+  /// @return void
+  /// @note Disabling drops the snapshots, so the next emissions are full once enabled again
+  void ScanDeltaTracker::setEnabled(bool enabled) {
+    enabled_ = enabled;
+    if (!enabled_) {
+      snapshots_.clear();
+    }
+  }
+
+  /// @brief Compare a device against its last emitted state and remember the new one
+  /// @param device the latest merged state of the device
+  /// @return uint32_t mask of ScanDeltaField, kDeltaNone if nothing changed since the last emission
+  uint32_t ScanDeltaTracker::diff(const BleScanResult& device) {
+    if (!enabled_) {
+      fullSnapshots_++;
+      return kDeltaFullSnapshot | kDeltaAllFields;
+    }
+
+    auto inserted = snapshots_.try_emplace(device.Key());
+    auto &snapshot = inserted.first->second;
+
+    if (inserted.second || snapshot.generation != generation_) {
+      capture(snapshot, device, kDeltaAllFields);
+      snapshot.generation = generation_;
+      fullSnapshots_++;
+      return kDeltaFullSnapshot | kDeltaAllFields;
+    }
+
+    uint32_t fields = kDeltaNone;
+    const std::string* name = device.Name();
+    if (name == nullptr ? snapshot.name.has_value() : (!snapshot.name || *snapshot.name != *name)) {
+      fields |= kDeltaName;
+    }
+    if (snapshot.rssi != device.Rssi()) {
+      fields |= kDeltaRssi;
+    }
+    if (snapshot.txPower != device.TxPower()) {
+      fields |= kDeltaTxPower;
+    }
+    if (snapshot.manufacturerData != *device.ManufacturerData()) {
+      fields |= kDeltaManufacturerData;
+    }
+    if (snapshot.serviceData != *device.ServiceData()) {
+      fields |= kDeltaServiceData;
+    }
+
+    if (fields == kDeltaNone) {
+      unchangedSkips_++;
+    } else if (fields == kDeltaRssi) {
+      rssiOnlyDeltas_++;
+    } else {
+      partialDeltas_++;
+    }
+
+    capture(snapshot, device, fields);
+    return fields;
+  } // diff
+
+  /// @brief Force a full snapshot on the next emission of every known device
+  /// @return void
+  void ScanDeltaTracker::requestResync() {
+    generation_++;
+  }
+
+  /// @brief Drop the snapshot of a device, its next emission will be full
+  /// @param key
+  /// @return void
+  void ScanDeltaTracker::forget(DeviceKey key) {
+    snapshots_.erase(key);
+  }
+
+  /// @brief Get the number of tracked devices
+  /// @return size_t
+  size_t ScanDeltaTracker::size() const {
+    return snapshots_.size();
+  }
+
+  /// @brief Drop every snapshot, like at the start of a new scan
+  /// @return void
+  void ScanDeltaTracker::clear() {
+    snapshots_.clear();
+  }
+
+  /// @brief Get the number of full snapshots emitted
+  /// @return uint64_t
+  uint64_t ScanDeltaTracker::FullSnapshots() const {
+    return fullSnapshots_;
+  }
+
+  /// @brief Get the number of deltas that only carried the RSSI
+  /// @return uint64_t
+  uint64_t ScanDeltaTracker::RssiOnlyDeltas() const {
+    return rssiOnlyDeltas_;
+  }
+
+  /// @brief Get the number of deltas with more than the RSSI
+  /// @return uint64_t
+  uint64_t ScanDeltaTracker::PartialDeltas() const {
+    return partialDeltas_;
+  }
+
+  /// @brief Get the number of emissions skipped because nothing changed
+  /// @return uint64_t
+  uint64_t ScanDeltaTracker::UnchangedSkips() const {
+    return unchangedSkips_;
+  }
+
+  /// @brief Copy the given fields of a device into its snapshot
+  /// @param snapshot
+  /// @param device
+  /// @param fields mask of ScanDeltaField, the payload maps are only copied when they changed
+  /// @return void
+  void ScanDeltaTracker::capture(Snapshot& snapshot, const BleScanResult& device, uint32_t fields) {
+    if (fields & kDeltaName) {
+      const std::string* name = device.Name();
+      if (name == nullptr) {
+        snapshot.name.reset();
+      } else {
+        snapshot.name = *name;
+      }
+    }
+    if (fields & kDeltaRssi) {
+      snapshot.rssi = device.Rssi();
+    }
+    if (fields & kDeltaTxPower) {
+      snapshot.txPower = device.TxPower();
+    }
+    if (fields & kDeltaManufacturerData) {
+      snapshot.manufacturerData = *device.ManufacturerData();
+    }
+    if (fields & kDeltaServiceData) {
+      snapshot.serviceData = *device.ServiceData();
+    }
+  } // capture
+} // namespace layrz_ble
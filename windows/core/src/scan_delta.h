@@ -0,0 +1,78 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_SCAN_DELTA_H__
+#define __LAYRZ_BLE_CORE_SCAN_DELTA_H__
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "scan_result.h"
+
+namespace layrz_ble {
+  /// @brief Fields of a device that changed since the last emission, must match BtDeviceDelta on the Dart side
+  enum ScanDeltaField : uint32_t {
+    kDeltaNone = 0,
+    kDeltaName = 1 << 0,
+    kDeltaRssi = 1 << 1,
+    kDeltaTxPower = 1 << 2,
+    kDeltaManufacturerData = 1 << 3,
+    kDeltaServiceData = 1 << 4,
+    kDeltaAllFields = kDeltaName | kDeltaRssi | kDeltaTxPower | kDeltaManufacturerData | kDeltaServiceData,
+
+    // The receiver must replace its copy of the device instead of patching it
+    kDeltaFullSnapshot = 1 << 5,
+  };
+
+  /// @brief Remembers the last emitted state of every device, so only the changed fields are sent.
+  /// @note The first emission of a device is always a full snapshot, and so is the next emission of every
+  /// device after requestResync(), for when the receiver lost track (hot restart, a missed message...).
+  /// Not thread safe, the caller serializes the access along with the ScanEngine.
+  class ScanDeltaTracker {
+    public:
+      ScanDeltaTracker() = default;
+
+      // Disallow copy and assign.
+      ScanDeltaTracker(const ScanDeltaTracker &) = delete;
+      ScanDeltaTracker &operator=(const ScanDeltaTracker &) = delete;
+
+      bool isEnabled() const;
+      void setEnabled(bool enabled);
+
+      uint32_t diff(const BleScanResult& device);
+      void requestResync();
+      void forget(DeviceKey key);
+      size_t size() const;
+      void clear();
+
+      uint64_t FullSnapshots() const;
+      uint64_t RssiOnlyDeltas() const;
+      uint64_t PartialDeltas() const;
+      uint64_t UnchangedSkips() const;
+
+    private:
+      /// @brief Last emitted state of a device
+      struct Snapshot {
+        uint64_t generation = 0;
+        std::optional<std::string> name;
+        int64_t rssi = 0;
+        uint16_t txPower = 0;
+        AdvPacketType manufacturerData;
+        ServiceDataType serviceData;
+      };
+
+      static void capture(Snapshot& snapshot, const BleScanResult& device, uint32_t fields);
+
+      bool enabled_ = true;
+      uint64_t generation_ = 0;
+      std::unordered_map<DeviceKey, Snapshot> snapshots_;
+
+      uint64_t fullSnapshots_ = 0;
+      uint64_t rssiOnlyDeltas_ = 0;
+      uint64_t partialDeltas_ = 0;
+      uint64_t unchangedSkips_ = 0;
+  }; // class ScanDeltaTracker
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_SCAN_DELTA_H__
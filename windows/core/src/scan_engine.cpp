@@ -0,0 +1,551 @@
+#include "scan_engine.h"
+#include "ad_parser.h"
+#include "string_utils.h"
+
+#include <algorithm>
+#include <vector>
+
+// Heap block of a formatted device ID, 17 chars plus the terminator
+#define MAC_ADDRESS_HEAP_BYTES (size_t)18
+
+namespace layrz_ble {
+
+  /// @brief Get the filtered device ID
+  /// @return const std::string&
+  const std::string& ScanEngine::FilteredDeviceId() const {
+    return filteredDeviceId_;
+  }
+
+  /// @brief Set the device ID to filter the scan results, an empty value disables the filter
+  /// @param deviceId
+  /// @return void
+  /// @note The ID is parsed once here, the results are then filtered by comparing the addresses
+  void ScanEngine::setFilteredDeviceId(std::string_view deviceId) {
+    filteredDeviceId_ = toUppercase(std::string(deviceId));
+
+    uint64_t address = 0;
+    if (parseBluetoothAddress(filteredDeviceId_, address)) {
+      filteredAddress_ = address;
+    } else {
+      filteredAddress_.reset();
+    }
+  }
+
+  /// @brief Get the service UUIDs filter
+  /// @return const ServiceUuidFilter&
+  const ServiceUuidFilter& ScanEngine::ServiceFilter() const {
+    return serviceFilter_;
+  }
+
+  /// @brief Set the service UUIDs filter, an empty filter disables it
+  /// @param filter
+  /// @return void
+  /// @note The devices already visible are kept, the filter applies to the new ones
+  void ScanEngine::setServiceFilter(ServiceUuidFilter filter) {
+    serviceFilter_ = std::move(filter);
+  }
+
+  /// @brief Get the allowlist and denylist of addresses
+  /// @return const AddressFilter&
+  const AddressFilter& ScanEngine::AddressLists() const {
+    return addressLists_;
+  }
+
+  /// @brief Replace the allowlist and denylist of addresses, while the scan runs
+  /// @param filter built by the caller, outside of any lock
+  /// @return size_t number of visible devices evicted because the new lists reject them
+  /// @note The rejected devices go through the eviction handler (EvictionReason::kFiltered), so the
+  /// receiver drops them as well.
+  size_t ScanEngine::setAddressLists(AddressFilter filter) {
+    addressLists_ = std::move(filter);
+
+    size_t evicted = 0;
+    size_t index = 0;
+    while (index < devices_.size()) {
+      if (isFilteredOut(devices_[index].Address())) {
+        // The last device is moved into this slot, check it before moving on
+        evict(index, EvictionReason::kFiltered);
+        evicted++;
+      } else {
+        index++;
+      }
+    }
+    return evicted;
+  } // setAddressLists
+
+  /// @brief Get the manufacturer data filter
+  /// @return const ManufacturerDataFilter&
+  const ManufacturerDataFilter& ScanEngine::ManufacturerFilter() const {
+    return manufacturerFilter_;
+  }
+
+  /// @brief Set the manufacturer data filter, an empty filter disables it
+  /// @param filter already compiled by the caller
+  /// @return void
+  /// @note The devices already visible are kept, the filter applies to the new ones
+  void ScanEngine::setManufacturerFilter(ManufacturerDataFilter filter) {
+    manufacturerFilter_ = std::move(filter);
+  }
+
+  /// @brief Get the RSSI smoothing, its settings and counters
+  /// @return const RssiFilter&
+  const RssiFilter& ScanEngine::RssiSmoothing() const {
+    return rssiFilter_;
+  }
+
+  /// @brief Set how the RSSI samples are smoothed and when the reported RSSI changes
+  /// @param config
+  /// @return bool false if the config is invalid, the previous one is kept then
+  bool ScanEngine::setRssiSmoothing(const RssiSmoothingConfig& config) {
+    return rssiFilter_.setConfig(config);
+  }
+
+  /// @brief Merge a scan result into the visible devices
+  /// @param result the result to merge
+  /// @return const BleScanResult* the merged device, or nullptr if the result was discarded
+  /// @note The returned pointer stays valid until the next insertion or eviction.
+  /// A result without address (like the ones of the classic watcher) is keyed by the address parsed
+  /// from its ID, as a public address. Such a result carries no advertisement to match, so no new device
+  /// is inserted from it while a payload filter (services, manufacturer data) is enabled.
+  const BleScanResult* ScanEngine::merge(const BleScanResult& result) {
+    uint64_t address = result.Address();
+    uint8_t addressType = result.AddressType();
+    if (address == 0) {
+      if (!parseBluetoothAddress(result.DeviceId(), address)) {
+        return nullptr;
+      }
+      addressType = kAddressTypePublic;
+    }
+
+    if (isFilteredOut(address)) {
+      addressFilterDrops_++;
+      return nullptr;
+    }
+
+    auto index = index_.find(makeDeviceKey(address, addressType));
+    if (index == DeviceIndex::kNotFound) {
+      if (hasPayloadFilters()) {
+        if (serviceFilter_.isEnabled()) {
+          serviceFilterDrops_++;
+        } else {
+          manufacturerFilterDrops_++;
+        }
+        return nullptr;
+      }
+
+      BleScanResult device = result;
+      device.setAddress(address);
+      device.setAddressType(addressType);
+      return &insert(std::move(device));
+    }
+
+    // Update the existing device
+    auto &device = devices_[index];
+    if (result.LastSeenUs()) {
+      device.setLastSeenUs(result.LastSeenUs());
+    }
+    if (result.Name()) {
+      device.setName(*result.Name());
+      // The next advertisement must be parsed again, its local name wins over this one
+      device.setPayloadFingerprint(0);
+    }
+
+    if (result.Rssi()) {
+      applyRssi(device, result.Rssi(), result.LastSeenUs() ? result.LastSeenUs() : device.LastSeenUs());
+    }
+
+    for (const auto &serviceData : *result.ServiceData()) {
+      device.updateServiceData(serviceData.first, serviceData.second.view());
+    }
+
+    for (const auto &mfd : *result.ManufacturerData()) {
+      device.updateManufacturerData(mfd.first, mfd.second.view());
+    }
+
+    return &device;
+  } // merge
+
+  /// @brief Merge a raw advertisement into the visible devices
+  /// @param advertisement the advertisement, its payload is parsed in place
+  /// @return const BleScanResult* the merged device, or nullptr if the advertisement was discarded
+  /// @note Unlike merge(), no intermediate BleScanResult is built, the payload sections are compared
+  /// against the stored ones and copied only when they changed. When the payload fingerprint matches the
+  /// last one of the device (static beacons), the payload is not even parsed, only the RSSI, the TX power
+  /// and the last seen time are updated. The RSSI goes through the smoothing, see RssiFilter.
+  /// The device is looked up by its integer key, its string ID is only formatted when it is sent.
+  /// An unknown device is only inserted if the advertisement matches the payload filters, so the
+  /// unrelated devices cost a scan of the payload and nothing else.
+  const BleScanResult* ScanEngine::mergeAdvertisement(const AdvertisementView& advertisement) {
+    if (advertisement.address == 0) {
+      return nullptr;
+    }
+
+    if (isFilteredOut(advertisement.address)) {
+      addressFilterDrops_++;
+      return nullptr;
+    }
+
+    auto index = index_.find(makeDeviceKey(advertisement.address, advertisement.addressType));
+    if (index == DeviceIndex::kNotFound && hasPayloadFilters() && !admits(advertisement.payload)) {
+      return nullptr;
+    }
+
+    auto &device = index != DeviceIndex::kNotFound
+      ? devices_[index]
+      : insert(BleScanResult(advertisement.address, advertisement.addressType));
+    device.setLastSeenUs(advertisement.timestampUs);
+    device.notePayloadLength(advertisement.payload.size());
+    // A device often runs a legacy and an extended advertising set, the extended one is kept
+    if (advertisement.primaryPhy != kPhyUnknown) {
+      device.setPrimaryPhy(advertisement.primaryPhy);
+    }
+    if (advertisement.secondaryPhy != kPhyUnknown) {
+      device.setSecondaryPhy(advertisement.secondaryPhy);
+    }
+    if (advertisement.advertisingSid != kAdvertisingSidUnknown) {
+      device.setAdvertisingSid(advertisement.advertisingSid);
+    }
+
+    uint64_t fingerprint = fingerprintAdvertisement(advertisement.payload);
+    if (fingerprint == device.PayloadFingerprint()) {
+      fingerprintHits_++;
+    } else {
+      fingerprintMisses_++;
+      device.setPayloadFingerprint(fingerprint);
+      applyAdvertisement(device, advertisement);
+    }
+
+    if (advertisement.rssi) {
+      applyRssi(device, advertisement.rssi, advertisement.timestampUs);
+    }
+
+    if (advertisement.txPower) {
+      device.setTxPower(*advertisement.txPower);
+    }
+    return &device;
+  } // mergeAdvertisement
+
+  /// @brief Set the name of a visible device
+  /// @param key
+  /// @param name
+  /// @return const BleScanResult* the updated device, or nullptr if not found
+  const BleScanResult* ScanEngine::updateName(DeviceKey key, std::string_view name) {
+    auto index = index_.find(key);
+    if (index == DeviceIndex::kNotFound) {
+      return nullptr;
+    }
+
+    devices_[index].updateName(name);
+    return &devices_[index];
+  } // updateName
+
+  /// @brief Check if a device is discarded by the device filter or the address lists
+  /// @param address the 48 bits address of the device
+  /// @return bool
+  /// @note A filter that is not an address discards everything, like the string comparison did
+  bool ScanEngine::isFilteredOut(uint64_t address) const {
+    if (!addressLists_.allows(address)) {
+      return true;
+    }
+
+    if (filteredDeviceId_.empty()) {
+      return false;
+    }
+    return !filteredAddress_ || *filteredAddress_ != (address & kBluetoothAddressMask);
+  } // isFilteredOut
+
+  /// @brief Check if a new device must match its advertisement before entering the table
+  /// @return bool
+  bool ScanEngine::hasPayloadFilters() const {
+    return serviceFilter_.isEnabled() || manufacturerFilter_.isEnabled();
+  }
+
+  /// @brief Check the advertisement of a new device against the service and manufacturer data filters
+  /// @param payload the raw advertisement
+  /// @return bool false if a filter rejects it, both must match when both are set
+  bool ScanEngine::admits(ByteView payload) {
+    if (serviceFilter_.isEnabled()) {
+      if (!serviceFilter_.matches(payload)) {
+        serviceFilterDrops_++;
+        return false;
+      }
+      serviceFilterMatches_++;
+    }
+
+    if (!manufacturerFilter_.matches(payload)) {
+      manufacturerFilterDrops_++;
+      return false;
+    }
+    return true;
+  } // admits
+
+  /// @brief Apply the sections of an advertisement to a device
+  /// @param device
+  /// @param advertisement
+  /// @return void
+  void ScanEngine::applyAdvertisement(BleScanResult& device, const AdvertisementView& advertisement) {
+    for (const auto& structure : AdStructures(advertisement.payload)) {
+      uint16_t companyId = 0;
+      Uuid128 serviceUuid;
+      ByteView data;
+      if (parseManufacturerData(structure, companyId, data)) {
+        device.updateManufacturerData(companyId, data);
+      } else if (parseServiceData(structure, serviceUuid, data)) {
+        device.updateServiceData(serviceUuid, data);
+      } else if (isLocalName(structure)) {
+        device.updateName(std::string_view(reinterpret_cast<const char*>(structure.data.data()), structure.data.size()));
+      }
+    }
+  } // applyAdvertisement
+
+  /// @brief Feed a RSSI sample to a device, through the smoothing when it is enabled
+  /// @param device
+  /// @param rssi the raw sample, in dBm
+  /// @param nowUs monotonic time of the sample
+  /// @return void
+  void ScanEngine::applyRssi(BleScanResult& device, int64_t rssi, int64_t nowUs) {
+    if (!rssiFilter_.isEnabled()) {
+      device.setRssi(rssi);
+      return;
+    }
+
+    int64_t smoothed = 0;
+    if (rssiFilter_.update(device.RssiState(), rssi, device.Rssi(), nowUs, smoothed)) {
+      device.setRssi(smoothed);
+    }
+  } // applyRssi
+
+  /// @brief Find a visible device by its key
+  /// @param key
+  /// @return const BleScanResult* the device, or nullptr if not found
+  const BleScanResult* ScanEngine::find(DeviceKey key) const {
+    auto index = index_.find(key);
+    return index != DeviceIndex::kNotFound ? &devices_[index] : nullptr;
+  } // find
+
+  /// @brief Find a visible device by its ID (MAC address), whatever its address type
+  /// @param deviceId
+  /// @return const BleScanResult* the device, or nullptr if not found
+  /// @note Meant for the host API calls (connect), the public address is tried first
+  const BleScanResult* ScanEngine::findByDeviceId(std::string_view deviceId) const {
+    uint64_t address = 0;
+    if (!parseBluetoothAddress(deviceId, address)) {
+      return nullptr;
+    }
+
+    for (uint8_t addressType : {kAddressTypePublic, kAddressTypeRandom, kAddressTypeUnspecified}) {
+      auto device = find(makeDeviceKey(address, addressType));
+      if (device != nullptr) {
+        return device;
+      }
+    }
+    return nullptr;
+  } // findByDeviceId
+
+  /// @brief Get the visible devices
+  /// @return const std::vector<BleScanResult>& in no particular order
+  const std::vector<BleScanResult>& ScanEngine::VisibleDevices() const {
+    return devices_;
+  }
+
+  /// @brief Get the number of visible devices
+  /// @return size_t
+  size_t ScanEngine::size() const {
+    return devices_.size();
+  }
+
+  /// @brief Forget every visible device
+  /// @return void
+  void ScanEngine::clear() {
+    devices_.clear();
+    index_.clear();
+  }
+
+  /// @brief Get the number of advertisements whose payload matched the fingerprint of the device
+  /// @return uint64_t advertisements merged without parsing
+  uint64_t ScanEngine::FingerprintHits() const {
+    return fingerprintHits_;
+  }
+
+  /// @brief Get the number of advertisements that had to be parsed
+  /// @return uint64_t
+  uint64_t ScanEngine::FingerprintMisses() const {
+    return fingerprintMisses_;
+  }
+
+  /// @brief Get the number of new devices admitted by the service filter
+  /// @return uint64_t
+  uint64_t ScanEngine::ServiceFilterMatches() const {
+    return serviceFilterMatches_;
+  }
+
+  /// @brief Get the number of advertisements (and classic results) discarded by the service filter
+  /// @return uint64_t
+  uint64_t ScanEngine::ServiceFilterDrops() const {
+    return serviceFilterDrops_;
+  }
+
+  /// @brief Get the number of advertisements (and classic results) discarded by their address
+  /// @return uint64_t
+  uint64_t ScanEngine::AddressFilterDrops() const {
+    return addressFilterDrops_;
+  }
+
+  /// @brief Get the number of advertisements (and classic results) discarded by the manufacturer data filter
+  /// @return uint64_t
+  uint64_t ScanEngine::ManufacturerFilterDrops() const {
+    return manufacturerFilterDrops_;
+  }
+
+  /// @brief Get the max number of visible devices
+  /// @return size_t 0 if unbounded
+  size_t ScanEngine::MaxDevices() const {
+    return maxDevices_;
+  }
+
+  /// @brief Set the max number of visible devices, the next new device evicts the excess
+  /// @param maxDevices 0 for unbounded
+  /// @return void
+  void ScanEngine::setMaxDevices(size_t maxDevices) {
+    maxDevices_ = maxDevices;
+  }
+
+  /// @brief Get the time after which an unseen device is evicted
+  /// @return int64_t microseconds, 0 if the devices never age
+  int64_t ScanEngine::DeviceTtlUs() const {
+    return deviceTtlUs_;
+  }
+
+  /// @brief Set the time after which an unseen device is evicted
+  /// @param deviceTtlUs microseconds, 0 (or less) disables the aging
+  /// @return void
+  void ScanEngine::setDeviceTtlUs(int64_t deviceTtlUs) {
+    deviceTtlUs_ = deviceTtlUs > 0 ? deviceTtlUs : 0;
+    nextSweepUs_ = 0;
+  }
+
+  /// @brief Set the callback of the evicted devices
+  /// @param handler called right before a device is removed from the table
+  /// @return void
+  void ScanEngine::setEvictionHandler(EvictionHandler handler) {
+    evictionHandler_ = std::move(handler);
+  }
+
+  /// @brief Evict the devices not seen for longer than the TTL
+  /// @param nowUs monotonic time, in the same clock as the advertisement timestamps
+  /// @return size_t number of evicted devices
+  /// @note Cheap to call on every advertisement, the table is swept at most once per kSweepIntervalUs
+  size_t ScanEngine::evictStale(int64_t nowUs) {
+    if (deviceTtlUs_ <= 0 || nowUs < nextSweepUs_) {
+      return 0;
+    }
+    nextSweepUs_ = nowUs + std::min(kSweepIntervalUs, deviceTtlUs_);
+
+    size_t evicted = 0;
+    size_t index = 0;
+    while (index < devices_.size()) {
+      if (nowUs - devices_[index].LastSeenUs() > deviceTtlUs_) {
+        // The last device is moved into this slot, check it before moving on
+        evict(index, EvictionReason::kTtl);
+        evicted++;
+      } else {
+        index++;
+      }
+    }
+    return evicted;
+  } // evictStale
+
+  /// @brief Estimate the memory held by the visible devices
+  /// @return size_t bytes, the allocator overhead is not accounted
+  size_t ScanEngine::ApproximateBytes() const {
+    size_t bytes = devices_.capacity() * sizeof(BleScanResult) + index_.heapBytes();
+
+    auto stringHeap = [](const std::string& value) {
+      // Short strings live inline (SSO), assume the common 15 chars of capacity
+      return value.capacity() > 15 ? value.capacity() + 1 : 0;
+    };
+
+    for (const auto& device : devices_) {
+      // The ID is formatted lazily, count it as if it was (17 chars do not fit inline)
+      bytes += MAC_ADDRESS_HEAP_BYTES;
+      if (device.Name()) {
+        bytes += stringHeap(*device.Name());
+      }
+      bytes += device.ManufacturerData()->heapBytes() + device.ServiceData()->heapBytes();
+    }
+    return bytes;
+  } // ApproximateBytes
+
+  /// @brief Get the number of devices evicted because they were not seen for longer than the TTL
+  /// @return uint64_t
+  uint64_t ScanEngine::EvictedByTtl() const {
+    return evictedByTtl_;
+  }
+
+  /// @brief Get the number of devices evicted to stay within MaxDevices()
+  /// @return uint64_t
+  uint64_t ScanEngine::EvictedByCapacity() const {
+    return evictedByCapacity_;
+  }
+
+  /// @brief Evict the least recently seen devices if the table is full, before a new device is inserted
+  /// @return void
+  /// @note A sixteenth of the table is evicted at once, so a stream of new addresses does not pay a
+  /// full pass over the table for every insertion.
+  void ScanEngine::makeRoom() {
+    if (maxDevices_ == 0 || devices_.size() < maxDevices_) {
+      return;
+    }
+
+    size_t count = devices_.size() - maxDevices_ + std::max<size_t>(1, maxDevices_ / 16);
+    count = std::min(count, devices_.size());
+
+    std::vector<std::pair<int64_t, DeviceKey>> candidates;
+    candidates.reserve(devices_.size());
+    for (const auto& device : devices_) {
+      candidates.emplace_back(device.LastSeenUs(), device.Key());
+    }
+
+    auto byLastSeen = [](const auto& a, const auto& b) { return a.first < b.first; };
+    std::nth_element(candidates.begin(), candidates.begin() + (count - 1), candidates.end(), byLastSeen);
+
+    // The evictions move devices around, so they are found again by key
+    for (size_t i = 0; i < count; i++) {
+      evict(index_.find(candidates[i].second), EvictionReason::kCapacity);
+    }
+  } // makeRoom
+
+  /// @brief Add a new device to the table, evicting the least recently seen ones if it is full
+  /// @param device
+  /// @return BleScanResult& the stored device
+  BleScanResult& ScanEngine::insert(BleScanResult&& device) {
+    makeRoom();
+    index_.insert(device.Key(), static_cast<uint32_t>(devices_.size()));
+    devices_.push_back(std::move(device));
+    return devices_.back();
+  } // insert
+
+  /// @brief Remove a device from the table, notifying the eviction handler
+  /// @param index position of the device in devices_
+  /// @return void
+  /// @note The last device is moved into the freed slot, the array stays dense
+  void ScanEngine::evict(size_t index, EvictionReason reason) {
+    if (reason == EvictionReason::kTtl) {
+      evictedByTtl_++;
+    } else if (reason == EvictionReason::kCapacity) {
+      evictedByCapacity_++;
+    }
+
+    if (evictionHandler_) {
+      evictionHandler_(devices_[index], reason);
+    }
+
+    index_.erase(devices_[index].Key());
+    size_t last = devices_.size() - 1;
+    if (index != last) {
+      devices_[index] = std::move(devices_[last]);
+      index_.assign(devices_[index].Key(), static_cast<uint32_t>(index));
+    }
+    devices_.pop_back();
+  } // evict
+} // namespace layrz_ble
@@ -0,0 +1,142 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_SCAN_ENGINE_H__
+#define __LAYRZ_BLE_CORE_SCAN_ENGINE_H__
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "address_filter.h"
+#include "byte_view.h"
+#include "device_index.h"
+#include "manufacturer_filter.h"
+#include "rssi_filter.h"
+#include "scan_result.h"
+#include "service_filter.h"
+
+namespace layrz_ble {
+  /// @brief A received advertisement, as views over the buffers of the caller
+  struct AdvertisementView {
+    uint64_t address = 0;
+    uint8_t addressType = kAddressTypePublic;
+    int64_t rssi = 0;
+    std::optional<uint16_t> txPower;
+    ByteView payload;
+    int64_t timestampUs = 0;
+    // Bluetooth 5 extended advertising, left unknown by the stacks that do not report them
+    uint8_t primaryPhy = kPhyUnknown;
+    uint8_t secondaryPhy = kPhyUnknown;
+    uint8_t advertisingSid = kAdvertisingSidUnknown;
+  };
+
+  /// @brief Why a device left the table of visible devices
+  enum class EvictionReason {
+    kTtl,
+    kCapacity,
+    kFiltered,
+  };
+
+  /// @brief Merges incoming scan results into the table of visible devices.
+  /// @note This is the platform-neutral part of the scan path, the plugin feeds it with the results
+  /// built from the WinRT watchers and encodes whatever it returns to the Flutter side.
+  /// The devices live in a dense array indexed by their DeviceKey (address plus address type), so the
+  /// advertisement path never formats nor hashes a string.
+  /// The table is bounded: beyond MaxDevices() the least recently seen devices are evicted, and with a
+  /// TTL the devices not seen for that long are evicted by evictStale(). A long scan on a busy site
+  /// (random private addresses rotate every 15 minutes) would grow without bound otherwise.
+  /// The allowlist and denylist of addresses are checked first, on the integer address of the packet.
+  /// With a service or a manufacturer data filter, a device only enters the table once one of its
+  /// advertisements matches, afterwards all of its packets (scan responses included) are merged.
+  class ScanEngine {
+    public:
+      using EvictionHandler = std::function<void(const BleScanResult& device, EvictionReason reason)>;
+
+      static constexpr size_t kDefaultMaxDevices = 2048;
+      static constexpr int64_t kSweepIntervalUs = 1000000;
+
+      ScanEngine() = default;
+
+      // Disallow copy and assign.
+      ScanEngine(const ScanEngine &) = delete;
+      ScanEngine &operator=(const ScanEngine &) = delete;
+
+      const std::string& FilteredDeviceId() const;
+      void setFilteredDeviceId(std::string_view deviceId);
+      const ServiceUuidFilter& ServiceFilter() const;
+      void setServiceFilter(ServiceUuidFilter filter);
+      const AddressFilter& AddressLists() const;
+      size_t setAddressLists(AddressFilter filter);
+      const ManufacturerDataFilter& ManufacturerFilter() const;
+      void setManufacturerFilter(ManufacturerDataFilter filter);
+      const RssiFilter& RssiSmoothing() const;
+      bool setRssiSmoothing(const RssiSmoothingConfig& config);
+
+      const BleScanResult* merge(const BleScanResult& result);
+      const BleScanResult* mergeAdvertisement(const AdvertisementView& advertisement);
+      const BleScanResult* updateName(DeviceKey key, std::string_view name);
+      const BleScanResult* find(DeviceKey key) const;
+      const BleScanResult* findByDeviceId(std::string_view deviceId) const;
+
+      const std::vector<BleScanResult>& VisibleDevices() const;
+      size_t size() const;
+      void clear();
+
+      uint64_t FingerprintHits() const;
+      uint64_t FingerprintMisses() const;
+      uint64_t ServiceFilterMatches() const;
+      uint64_t ServiceFilterDrops() const;
+      uint64_t AddressFilterDrops() const;
+      uint64_t ManufacturerFilterDrops() const;
+
+      size_t MaxDevices() const;
+      void setMaxDevices(size_t maxDevices);
+      int64_t DeviceTtlUs() const;
+      void setDeviceTtlUs(int64_t deviceTtlUs);
+      void setEvictionHandler(EvictionHandler handler);
+
+      size_t evictStale(int64_t nowUs);
+      size_t ApproximateBytes() const;
+      uint64_t EvictedByTtl() const;
+      uint64_t EvictedByCapacity() const;
+
+    private:
+      bool isFilteredOut(uint64_t address) const;
+      bool hasPayloadFilters() const;
+      bool admits(ByteView payload);
+      static void applyAdvertisement(BleScanResult& device, const AdvertisementView& advertisement);
+      void applyRssi(BleScanResult& device, int64_t rssi, int64_t nowUs);
+      BleScanResult& insert(BleScanResult&& device);
+      void makeRoom();
+      void evict(size_t index, EvictionReason reason);
+
+      std::string filteredDeviceId_;
+      std::optional<uint64_t> filteredAddress_;
+      ServiceUuidFilter serviceFilter_;
+      AddressFilter addressLists_;
+      ManufacturerDataFilter manufacturerFilter_;
+      RssiFilter rssiFilter_;
+
+      // Pointers into devices_ are only valid until the next insertion or eviction
+      std::vector<BleScanResult> devices_;
+      DeviceIndex index_;
+
+      uint64_t fingerprintHits_ = 0;
+      uint64_t fingerprintMisses_ = 0;
+      uint64_t serviceFilterMatches_ = 0;
+      uint64_t serviceFilterDrops_ = 0;
+      uint64_t addressFilterDrops_ = 0;
+      uint64_t manufacturerFilterDrops_ = 0;
+
+      size_t maxDevices_ = kDefaultMaxDevices;
+      int64_t deviceTtlUs_ = 0;
+      int64_t nextSweepUs_ = 0;
+      EvictionHandler evictionHandler_;
+      uint64_t evictedByTtl_ = 0;
+      uint64_t evictedByCapacity_ = 0;
+  }; // class ScanEngine
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_SCAN_ENGINE_H__
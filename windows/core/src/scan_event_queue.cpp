@@ -0,0 +1,210 @@
+#include "scan_event_queue.h"
+
+#include <utility>
+
+namespace layrz_ble {
+
+  /// @brief Get the name of a backpressure policy, as printed in the log
+  /// @param policy
+  /// @return const char*
+  const char* backpressurePolicyName(BackpressurePolicy policy) {
+    switch (policy) {
+      case BackpressurePolicy::kDropOldest:
+        return "drop oldest";
+      case BackpressurePolicy::kLatestPerDevice:
+        return "latest per device";
+      case BackpressurePolicy::kPauseWatcher:
+        return "pause watcher";
+    }
+    return "unknown";
+  } // backpressurePolicyName
+
+  /// @brief Construct a new ScanEventQueue object
+  /// @param capacity max number of queued devices, at least 1
+  /// @param policy
+  ScanEventQueue::ScanEventQueue(size_t capacity, BackpressurePolicy policy)
+    : policy_(policy), capacity_(capacity > 0 ? capacity : 1) {}
+
+  /// @brief Get the backpressure policy
+  /// @return BackpressurePolicy
+  BackpressurePolicy ScanEventQueue::Policy() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return policy_;
+  }
+
+  /// @brief Set the backpressure policy
+  /// @param policy
+  /// @return void
+  /// @note Leaving kPauseWatcher resumes the scan right away
+  void ScanEventQueue::setPolicy(BackpressurePolicy policy) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    policy_ = policy;
+    if (policy != BackpressurePolicy::kPauseWatcher) {
+      paused_.store(false, std::memory_order_release);
+    }
+  } // setPolicy
+
+  /// @brief Get the max number of queued devices
+  /// @return size_t
+  size_t ScanEventQueue::Capacity() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return capacity_;
+  }
+
+  /// @brief Set the max number of queued devices
+  /// @param capacity at least 1, the events already queued are kept until the next push
+  /// @return void
+  void ScanEventQueue::setCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = capacity > 0 ? capacity : 1;
+  } // setCapacity
+
+  /// @brief Check if a message of that many devices fits without dropping anything
+  /// @param weight number of devices
+  /// @return bool
+  /// @note An empty queue always has room, so a batch larger than the capacity is never held back forever
+  bool ScanEventQueue::hasRoom(size_t weight) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return depth_ == 0 || depth_ + weight <= capacity_;
+  } // hasRoom
+
+  /// @brief Queue a message for the UI thread
+  /// @param event
+  /// @param dropped receives the events evicted to make room, optional
+  /// @return bool true if the caller must post a drain() to the UI thread
+  bool ScanEventQueue::push(ScanEvent&& event, std::vector<ScanEvent>* dropped) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (!events_.empty() && depth_ + event.weight > capacity_) {
+      auto &oldest = events_.front();
+      depth_ -= oldest.weight;
+      droppedEvents_++;
+      droppedDevices_ += oldest.weight;
+      if (dropped != nullptr) {
+        dropped->push_back(std::move(oldest));
+      }
+      events_.pop_front();
+    }
+
+    depth_ += event.weight;
+    if (depth_ > highWatermark_) {
+      highWatermark_ = depth_;
+    }
+    events_.push_back(std::move(event));
+    queuedEvents_++;
+
+    if (wakePending_) {
+      return false;
+    }
+    wakePending_ = true;
+    return true;
+  } // push
+
+  /// @brief Count a flush held back because the queue is full
+  /// @return void
+  void ScanEventQueue::defer() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    deferredFlushes_++;
+  } // defer
+
+  /// @brief Pause the scan until the UI thread drained the queue
+  /// @return void
+  void ScanEventQueue::pause() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    deferredFlushes_++;
+    if (!paused_.exchange(true, std::memory_order_acq_rel)) {
+      pauses_++;
+    }
+  } // pause
+
+  /// @brief Check, from the advertisement handler, if the advertisement must be discarded
+  /// @return bool true while the scan is paused, the advertisement is counted
+  /// @note Lock free, called for every advertisement
+  bool ScanEventQueue::skipWhilePaused() {
+    if (!paused_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    pausedAdvertisements_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  } // skipWhilePaused
+
+  /// @brief Check if the scan is paused
+  /// @return bool
+  bool ScanEventQueue::isPaused() const {
+    return paused_.load(std::memory_order_acquire);
+  }
+
+  /// @brief Deliver every queued message, on the UI thread
+  /// @return size_t number of messages delivered
+  /// @note The messages queued while delivering are left for the drain posted by their push. The scan
+  /// resumes once the queue is empty.
+  size_t ScanEventQueue::drain() {
+    std::deque<ScanEvent> events;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      events.swap(events_);
+      wakePending_ = false;
+    }
+
+    size_t weight = 0;
+    for (auto &event : events) {
+      weight += event.weight;
+      if (event.deliver) {
+        event.deliver();
+      }
+    }
+    size_t delivered = events.size();
+    events.clear();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    depth_ -= weight;
+    deliveredEvents_ += delivered;
+    if (depth_ == 0) {
+      paused_.store(false, std::memory_order_release);
+    }
+    return delivered;
+  } // drain
+
+  /// @brief Drop every queued message
+  /// @return void
+  void ScanEventQueue::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &event : events_) {
+      depth_ -= event.weight;
+    }
+    events_.clear();
+    paused_.store(false, std::memory_order_release);
+  } // clear
+
+  /// @brief Get the counters of the queue
+  /// @return ScanEventQueueStats
+  ScanEventQueueStats ScanEventQueue::Stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ScanEventQueueStats stats;
+    stats.policy = policy_;
+    stats.capacity = capacity_;
+    stats.depth = depth_;
+    stats.highWatermark = highWatermark_;
+    stats.queuedEvents = queuedEvents_;
+    stats.deliveredEvents = deliveredEvents_;
+    stats.droppedEvents = droppedEvents_;
+    stats.droppedDevices = droppedDevices_;
+    stats.deferredFlushes = deferredFlushes_;
+    stats.pauses = pauses_;
+    stats.pausedAdvertisements = pausedAdvertisements_.load(std::memory_order_relaxed);
+    return stats;
+  } // Stats
+
+  /// @brief Reset the counters, the high watermark restarts from the current depth
+  /// @return void
+  void ScanEventQueue::resetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    highWatermark_ = depth_;
+    queuedEvents_ = 0;
+    deliveredEvents_ = 0;
+    droppedEvents_ = 0;
+    droppedDevices_ = 0;
+    deferredFlushes_ = 0;
+    pauses_ = 0;
+    pausedAdvertisements_.store(0, std::memory_order_relaxed);
+  } // resetStats
+} // namespace layrz_ble
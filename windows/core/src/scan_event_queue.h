@@ -0,0 +1,114 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_SCAN_EVENT_QUEUE_H__
+#define __LAYRZ_BLE_CORE_SCAN_EVENT_QUEUE_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "device_index.h"
+
+namespace layrz_ble {
+  /// @brief What the scan path does when the UI thread does not keep up with the scan events
+  enum class BackpressurePolicy : uint8_t {
+    // Encode and queue anyway, the oldest queued events are dropped to make room
+    kDropOldest,
+    // Hold the devices back in the coalescer, the latest state of each is sent once there is room
+    kLatestPerDevice,
+    // Hold the devices back and discard the advertisements until the UI thread caught up
+    kPauseWatcher,
+  };
+
+  const char* backpressurePolicyName(BackpressurePolicy policy);
+
+  /// @brief A message for the UI thread, built by the scan path
+  struct ScanEvent {
+    // Sends the message, runs on the UI thread
+    std::function<void()> deliver;
+    // Number of devices carried by the message, what the capacity of the queue is counted in
+    size_t weight = 1;
+    // Keys of the devices carried, only needed by the callers that must know what was dropped
+    std::vector<DeviceKey> devices;
+  };
+
+  /// @brief Counters of the scan event queue, readable from any thread
+  struct ScanEventQueueStats {
+    BackpressurePolicy policy = BackpressurePolicy::kLatestPerDevice;
+    size_t capacity = 0;
+    size_t depth = 0;
+    size_t highWatermark = 0;
+    uint64_t queuedEvents = 0;
+    uint64_t deliveredEvents = 0;
+    uint64_t droppedEvents = 0;
+    uint64_t droppedDevices = 0;
+    uint64_t deferredFlushes = 0;
+    uint64_t pauses = 0;
+    uint64_t pausedAdvertisements = 0;
+  };
+
+  /// @brief Bounded queue of the scan events between the scan threads and the UI thread.
+  /// @note The UI thread is woken up once per drain rather than once per message, so a busy UI thread
+  /// never piles up a closure (and a copy of the devices) per message: the pending messages live here,
+  /// counted in devices. Whatever the policy, the queue never holds more than Capacity() devices, a
+  /// message that does not fit evicts the oldest ones (a single message larger than the capacity is
+  /// still accepted into an empty queue). The policies kLatestPerDevice and kPauseWatcher are applied
+  /// by the caller before encoding, see hasRoom(), so the hard bound is only a safety net for them.
+  /// Thread safe, any number of producers and a single consumer (the UI thread).
+  class ScanEventQueue {
+    public:
+      static constexpr size_t kDefaultCapacity = 4096;
+
+      explicit ScanEventQueue(size_t capacity = kDefaultCapacity, BackpressurePolicy policy = BackpressurePolicy::kLatestPerDevice);
+
+      // Disallow copy and assign.
+      ScanEventQueue(const ScanEventQueue &) = delete;
+      ScanEventQueue &operator=(const ScanEventQueue &) = delete;
+
+      BackpressurePolicy Policy() const;
+      void setPolicy(BackpressurePolicy policy);
+      size_t Capacity() const;
+      void setCapacity(size_t capacity);
+
+      // Producer side
+      bool hasRoom(size_t weight) const;
+      bool push(ScanEvent&& event, std::vector<ScanEvent>* dropped = nullptr);
+      void defer();
+      void pause();
+      bool skipWhilePaused();
+      bool isPaused() const;
+
+      // Consumer side
+      size_t drain();
+
+      void clear();
+      ScanEventQueueStats Stats() const;
+      void resetStats();
+
+    private:
+      mutable std::mutex mutex_;
+      std::deque<ScanEvent> events_;
+      BackpressurePolicy policy_;
+      size_t capacity_;
+      // Devices queued plus the ones being delivered, they hold memory until the drain is over
+      size_t depth_ = 0;
+      size_t highWatermark_ = 0;
+      // A drain is posted to the UI thread and did not take the events yet
+      bool wakePending_ = false;
+      std::atomic<bool> paused_{false};
+
+      uint64_t queuedEvents_ = 0;
+      uint64_t deliveredEvents_ = 0;
+      uint64_t droppedEvents_ = 0;
+      uint64_t droppedDevices_ = 0;
+      uint64_t deferredFlushes_ = 0;
+      uint64_t pauses_ = 0;
+      std::atomic<uint64_t> pausedAdvertisements_{0};
+  }; // class ScanEventQueue
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_SCAN_EVENT_QUEUE_H__
@@ -0,0 +1,158 @@
+#include "scan_ingest.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace layrz_ble {
+
+  /// @brief Construct a new ScanIngestWorker object, the thread is started by start()
+  /// @param capacity the number of ring slots, rounded up to a power of two
+  /// @param maxBatch the most advertisements handed to the handler at once
+  ScanIngestWorker::ScanIngestWorker(size_t capacity, size_t maxBatch)
+    : ring_(capacity), maxBatch_(std::max<size_t>(maxBatch, 1)) {
+    batch_.reserve(maxBatch_);
+  }
+
+  /// @brief Destroy the ScanIngestWorker object, the pending advertisements are processed first
+  ScanIngestWorker::~ScanIngestWorker() {
+    stop();
+  }
+
+  /// @brief Start the worker thread
+  /// @param handler called on the worker thread with every batch, the views are valid during the call only
+  /// @return void
+  /// @note Does nothing if the worker is already running
+  void ScanIngestWorker::start(BatchHandler handler) {
+    if (running_.load(std::memory_order_acquire)) {
+      return;
+    }
+
+    handler_ = std::move(handler);
+    running_.store(true, std::memory_order_release);
+    thread_ = std::thread(&ScanIngestWorker::run, this);
+  } // start
+
+  /// @brief Stop the worker thread once the ring is drained
+  /// @return void
+  /// @note The producer must be stopped first, advertisements pushed afterwards wait for the next start()
+  void ScanIngestWorker::stop() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) {
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(wakeMutex_);
+      wake_.notify_one();
+    }
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  } // stop
+
+  /// @brief Check if the worker thread is running
+  /// @return bool
+  bool ScanIngestWorker::isRunning() const {
+    return running_.load(std::memory_order_acquire);
+  }
+
+  /// @brief Get the ring slot to fill with the next advertisement
+  /// @return RawAdvertisement* nullptr if the ring is full, the advertisement must be dropped
+  /// @note Called by the single producer only
+  RawAdvertisement* ScanIngestWorker::beginPush() {
+    return ring_.beginPush();
+  } // beginPush
+
+  /// @brief Publish the filled slot and wake up the worker if it sleeps
+  /// @return void
+  void ScanIngestWorker::commitPush() {
+    ring_.commitPush();
+
+    // Pairs with the fence of run(), either the worker sees the record or the producer sees it asleep
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping_.load(std::memory_order_relaxed)) {
+      std::lock_guard<std::mutex> lock(wakeMutex_);
+      wake_.notify_one();
+    }
+  } // commitPush
+
+  /// @brief Get the counters of the ingest path
+  /// @return ScanIngestStats
+  ScanIngestStats ScanIngestWorker::Stats() const {
+    ScanIngestStats stats;
+    stats.capacity = ring_.Capacity();
+    stats.depth = ring_.Depth();
+    stats.highWatermark = ring_.HighWatermark();
+    stats.pushed = ring_.Pushed();
+    stats.processed = processed_.load(std::memory_order_relaxed);
+    stats.overruns = ring_.Overruns();
+    stats.truncated = truncated_.load(std::memory_order_relaxed);
+    stats.extended = extended_.load(std::memory_order_relaxed);
+    stats.batches = batches_.load(std::memory_order_relaxed);
+    return stats;
+  } // Stats
+
+  /// @brief Reset the counters, between two scans
+  /// @return void
+  /// @note pushed keeps counting, it is the write index of the ring
+  void ScanIngestWorker::resetStats() {
+    ring_.resetStats();
+    processed_.store(0, std::memory_order_relaxed);
+    truncated_.store(0, std::memory_order_relaxed);
+    extended_.store(0, std::memory_order_relaxed);
+    batches_.store(0, std::memory_order_relaxed);
+  } // resetStats
+
+  /// @brief Body of the worker thread
+  /// @return void
+  void ScanIngestWorker::run() {
+    while (true) {
+      if (drain() > 0) {
+        continue;
+      }
+
+      if (!running_.load(std::memory_order_acquire)) {
+        // Stopped and drained
+        break;
+      }
+
+      std::unique_lock<std::mutex> lock(wakeMutex_);
+      sleeping_.store(true, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (ring_.available() == 0 && running_.load(std::memory_order_acquire)) {
+        // The timeout is only a safety net, commitPush() wakes the worker up
+        wake_.wait_for(lock, std::chrono::microseconds(kIdleWaitUs));
+      }
+      sleeping_.store(false, std::memory_order_relaxed);
+    }
+  } // run
+
+  /// @brief Hand the next batch of pending advertisements to the handler
+  /// @return size_t the number of advertisements processed, 0 if the ring was empty
+  size_t ScanIngestWorker::drain() {
+    size_t count = std::min(ring_.available(), maxBatch_);
+    if (count == 0) {
+      return 0;
+    }
+
+    batch_.clear();
+    uint64_t truncated = 0;
+    uint64_t extended = 0;
+    for (size_t i = 0; i < count; i++) {
+      const RawAdvertisement& record = ring_.at(i);
+      truncated += record.truncated ? 1 : 0;
+      extended += record.payloadLength > kLegacyAdvertisingDataLength ? 1 : 0;
+      batch_.push_back(record.view());
+    }
+
+    if (handler_) {
+      handler_(batch_);
+    }
+    ring_.pop(count);
+
+    processed_.fetch_add(count, std::memory_order_relaxed);
+    truncated_.fetch_add(truncated, std::memory_order_relaxed);
+    extended_.fetch_add(extended, std::memory_order_relaxed);
+    batches_.fetch_add(1, std::memory_order_relaxed);
+    return count;
+  } // drain
+} // namespace layrz_ble
@@ -0,0 +1,87 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_SCAN_INGEST_H__
+#define __LAYRZ_BLE_CORE_SCAN_INGEST_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "adv_ring.h"
+#include "scan_engine.h"
+
+namespace layrz_ble {
+  /// @brief Counters of the ingest path, readable from any thread
+  struct ScanIngestStats {
+    size_t capacity = 0;
+    size_t depth = 0;
+    size_t highWatermark = 0;
+    uint64_t pushed = 0;
+    uint64_t processed = 0;
+    uint64_t overruns = 0;
+    uint64_t truncated = 0;
+    // Longer than a legacy advertisement
+    uint64_t extended = 0;
+    uint64_t batches = 0;
+  };
+
+  /// @brief Moves the merge of the advertisements off the threads that receive them.
+  /// @note The `Received` handler only copies the advertisement into an AdvertisementRing slot, a
+  /// dedicated worker thread drains the ring in batches and hands every batch to the handler, which
+  /// merges it under a single lock. The radio callback never waits on the merge, the emission nor the
+  /// scan mutex, and a burst is absorbed by the ring (or counted as overruns) instead of piling up
+  /// thread-pool threads.
+  /// The worker sleeps on a condition variable while the ring is empty, the producer only takes the
+  /// mutex to wake it up.
+  class ScanIngestWorker {
+    public:
+      using BatchHandler = std::function<void(const std::vector<AdvertisementView>& batch)>;
+
+      static constexpr size_t kDefaultMaxBatch = 64;
+      static constexpr int64_t kIdleWaitUs = 50000;
+
+      explicit ScanIngestWorker(size_t capacity = AdvertisementRing::kDefaultCapacity, size_t maxBatch = kDefaultMaxBatch);
+      ~ScanIngestWorker();
+
+      // Disallow copy and assign.
+      ScanIngestWorker(const ScanIngestWorker &) = delete;
+      ScanIngestWorker &operator=(const ScanIngestWorker &) = delete;
+
+      void start(BatchHandler handler);
+      void stop();
+      bool isRunning() const;
+
+      RawAdvertisement* beginPush();
+      void commitPush();
+
+      ScanIngestStats Stats() const;
+      void resetStats();
+
+    private:
+      void run();
+      size_t drain();
+
+      AdvertisementRing ring_;
+      size_t maxBatch_;
+      BatchHandler handler_;
+      std::vector<AdvertisementView> batch_;
+
+      std::thread thread_;
+      std::atomic<bool> running_{false};
+      std::atomic<bool> sleeping_{false};
+      std::mutex wakeMutex_;
+      std::condition_variable wake_;
+
+      std::atomic<uint64_t> processed_{0};
+      std::atomic<uint64_t> truncated_{0};
+      std::atomic<uint64_t> extended_{0};
+      std::atomic<uint64_t> batches_{0};
+  }; // class ScanIngestWorker
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_SCAN_INGEST_H__
@@ -0,0 +1,209 @@
+#include "scan_metrics.h"
+
+#include <cstdio>
+
+namespace layrz_ble {
+
+  /// @brief Get the name of a scan stage, as printed in the log
+  /// @param stage
+  /// @return const char*
+  const char* scanStageName(ScanStage stage) {
+    switch (stage) {
+      case ScanStage::kReceived:
+        return "received";
+      case ScanStage::kDropped:
+        return "dropped";
+      case ScanStage::kFiltered:
+        return "filtered";
+      case ScanStage::kDuplicate:
+        return "duplicates";
+      case ScanStage::kMerged:
+        return "merged";
+      case ScanStage::kCoalesced:
+        return "coalesced";
+      case ScanStage::kEncoded:
+        return "encoded";
+      case ScanStage::kPosted:
+        return "posted";
+    }
+    return "unknown";
+  } // scanStageName
+
+  /// @brief Record a latency
+  /// @param latencyUs microseconds, negative values (clock skew) count as 0
+  /// @return void
+  void LatencyHistogram::record(int64_t latencyUs) {
+    if (latencyUs < 0) latencyUs = 0;
+
+    buckets_[bucketOf(latencyUs)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sumUs_.fetch_add(latencyUs, std::memory_order_relaxed);
+
+    int64_t max = maxUs_.load(std::memory_order_relaxed);
+    while (latencyUs > max && !maxUs_.compare_exchange_weak(max, latencyUs, std::memory_order_relaxed)) {
+    }
+  } // record
+
+  /// @brief Clear the recorded latencies
+  /// @return void
+  void LatencyHistogram::reset() {
+    for (auto &bucket : buckets_) {
+      bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sumUs_.store(0, std::memory_order_relaxed);
+    maxUs_.store(0, std::memory_order_relaxed);
+  } // reset
+
+  /// @brief Get the number of recorded latencies
+  /// @return uint64_t
+  uint64_t LatencyHistogram::Count() const {
+    return count_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Get the number of latencies recorded in a bucket
+  /// @param index below kBucketCount
+  /// @return uint64_t
+  uint64_t LatencyHistogram::Bucket(size_t index) const {
+    return index < kBucketCount ? buckets_[index].load(std::memory_order_relaxed) : 0;
+  }
+
+  /// @brief Get the highest recorded latency
+  /// @return int64_t microseconds
+  int64_t LatencyHistogram::MaxUs() const {
+    return maxUs_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Get the sum of the recorded latencies, for the mean
+  /// @return int64_t microseconds
+  int64_t LatencyHistogram::SumUs() const {
+    return sumUs_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Estimate a percentile of the recorded latencies
+  /// @param rank between 0 and 1, 0.99 for the p99
+  /// @return int64_t the upper bound of the bucket holding the percentile (capped by the max), 0 when empty
+  /// @note The estimation is within a factor of two, which is what matters to tell a 2 ms lag from a 200 ms one
+  int64_t LatencyHistogram::percentileUs(double rank) const {
+    uint64_t total = 0;
+    std::array<uint64_t, kBucketCount> counts;
+    for (size_t i = 0; i < kBucketCount; i++) {
+      counts[i] = buckets_[i].load(std::memory_order_relaxed);
+      total += counts[i];
+    }
+    if (total == 0) {
+      return 0;
+    }
+
+    if (rank < 0) rank = 0;
+    if (rank > 1) rank = 1;
+    auto target = static_cast<uint64_t>(rank * static_cast<double>(total));
+    if (target == 0) target = 1;
+
+    int64_t max = MaxUs();
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; i++) {
+      seen += counts[i];
+      if (seen >= target) {
+        int64_t upper = BucketUpperUs(i);
+        return upper < max ? upper : max;
+      }
+    }
+    return max;
+  } // percentileUs
+
+  /// @brief Get the bucket of a latency
+  /// @param latencyUs microseconds, not negative
+  /// @return size_t
+  size_t LatencyHistogram::bucketOf(int64_t latencyUs) {
+    size_t index = 0;
+    auto value = static_cast<uint64_t>(latencyUs);
+    while (value != 0 && index < kBucketCount - 1) {
+      value >>= 1;
+      index++;
+    }
+    return index;
+  } // bucketOf
+
+  /// @brief Get the exclusive upper bound of a bucket
+  /// @param index
+  /// @return int64_t microseconds, INT64_MAX for the last bucket
+  int64_t LatencyHistogram::BucketUpperUs(size_t index) {
+    if (index >= kBucketCount - 1) {
+      return INT64_MAX;
+    }
+    return int64_t(1) << index;
+  } // BucketUpperUs
+
+  /// @brief Count items at a stage
+  /// @param stage
+  /// @param count
+  /// @return void
+  void ScanMetrics::add(ScanStage stage, uint64_t count) {
+    counters_[static_cast<size_t>(stage)].value.fetch_add(count, std::memory_order_relaxed);
+  }
+
+  /// @brief Get the count of a stage
+  /// @param stage
+  /// @return uint64_t
+  uint64_t ScanMetrics::Count(ScanStage stage) const {
+    return counters_[static_cast<size_t>(stage)].value.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Get the latency from the `Received` event to the merge
+  /// @return LatencyHistogram&
+  LatencyHistogram& ScanMetrics::IngestLatency() {
+    return ingestLatency_;
+  }
+
+  const LatencyHistogram& ScanMetrics::IngestLatency() const {
+    return ingestLatency_;
+  }
+
+  /// @brief Get the latency from the latest advertisement of a device to the post of its message
+  /// @return LatencyHistogram&
+  LatencyHistogram& ScanMetrics::PostLatency() {
+    return postLatency_;
+  }
+
+  const LatencyHistogram& ScanMetrics::PostLatency() const {
+    return postLatency_;
+  }
+
+  /// @brief Clear the counters and the histograms
+  /// @return void
+  void ScanMetrics::reset() {
+    for (auto &counter : counters_) {
+      counter.value.store(0, std::memory_order_relaxed);
+    }
+    ingestLatency_.reset();
+    postLatency_.reset();
+  } // reset
+
+  /// @brief Format the counters and the latency percentiles on one line, for the log
+  /// @return std::string
+  std::string ScanMetrics::format() const {
+    std::string text;
+    char buffer[160];
+    for (size_t i = 0; i < kScanStageCount; i++) {
+      auto stage = static_cast<ScanStage>(i);
+      std::snprintf(buffer, sizeof(buffer), "%s%s %llu", i == 0 ? "" : ", ", scanStageName(stage),
+        static_cast<unsigned long long>(Count(stage)));
+      text += buffer;
+    }
+
+    const LatencyHistogram* histograms[] = {&ingestLatency_, &postLatency_};
+    const char* names[] = {"ingest", "post"};
+    for (size_t i = 0; i < 2; i++) {
+      const auto &histogram = *histograms[i];
+      std::snprintf(buffer, sizeof(buffer), "; %s latency p50 %lld us, p99 %lld us, max %lld us (%llu samples)",
+        names[i],
+        static_cast<long long>(histogram.percentileUs(0.50)),
+        static_cast<long long>(histogram.percentileUs(0.99)),
+        static_cast<long long>(histogram.MaxUs()),
+        static_cast<unsigned long long>(histogram.Count()));
+      text += buffer;
+    }
+    return text;
+  } // format
+} // namespace layrz_ble
@@ -0,0 +1,107 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_SCAN_METRICS_H__
+#define __LAYRZ_BLE_CORE_SCAN_METRICS_H__
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace layrz_ble {
+  /// @brief Stages of the scan path an advertisement (or a device sent for it) goes through
+  enum class ScanStage : uint8_t {
+    // Raised by the LE watcher
+    kReceived,
+    // Lost because the ingest ring was full
+    kDropped,
+    // Discarded by the address, service or manufacturer data filters
+    kFiltered,
+    // Same payload as the last advertisement of the device, not parsed again
+    kDuplicate,
+    // Merged into the table of visible devices
+    kMerged,
+    // Absorbed by a pending update of the same device in the coalescing window
+    kCoalesced,
+    // Devices encoded for the Flutter side (full or delta)
+    kEncoded,
+    // Messages posted to the UI thread
+    kPosted,
+  };
+
+  constexpr size_t kScanStageCount = static_cast<size_t>(ScanStage::kPosted) + 1;
+
+  const char* scanStageName(ScanStage stage);
+
+  /// @brief Latencies in power of two buckets of microseconds, recorded from any thread
+  /// @note Bucket 0 counts the latencies under 1 us, bucket i those in [2^(i-1), 2^i) us and the last one
+  /// everything from 2^(kBucketCount-2) us (about 4 s) on. Recording is a few relaxed atomic increments,
+  /// cheap enough to stay on in production.
+  class LatencyHistogram {
+    public:
+      static constexpr size_t kBucketCount = 24;
+
+      LatencyHistogram() = default;
+
+      // Disallow copy and assign.
+      LatencyHistogram(const LatencyHistogram &) = delete;
+      LatencyHistogram &operator=(const LatencyHistogram &) = delete;
+
+      void record(int64_t latencyUs);
+      void reset();
+
+      uint64_t Count() const;
+      uint64_t Bucket(size_t index) const;
+      int64_t MaxUs() const;
+      int64_t SumUs() const;
+      int64_t percentileUs(double rank) const;
+
+      static size_t bucketOf(int64_t latencyUs);
+      static int64_t BucketUpperUs(size_t index);
+
+    private:
+      std::array<std::atomic<uint64_t>, kBucketCount> buckets_{};
+      std::atomic<uint64_t> count_{0};
+      std::atomic<int64_t> sumUs_{0};
+      std::atomic<int64_t> maxUs_{0};
+  }; // class LatencyHistogram
+
+  /// @brief Always-on counters and latency histograms of the scan path, to tell where a laggy scan loses
+  /// its time without attaching a debugger.
+  /// @note Every counter sits on its own cache line: the `Received` handler, the ingest worker and the
+  /// flush timer update them concurrently with relaxed increments, the readers get a consistent enough
+  /// snapshot for monitoring (the counters are not read atomically as a whole).
+  /// The ingest latency goes from the `Received` event to the merge, the post latency from the latest
+  /// advertisement of a device to the post of the message carrying it to the UI thread.
+  class ScanMetrics {
+    public:
+      ScanMetrics() = default;
+
+      // Disallow copy and assign.
+      ScanMetrics(const ScanMetrics &) = delete;
+      ScanMetrics &operator=(const ScanMetrics &) = delete;
+
+      void add(ScanStage stage, uint64_t count = 1);
+      uint64_t Count(ScanStage stage) const;
+
+      LatencyHistogram& IngestLatency();
+      const LatencyHistogram& IngestLatency() const;
+      LatencyHistogram& PostLatency();
+      const LatencyHistogram& PostLatency() const;
+
+      void reset();
+      std::string format() const;
+
+    private:
+      struct alignas(64) Counter {
+        std::atomic<uint64_t> value{0};
+      };
+
+      std::array<Counter, kScanStageCount> counters_{};
+      LatencyHistogram ingestLatency_;
+      LatencyHistogram postLatency_;
+  }; // class ScanMetrics
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_SCAN_METRICS_H__
@@ -0,0 +1,290 @@
+#include "scan_result.h"
+
+#include <algorithm>
+
+#include "string_utils.h"
+
+namespace layrz_ble {
+
+  /// @brief Construct a new BleScanResult object
+  /// @param deviceId 
+  /// @return
+  BleScanResult::BleScanResult(const std::string& deviceId) : deviceId_(deviceId), manufacturerData_(), serviceData_() {}
+
+  /// @brief Construct a new BleScanResult object from an advertiser address
+  /// @param address the 48 bits Bluetooth address
+  /// @param addressType
+  /// @return
+  BleScanResult::BleScanResult(uint64_t address, uint8_t addressType)
+    : address_(address & kBluetoothAddressMask), addressType_(addressType) {}
+
+  /// @brief Get the key of the device in the table of visible devices
+  /// @return DeviceKey
+  DeviceKey BleScanResult::Key() const {
+    return makeDeviceKey(Address(), addressType_);
+  }
+
+  /// @brief Get the DeviceId object
+  /// @return const std::string&
+  /// @note Formatted from the address on the first call, the caller serializes the access anyway
+  const std::string& BleScanResult::DeviceId() const {
+    if (deviceId_.empty() && address_) {
+      deviceId_ = formatBluetoothAddress(*address_, true);
+    }
+    return deviceId_;
+  }
+
+  /// @brief Set the DeviceId object
+  /// @param deviceId
+  /// @return void
+  void BleScanResult::setDeviceId(const std::string_view deviceId) {
+    deviceId_ = deviceId;
+  }
+
+  /// @brief Get the Name object
+  /// @return const std::string*
+  const std::string* BleScanResult::Name() const {
+      return name_ ? &(*name_) : nullptr;
+  }
+
+  /// @brief Set the Name object
+  /// @param name
+  /// @return void 
+  void BleScanResult::setName(const std::string_view* name) {
+    name_ = name ? std::optional<std::string>(*name) : std::nullopt;
+  }
+
+  /// @brief Set the Name object
+  /// @param name
+  /// @return void
+  void BleScanResult::setName(std::string_view name) {
+    name_ = std::optional<std::string>(name);
+  }
+
+  /// @brief Set the Name object only if it changed
+  /// @param name
+  /// @return bool true if the name was changed
+  bool BleScanResult::updateName(std::string_view name) {
+    if (name_ && std::string_view(*name_) == name) {
+      return false;
+    }
+
+    name_ = std::optional<std::string>(name);
+    return true;
+  }
+
+  /// @brief Get the Rssi object
+  /// @return const int64_t  
+  const int64_t BleScanResult::Rssi() const {
+    return rssi_ ? *rssi_ : 0;
+  }
+
+  /// @brief Set the Rssi object
+  /// @param rssi
+  /// @return void
+  void BleScanResult::setRssi(int64_t* rssi) {
+    rssi_ = rssi ? std::optional<int64_t>(*rssi) : std::nullopt;
+  }
+
+  /// @brief Set the Rssi object
+  /// @param rssi
+  /// @return void
+  void BleScanResult::setRssi(int64_t rssi) {
+    rssi_ = std::optional<int64_t>(rssi);
+  }
+
+  /// @brief Get the RSSI smoothing state
+  /// @return const RssiFilterState&
+  const RssiFilterState& BleScanResult::RssiState() const {
+    return rssiState_;
+  }
+
+  /// @brief Get the RSSI smoothing state, to feed it a sample
+  /// @return RssiFilterState&
+  RssiFilterState& BleScanResult::RssiState() {
+    return rssiState_;
+  }
+
+  const AdvPacketType* BleScanResult::ManufacturerData() const {
+    return &manufacturerData_;
+  }
+
+  /// @brief Get the ManufacturerData object
+  /// @return const flutter::EncodableMap*
+  void BleScanResult::setManufacturerData(const AdvPacketType* manufacturerData) {
+    if (manufacturerData) {
+      manufacturerData_ = *manufacturerData;
+    }
+  }
+
+  /// @brief  Set the ManufacturerData object
+  /// @param companyId
+  /// @param data
+  /// @return void
+  void BleScanResult::appendManufacturerData(const uint16_t& companyId, const std::vector<uint8_t>& data) {
+    manufacturerData_.insert_or_assign(companyId, ByteView(data));
+  }
+
+  /// @brief Set the ManufacturerData of a company only if the payload changed
+  /// @param companyId
+  /// @param data view of the new payload, copied only when it differs from the stored one
+  /// @return bool true if the payload was changed
+  bool BleScanResult::updateManufacturerData(uint16_t companyId, ByteView data) {
+    return manufacturerData_.update(companyId, data);
+  }
+
+  /// @brief Get the ServiceData object
+  /// @return const std::vector<uint8_t>*  
+  const ServiceDataType* BleScanResult::ServiceData() const {
+    return &serviceData_;
+  }
+
+  /// @brief Set the ServiceData object
+  /// @param serviceData
+  /// @return void  
+  void BleScanResult::setServiceData(const ServiceDataType* serviceData) {
+    if (serviceData) {
+      serviceData_ = *serviceData;
+    }
+  }
+
+  /// @brief Set the ServiceData object
+  /// @param serviceData
+  /// @return void
+  void BleScanResult::appendServiceData(const Uuid128& serviceUuid, const std::vector<uint8_t>& data) {
+    serviceData_.insert_or_assign(serviceUuid, ByteView(data));
+  }
+
+  /// @brief Set the ServiceData of a service only if the payload changed
+  /// @param serviceUuid
+  /// @param data view of the new payload, copied only when it differs from the stored one
+  /// @return bool true if the payload was changed
+  bool BleScanResult::updateServiceData(const Uuid128& serviceUuid, ByteView data) {
+    return serviceData_.update(serviceUuid, data);
+  }
+  
+  /// @brief Get the Address object
+  /// @return const uint64_t
+  const uint64_t BleScanResult::Address() const {
+    return address_ ? *address_ : 0;
+  }
+
+  /// @brief Set the Address object
+  /// @param address
+  /// @return void
+  void BleScanResult::setAddress(uint64_t address) {
+    address_ = address;
+  }
+
+  /// @brief Get the AddressType object
+  /// @return uint8_t kAddressTypePublic, kAddressTypeRandom or kAddressTypeUnspecified
+  uint8_t BleScanResult::AddressType() const {
+    return addressType_;
+  }
+
+  /// @brief Set the AddressType object
+  /// @param addressType
+  /// @return void
+  void BleScanResult::setAddressType(uint8_t addressType) {
+    addressType_ = addressType;
+  }
+
+  /// @brief Get the TxPower object
+  /// @return const uint8_t
+  const uint16_t BleScanResult::TxPower() const {
+    return txPower_ ? *txPower_ : 0;
+  }
+
+  /// @brief Set the TxPower object
+  /// @param txPower
+  /// @return void
+  void BleScanResult::setTxPower(uint16_t txPower) {
+    txPower_ = txPower;
+  }
+
+  /// @brief Get the PayloadFingerprint object
+  /// @return uint64_t 0 if no raw advertisement was merged yet
+  uint64_t BleScanResult::PayloadFingerprint() const {
+    return payloadFingerprint_;
+  }
+
+  /// @brief Set the PayloadFingerprint object
+  /// @param fingerprint
+  /// @return void
+  void BleScanResult::setPayloadFingerprint(uint64_t fingerprint) {
+    payloadFingerprint_ = fingerprint;
+  }
+
+  /// @brief Get the LastSeenUs object
+  /// @return int64_t monotonic time of the last advertisement
+  int64_t BleScanResult::LastSeenUs() const {
+    return lastSeenUs_;
+  }
+
+  /// @brief Set the LastSeenUs object
+  /// @param lastSeenUs
+  /// @return void
+  void BleScanResult::setLastSeenUs(int64_t lastSeenUs) {
+    lastSeenUs_ = lastSeenUs;
+  }
+
+  /// @brief Get the PrimaryPhy object
+  /// @return uint8_t AdvertisingPhy, kPhyUnknown if not reported
+  uint8_t BleScanResult::PrimaryPhy() const {
+    return primaryPhy_;
+  }
+
+  /// @brief Set the PrimaryPhy object
+  /// @param phy AdvertisingPhy
+  /// @return void
+  void BleScanResult::setPrimaryPhy(uint8_t phy) {
+    primaryPhy_ = phy;
+  }
+
+  /// @brief Get the SecondaryPhy object
+  /// @return uint8_t AdvertisingPhy of the auxiliary packets, kPhyUnknown for legacy advertisements
+  uint8_t BleScanResult::SecondaryPhy() const {
+    return secondaryPhy_;
+  }
+
+  /// @brief Set the SecondaryPhy object
+  /// @param phy AdvertisingPhy
+  /// @return void
+  void BleScanResult::setSecondaryPhy(uint8_t phy) {
+    secondaryPhy_ = phy;
+  }
+
+  /// @brief Get the AdvertisingSid object
+  /// @return uint8_t 0 to 15, kAdvertisingSidUnknown if not reported
+  uint8_t BleScanResult::AdvertisingSid() const {
+    return advertisingSid_;
+  }
+
+  /// @brief Set the AdvertisingSid object
+  /// @param sid
+  /// @return void
+  void BleScanResult::setAdvertisingSid(uint8_t sid) {
+    advertisingSid_ = sid;
+  }
+
+  /// @brief Get the length of the longest advertising data merged
+  /// @return uint16_t bytes
+  uint16_t BleScanResult::MaxPayloadLength() const {
+    return maxPayloadLength_;
+  }
+
+  /// @brief Record the length of a merged advertising data
+  /// @param length bytes
+  /// @return void
+  void BleScanResult::notePayloadLength(size_t length) {
+    if (length > maxPayloadLength_) {
+      maxPayloadLength_ = static_cast<uint16_t>(std::min<size_t>(length, UINT16_MAX));
+    }
+  }
+
+  /// @brief Check if the device uses Bluetooth 5 extended advertising
+  /// @return bool true once an advertisement longer than a legacy one, or on a secondary PHY, was merged
+  bool BleScanResult::isExtended() const {
+    return maxPayloadLength_ > kLegacyAdvertisingDataLength || secondaryPhy_ != kPhyUnknown;
+  }
+}
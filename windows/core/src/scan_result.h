@@ -0,0 +1,129 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_SCAN_RESULT_H__
+#define __LAYRZ_BLE_CORE_SCAN_RESULT_H__
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "adv_packet.h"
+#include "byte_view.h"
+#include "device_index.h"
+#include "rssi_filter.h"
+
+typedef layrz_ble::AdvPacketMap AdvPacketType;
+typedef layrz_ble::ServiceDataMap ServiceDataType;
+
+namespace layrz_ble {
+  /// @brief PHY an advertisement was received on, same values as the HCI LE Extended Advertising Report
+  enum AdvertisingPhy : uint8_t {
+    kPhyUnknown = 0,
+    kPhyLe1M = 1,
+    kPhyLe2M = 2,
+    kPhyLeCoded = 3,
+  };
+
+  /// @brief Advertising SID of a legacy advertisement, or when the stack does not report it
+  constexpr uint8_t kAdvertisingSidUnknown = 0xFF;
+
+  /// @brief Max length of the advertising data of a legacy (Bluetooth 4.x) advertisement
+  constexpr size_t kLegacyAdvertisingDataLength = 31;
+
+  /// @brief Max length of the advertising data of an extended advertisement, chained PDUs included
+  constexpr size_t kMaxExtendedAdvertisingDataLength = 1650;
+
+  /// @brief Platform-neutral state of a scanned device.
+  /// @note The WinRT device handle lives on the plugin side, this class only keeps what the
+  /// advertisements report so the merge can run (and be profiled) anywhere.
+  /// A device built from an address gets its string ID (uppercase MAC) on the first DeviceId() call,
+  /// the scan path only deals with the integer Key().
+  class BleScanResult {
+    public:
+      BleScanResult() = default;
+      explicit BleScanResult(const std::string& deviceId);
+      BleScanResult(uint64_t address, uint8_t addressType);
+
+      DeviceKey Key() const;
+
+      const std::string& DeviceId() const;
+      void setDeviceId(std::string_view deviceId);
+      
+      const std::string* Name() const;
+      void setName(const std::string_view* name);
+      void setName(std::string_view name);
+      bool updateName(std::string_view name);
+
+      const int64_t Rssi() const;
+      void setRssi(int64_t* rssi);
+      void setRssi(int64_t rssi);
+      const RssiFilterState& RssiState() const;
+      RssiFilterState& RssiState();
+
+      const AdvPacketType* ManufacturerData() const;
+      void setManufacturerData(const AdvPacketType* manufacturerData);
+      void appendManufacturerData(const uint16_t& companyId, const std::vector<uint8_t>& data);
+      bool updateManufacturerData(uint16_t companyId, ByteView data);
+
+      const ServiceDataType* ServiceData() const;
+      void setServiceData(const ServiceDataType* serviceData);
+      void appendServiceData(const Uuid128& serviceUuid, const std::vector<uint8_t>& data);
+      bool updateServiceData(const Uuid128& serviceUuid, ByteView data);
+
+      const uint64_t Address() const;
+      void setAddress(uint64_t address);
+
+      uint8_t AddressType() const;
+      void setAddressType(uint8_t addressType);
+
+      const uint16_t TxPower() const;
+      void setTxPower(uint16_t txPower);
+
+      uint64_t PayloadFingerprint() const;
+      void setPayloadFingerprint(uint64_t fingerprint);
+
+      int64_t LastSeenUs() const;
+      void setLastSeenUs(int64_t lastSeenUs);
+
+      uint8_t PrimaryPhy() const;
+      void setPrimaryPhy(uint8_t phy);
+      uint8_t SecondaryPhy() const;
+      void setSecondaryPhy(uint8_t phy);
+      uint8_t AdvertisingSid() const;
+      void setAdvertisingSid(uint8_t sid);
+      uint16_t MaxPayloadLength() const;
+      void notePayloadLength(size_t length);
+      bool isExtended() const;
+
+    private:
+      // Formatted lazily from the address, see DeviceId()
+      mutable std::string deviceId_;
+      std::optional<std::string> name_;
+      std::optional<int64_t> rssi_;
+      // Smoothing of the raw samples, rssi_ is the reported value
+      RssiFilterState rssiState_;
+
+      AdvPacketType manufacturerData_;
+      ServiceDataType serviceData_;
+
+      std::optional<uint64_t> address_;
+      uint8_t addressType_ = kAddressTypePublic;
+
+      std::optional<uint16_t> txPower_;
+
+      // Fingerprint of the last merged raw advertisement, 0 if unknown
+      uint64_t payloadFingerprint_ = 0;
+      int64_t lastSeenUs_ = 0;
+
+      // Bluetooth 5 extended advertising, unknown until the stack reports it
+      uint8_t primaryPhy_ = kPhyUnknown;
+      uint8_t secondaryPhy_ = kPhyUnknown;
+      uint8_t advertisingSid_ = kAdvertisingSidUnknown;
+      // Longest advertising data merged, beyond 31 bytes the device uses extended advertising
+      uint16_t maxPayloadLength_ = 0;
+  };
+}
+
+#endif // __LAYRZ_BLE_CORE_SCAN_RESULT_H__
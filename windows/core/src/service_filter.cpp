@@ -0,0 +1,151 @@
+#include "service_filter.h"
+#include "ad_parser.h"
+
+#include <algorithm>
+
+namespace layrz_ble {
+
+  /// @brief Check if the filter discards anything
+  /// @return bool false when no UUID was added, every advertisement matches then
+  bool ServiceUuidFilter::isEnabled() const {
+    return !shortUuids_.empty() || !longUuids_.empty();
+  }
+
+  /// @brief Add a wanted service UUID
+  /// @param uuid in its 16, 32 or 128 bits form
+  /// @return bool false if the text is not a UUID, the filter is left untouched then
+  bool ServiceUuidFilter::add(std::string_view uuid) {
+    Uuid128 parsed;
+    if (!Uuid128::parse(uuid, parsed)) {
+      return false;
+    }
+
+    add(parsed);
+    return true;
+  } // add
+
+  /// @brief Add a wanted service UUID
+  /// @param uuid
+  /// @return void
+  void ServiceUuidFilter::add(const Uuid128& uuid) {
+    uint32_t shortUuid = 0;
+    if (uuid.toShort(shortUuid)) {
+      if (!contains(shortUuid)) {
+        shortUuids_.push_back(shortUuid);
+      }
+      return;
+    }
+
+    if (!contains(uuid)) {
+      longUuids_.push_back(uuid);
+    }
+  } // add
+
+  /// @brief Remove every UUID, disabling the filter
+  /// @return void
+  void ServiceUuidFilter::clear() {
+    shortUuids_.clear();
+    longUuids_.clear();
+  }
+
+  /// @brief Get the number of wanted UUIDs
+  /// @return size_t
+  size_t ServiceUuidFilter::size() const {
+    return shortUuids_.size() + longUuids_.size();
+  }
+
+  /// @brief Check if an advertisement carries one of the wanted UUIDs
+  /// @param payload the raw advertisement (or scan response)
+  /// @return bool true when the filter is disabled
+  /// @note The lists hold a handful of UUIDs, a linear search beats any hashing here.
+  bool ServiceUuidFilter::matches(ByteView payload) const {
+    if (!isEnabled()) {
+      return true;
+    }
+
+    for (const auto& structure : AdStructures(payload)) {
+      const ByteView& data = structure.data;
+      switch (structure.type) {
+        case kAdTypeIncomplete16BitUuids:
+        case kAdTypeComplete16BitUuids:
+          for (size_t i = 0; i + 2 <= data.size(); i += 2) {
+            if (contains(static_cast<uint32_t>(data[i] | (data[i + 1] << 8)))) {
+              return true;
+            }
+          }
+          break;
+
+        case kAdTypeServiceData16BitUuid:
+          if (data.size() >= 2 && contains(static_cast<uint32_t>(data[0] | (data[1] << 8)))) {
+            return true;
+          }
+          break;
+
+        case kAdTypeIncomplete32BitUuids:
+        case kAdTypeComplete32BitUuids:
+          for (size_t i = 0; i + 4 <= data.size(); i += 4) {
+            if (contains(readUint32(data, i))) {
+              return true;
+            }
+          }
+          break;
+
+        case kAdTypeServiceData32BitUuid:
+          if (data.size() >= 4 && contains(readUint32(data, 0))) {
+            return true;
+          }
+          break;
+
+        case kAdTypeIncomplete128BitUuids:
+        case kAdTypeComplete128BitUuids:
+          for (size_t i = 0; i + 16 <= data.size(); i += 16) {
+            if (contains(Uuid128::fromLittleEndian(data.subview(i, 16)))) {
+              return true;
+            }
+          }
+          break;
+
+        case kAdTypeServiceData128BitUuid:
+          if (data.size() >= 16 && contains(Uuid128::fromLittleEndian(data.subview(0, 16)))) {
+            return true;
+          }
+          break;
+
+        default:
+          break;
+      }
+    }
+
+    return false;
+  } // matches
+
+  /// @brief Check if a 16 or 32 bits UUID is wanted
+  /// @param shortUuid
+  /// @return bool
+  bool ServiceUuidFilter::contains(uint32_t shortUuid) const {
+    return std::find(shortUuids_.begin(), shortUuids_.end(), shortUuid) != shortUuids_.end();
+  }
+
+  /// @brief Check if a 128 bits UUID is wanted
+  /// @param uuid
+  /// @return bool
+  /// @note A 128 bits form of a base derived UUID is matched against the short ones
+  bool ServiceUuidFilter::contains(const Uuid128& uuid) const {
+    uint32_t shortUuid = 0;
+    if (uuid.toShort(shortUuid)) {
+      return contains(shortUuid);
+    }
+    return std::find(longUuids_.begin(), longUuids_.end(), uuid) != longUuids_.end();
+  }
+
+  /// @brief Read a little endian 32 bits integer
+  /// @param data
+  /// @param offset at least 4 bytes must follow
+  /// @return uint32_t
+  uint32_t ServiceUuidFilter::readUint32(const ByteView& data, size_t offset) {
+    return static_cast<uint32_t>(data[offset])
+      | (static_cast<uint32_t>(data[offset + 1]) << 8)
+      | (static_cast<uint32_t>(data[offset + 2]) << 16)
+      | (static_cast<uint32_t>(data[offset + 3]) << 24);
+  }
+} // namespace layrz_ble
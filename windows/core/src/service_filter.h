@@ -0,0 +1,41 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_SERVICE_FILTER_H__
+#define __LAYRZ_BLE_CORE_SERVICE_FILTER_H__
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "byte_view.h"
+#include "uuid.h"
+
+namespace layrz_ble {
+  /// @brief Matches raw advertisements against the service UUIDs requested by startScan
+  /// @note An advertisement matches when one of its service UUID lists (16, 32 or 128 bits, complete or
+  /// not) or one of its service data sections carries a wanted UUID. The payload is scanned in place,
+  /// nothing is allocated, so the advertisements of unrelated devices are dropped before any merge.
+  class ServiceUuidFilter {
+    public:
+      ServiceUuidFilter() = default;
+
+      bool isEnabled() const;
+      bool add(std::string_view uuid);
+      void add(const Uuid128& uuid);
+      void clear();
+      size_t size() const;
+
+      bool matches(ByteView payload) const;
+
+    private:
+      bool contains(uint32_t shortUuid) const;
+      bool contains(const Uuid128& uuid) const;
+      static uint32_t readUint32(const ByteView& data, size_t offset);
+
+      // The base derived UUIDs are compared by their 32 bits alias, a 16 bits UUID is one with zeroed high bits
+      std::vector<uint32_t> shortUuids_;
+      std::vector<Uuid128> longUuids_;
+  }; // class ServiceUuidFilter
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_SERVICE_FILTER_H__
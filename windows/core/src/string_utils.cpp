@@ -0,0 +1,70 @@
+#include "string_utils.h"
+
+#define MAC_ADDRESS_STR_LENGTH (size_t)17
+
+namespace layrz_ble {
+  std::string formatBluetoothAddress(uint64_t mac_address, bool uppercase) {
+    const char* digits = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+    std::string mac_str(MAC_ADDRESS_STR_LENGTH, ':');
+    for (size_t i = 0; i < 6; i++) {
+      auto octet = static_cast<unsigned>((mac_address >> (40 - i * 8)) & 0xFF);
+      mac_str[i * 3] = digits[octet >> 4];
+      mac_str[i * 3 + 1] = digits[octet & 0x0F];
+    }
+    return mac_str;
+  } // formatBluetoothAddress
+
+  bool parseBluetoothAddress(std::string_view text, uint64_t &mac_address) {
+    if (text.size() != MAC_ADDRESS_STR_LENGTH) {
+      return false;
+    }
+
+    uint64_t address = 0;
+    for (size_t i = 0; i < MAC_ADDRESS_STR_LENGTH; i++) {
+      char c = text[i];
+      if (i % 3 == 2) {
+        if (c != ':' && c != '-') return false;
+        continue;
+      }
+
+      uint64_t nibble;
+      if (c >= '0' && c <= '9') {
+        nibble = c - '0';
+      } else if (c >= 'a' && c <= 'f') {
+        nibble = c - 'a' + 10;
+      } else if (c >= 'A' && c <= 'F') {
+        nibble = c - 'A' + 10;
+      } else {
+        return false;
+      }
+      address = (address << 4) | nibble;
+    }
+
+    mac_address = address;
+    return true;
+  } // parseBluetoothAddress
+
+  std::string toLowercase(const std::string &str) {
+    std::string lower = str;
+    std::transform(
+      lower.begin(),
+      lower.end(),
+      lower.begin(),
+      [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return lower;
+  } // toLowercase
+
+  std::string toUppercase(const std::string &str) {
+    std::string upper = str;
+    std::transform(
+      upper.begin(),
+      upper.end(),
+      upper.begin(),
+      [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    return upper;
+  } // toUppercase
+
+  std::string BooleanToString(bool value) {
+    return value ? "true" : "false";
+  } // BooleanToString
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_STRING_UTILS_H__
+#define __LAYRZ_BLE_CORE_STRING_UTILS_H__
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace layrz_ble {
+  /// @brief Format a Bluetooth MAC address
+  /// @param mac_address
+  /// @param uppercase use uppercase hex digits, as the device IDs sent to the Flutter side
+  /// @return std::string
+  std::string formatBluetoothAddress(uint64_t mac_address, bool uppercase = false);
+
+  /// @brief Parse a Bluetooth MAC address (`AA:BB:CC:DD:EE:FF`, any case, `:` or `-` separated)
+  /// @param text
+  /// @param mac_address the 48 bits address
+  /// @return bool false if the text is not an address
+  bool parseBluetoothAddress(std::string_view text, uint64_t &mac_address);
+
+  /// @brief Convert a string to lowercase
+  /// @param str
+  /// @return std::string
+  std::string toLowercase(const std::string &str);
+
+  /// @brief Convert a string to uppercase
+  /// @param str
+  /// @return std::string
+  std::string toUppercase(const std::string &str);
+
+  /// @brief Convert a boolean to a string
+  /// @param value
+  /// @return std::string
+  std::string BooleanToString(bool value);
+}
+
+#endif // __LAYRZ_BLE_CORE_STRING_UTILS_H__
@@ -0,0 +1,120 @@
+#include "uuid.h"
+
+namespace layrz_ble {
+  // Bluetooth base UUID 00000000-0000-1000-8000-00805F9B34FB, the short UUIDs replace its first 32 bits
+  constexpr uint64_t kBaseUuidMsb = 0x0000000000001000ULL;
+  constexpr uint64_t kBaseUuidLsb = 0x800000805F9B34FBULL;
+
+  // Value of every character in a UUID text, the lookups of the GATT operations parse two per call
+  constexpr uint8_t kNibbleDash = 0x10;
+  constexpr uint8_t kNibbleInvalid = 0xFF;
+  struct HexNibbleTable {
+    uint8_t values[256];
+
+    constexpr HexNibbleTable() : values() {
+      for (int i = 0; i < 256; i++) {
+        values[i] = kNibbleInvalid;
+      }
+      for (int i = 0; i < 10; i++) {
+        values['0' + i] = static_cast<uint8_t>(i);
+      }
+      for (int i = 0; i < 6; i++) {
+        values['a' + i] = static_cast<uint8_t>(10 + i);
+        values['A' + i] = static_cast<uint8_t>(10 + i);
+      }
+      values[static_cast<uint8_t>('-')] = kNibbleDash;
+    }
+
+    constexpr uint8_t operator[](uint8_t c) const { return values[c]; }
+  };
+  constexpr HexNibbleTable kHexNibbles;
+
+  /// @brief Expand a 16 or 32 bits UUID
+  /// @param uuid
+  /// @return Uuid128
+  Uuid128 Uuid128::fromShort(uint32_t uuid) {
+    return Uuid128{(static_cast<uint64_t>(uuid) << 32) | kBaseUuidMsb, kBaseUuidLsb};
+  } // fromShort
+
+  /// @brief Read a UUID as it is sent over the air
+  /// @param bytes at least 16 bytes, least significant byte first
+  /// @return Uuid128
+  Uuid128 Uuid128::fromLittleEndian(ByteView bytes) {
+    Uuid128 uuid;
+    if (bytes.size() < 16) {
+      return uuid;
+    }
+
+    for (size_t i = 0; i < 8; i++) {
+      uuid.lsb |= static_cast<uint64_t>(bytes[i]) << (i * 8);
+      uuid.msb |= static_cast<uint64_t>(bytes[i + 8]) << (i * 8);
+    }
+    return uuid;
+  } // fromLittleEndian
+
+  /// @brief Parse a UUID in its 16 bits (`180D`), 32 bits (`0000180D`) or 128 bits form, with or without dashes
+  /// @param text any case
+  /// @param uuid
+  /// @return bool false if the text is not a UUID
+  bool Uuid128::parse(std::string_view text, Uuid128& uuid) {
+    // Two words in registers, an indexed array would go through memory on every digit
+    uint64_t high = 0;
+    uint64_t low = 0;
+    size_t digits = 0;
+    for (char c : text) {
+      uint8_t nibble = kHexNibbles[static_cast<uint8_t>(c)];
+      if (nibble == kNibbleDash) {
+        continue;
+      }
+      if (nibble == kNibbleInvalid || digits >= 32) {
+        return false;
+      }
+
+      if (digits < 16) {
+        high = (high << 4) | nibble;
+      } else {
+        low = (low << 4) | nibble;
+      }
+      digits++;
+    }
+
+    if (digits == 4 || digits == 8) {
+      uuid = fromShort(static_cast<uint32_t>(high));
+      return true;
+    }
+
+    if (digits == 32) {
+      uuid = Uuid128{high, low};
+      return true;
+    }
+    return false;
+  } // parse
+
+  /// @brief Get the 16 or 32 bits alias of the UUID
+  /// @param uuid
+  /// @return bool false if the UUID is not derived from the Bluetooth base UUID
+  bool Uuid128::toShort(uint32_t& uuid) const {
+    if ((msb & 0xFFFFFFFFULL) != kBaseUuidMsb || lsb != kBaseUuidLsb) {
+      return false;
+    }
+    uuid = static_cast<uint32_t>(msb >> 32);
+    return true;
+  } // toShort
+
+  /// @brief Format the UUID in its canonical 128 bits form
+  /// @return std::string uppercase, `XXXXXXXX-XXXX-XXXX-XXXX-XXXXXXXXXXXX`
+  std::string Uuid128::toString() const {
+    static const char* digits = "0123456789ABCDEF";
+    std::string text;
+    text.reserve(36);
+    for (int i = 0; i < 32; i++) {
+      uint64_t word = i < 16 ? msb : lsb;
+      int shift = (15 - (i % 16)) * 4;
+      if (i == 8 || i == 12 || i == 16 || i == 20) {
+        text.push_back('-');
+      }
+      text.push_back(digits[(word >> shift) & 0x0F]);
+    }
+    return text;
+  } // toString
+} // namespace layrz_ble
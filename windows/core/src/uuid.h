@@ -0,0 +1,41 @@
+#pragma once
+
+#ifndef __LAYRZ_BLE_CORE_UUID_H__
+#define __LAYRZ_BLE_CORE_UUID_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "byte_view.h"
+
+namespace layrz_ble {
+  /// @brief 128 bits UUID held as two integers, cheap to compare and to hash
+  /// @note 16 and 32 bits UUIDs are aliases of the Bluetooth base UUID 0000xxxx-0000-1000-8000-00805F9B34FB,
+  /// they are stored expanded so every form of the same UUID compares equal.
+  struct Uuid128 {
+    uint64_t msb = 0;
+    uint64_t lsb = 0;
+
+    static Uuid128 fromShort(uint32_t uuid);
+    static Uuid128 fromLittleEndian(ByteView bytes);
+    static bool parse(std::string_view text, Uuid128& uuid);
+
+    bool toShort(uint32_t& uuid) const;
+    std::string toString() const;
+
+    bool operator==(const Uuid128& other) const { return msb == other.msb && lsb == other.lsb; }
+    bool operator!=(const Uuid128& other) const { return !(*this == other); }
+    bool operator<(const Uuid128& other) const { return msb != other.msb ? msb < other.msb : lsb < other.lsb; }
+  }; // struct Uuid128
+
+  /// @brief Hash of a Uuid128, for the unordered containers
+  struct Uuid128Hash {
+    size_t operator()(const Uuid128& uuid) const {
+      return static_cast<size_t>(uuid.msb ^ (uuid.lsb * 0x9E3779B97F4A7C15ULL));
+    }
+  };
+} // namespace layrz_ble
+
+#endif // __LAYRZ_BLE_CORE_UUID_H__
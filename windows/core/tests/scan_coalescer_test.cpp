@@ -0,0 +1,93 @@
+// Checks when ScanCoalescer flushes a batch, with the default window and after the window is changed
+// (as setScanCoalescingWindow does on a running scan).
+//
+// Usage: scan_coalescer_test, runs every check and exits with a failure status if any of them failed
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "scan_coalescer.h"
+
+using namespace layrz_ble;
+
+namespace {
+  int failures = 0;
+
+  void check(bool condition, const char *what) {
+    if (!condition) {
+      std::fprintf(stderr, "FAILED: %s\n", what);
+      failures++;
+    }
+  }
+
+  const DeviceKey kFirst = makeDeviceKey(0x112233445566ULL, kAddressTypePublic);
+  const DeviceKey kSecond = makeDeviceKey(0xAABBCCDDEEFFULL, kAddressTypeRandom);
+
+  void testDefaultWindow() {
+    ScanCoalescer coalescer;
+    check(coalescer.WindowUs() == ScanCoalescer::kDefaultWindowUs, "default window");
+    check(coalescer.isEnabled(), "default window enabled");
+    check(!coalescer.isDue(0), "empty coalescer is never due");
+
+    coalescer.add(kFirst, 1000);
+    coalescer.add(kFirst, 50000);
+    coalescer.add(kSecond, 60000);
+    check(coalescer.pending() == 2, "a device updated twice is pending once");
+    check(coalescer.AbsorbedUpdates() == 1, "the second update is absorbed");
+    check(!coalescer.isDue(1000 + ScanCoalescer::kDefaultWindowUs - 1), "not due before the window");
+    check(coalescer.isDue(1000 + ScanCoalescer::kDefaultWindowUs), "due once the window elapsed");
+
+    std::vector<DeviceKey> keys;
+    coalescer.take(keys);
+    check(keys.size() == 2 && keys[0] == kFirst && keys[1] == kSecond, "batch in first update order");
+    check(coalescer.pending() == 0 && !coalescer.isDue(1000000), "empty after the flush");
+  }
+
+  void testChangedWindow() {
+    ScanCoalescer coalescer;
+    coalescer.setWindowUs(20000);
+    check(coalescer.WindowUs() == 20000, "window changed");
+
+    coalescer.add(kFirst, 100000);
+    check(!coalescer.isDue(119999), "not due before the shorter window");
+    check(coalescer.isDue(120000), "due after the shorter window");
+
+    // A pending batch keeps the start of its window, only the length changes
+    coalescer.setWindowUs(500000);
+    check(!coalescer.isDue(120000), "longer window holds the pending batch back");
+    check(coalescer.isDue(600000), "due after the longer window");
+
+    std::vector<DeviceKey> keys;
+    coalescer.take(keys);
+    coalescer.add(kSecond, 700000);
+    check(!coalescer.isDue(1199999), "next batch opens a new window");
+    check(coalescer.isDue(1200000), "next batch due after the new window");
+  }
+
+  void testDisabledWindow() {
+    ScanCoalescer coalescer;
+    coalescer.setWindowUs(0);
+    check(coalescer.WindowUs() == 0 && !coalescer.isEnabled(), "a window of 0 disables the coalescing");
+
+    coalescer.setWindowUs(-5000);
+    check(coalescer.WindowUs() == 0 && !coalescer.isEnabled(), "a negative window is clamped to 0");
+
+    coalescer.setWindowUs(ScanCoalescer::kDefaultWindowUs);
+    check(coalescer.isEnabled(), "enabled again");
+  }
+} // namespace
+
+int main() {
+  testDefaultWindow();
+  testChangedWindow();
+  testDisabledWindow();
+
+  if (failures > 0) {
+    std::fprintf(stderr, "%d checks failed\n", failures);
+    return EXIT_FAILURE;
+  }
+
+  std::printf("scan_coalescer_test: all checks passed\n");
+  return EXIT_SUCCESS;
+}
@@ -34,7 +34,7 @@ namespace layrz_ble {
       void addCharacteristic(const BleCharacteristic characteristic) {
         characteristics_[toUppercase(GuidToString(characteristic.Characteristic().Uuid()))] = characteristic;
       }
-      const std::unordered_map<std::string, BleCharacteristic> Characteristics() const { return characteristics_; }
+      const std::unordered_map<std::string, BleCharacteristic>& Characteristics() const { return characteristics_; }
 
     private:
       GattDeviceService service_{nullptr};
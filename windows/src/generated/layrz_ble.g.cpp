@@ -521,9 +521,11 @@ BtServiceData::BtServiceData(int64_t uuid)
 
 BtServiceData::BtServiceData(
   int64_t uuid,
-  const std::vector<uint8_t>* data)
+  const std::vector<uint8_t>* data,
+  const std::string* full_uuid)
  : uuid_(uuid),
-    data_(data ? std::optional<std::vector<uint8_t>>(*data) : std::nullopt) {}
+    data_(data ? std::optional<std::vector<uint8_t>>(*data) : std::nullopt),
+    full_uuid_(full_uuid ? std::optional<std::string>(*full_uuid) : std::nullopt) {}
 
 int64_t BtServiceData::uuid() const {
   return uuid_;
@@ -547,26 +549,43 @@ void BtServiceData::set_data(const std::vector<uint8_t>& value_arg) {
 }
 
 
+const std::string* BtServiceData::full_uuid() const {
+  return full_uuid_ ? &(*full_uuid_) : nullptr;
+}
+
+void BtServiceData::set_full_uuid(const std::string_view* value_arg) {
+  full_uuid_ = value_arg ? std::optional<std::string>(*value_arg) : std::nullopt;
+}
+
+void BtServiceData::set_full_uuid(std::string_view value_arg) {
+  full_uuid_ = value_arg;
+}
+
+
 EncodableList BtServiceData::ToEncodableList() const {
   EncodableList list;
-  list.reserve(2);
+  list.reserve(3);
   list.push_back(EncodableValue(uuid_));
   list.push_back(data_ ? EncodableValue(*data_) : EncodableValue());
+  list.push_back(full_uuid_ ? EncodableValue(*full_uuid_) : EncodableValue());
   return list;
 }
 
 BtServiceData BtServiceData::FromEncodableList(const EncodableList& list) {
-  BtServiceData decoded(
-    std::get<int64_t>(list[0]));
+  BtServiceData decoded(std::get<int64_t>(list[0]));
   auto& encodable_data = list[1];
   if (!encodable_data.IsNull()) {
     decoded.set_data(std::get<std::vector<uint8_t>>(encodable_data));
   }
+  auto& encodable_full_uuid = list[2];
+  if (!encodable_full_uuid.IsNull()) {
+    decoded.set_full_uuid(std::get<std::string>(encodable_full_uuid));
+  }
   return decoded;
 }
 
 bool BtServiceData::operator==(const BtServiceData& other) const {
-  return PigeonInternalDeepEquals(uuid_, other.uuid_) && PigeonInternalDeepEquals(data_, other.data_);
+  return PigeonInternalDeepEquals(uuid_, other.uuid_) && PigeonInternalDeepEquals(data_, other.data_) && PigeonInternalDeepEquals(full_uuid_, other.full_uuid_);
 }
 
 bool BtServiceData::operator!=(const BtServiceData& other) const {
@@ -577,6 +596,7 @@ size_t BtServiceData::Hash() const {
   size_t result = 1;
   result = result * 31 + PigeonInternalDeepHash(uuid_);
   result = result * 31 + PigeonInternalDeepHash(data_);
+  result = result * 31 + PigeonInternalDeepHash(full_uuid_);
   return result;
 }
 
@@ -652,6 +672,14 @@ BtCharacteristic::BtCharacteristic(
  : uuid_(uuid),
     properties_(properties) {}
 
+BtCharacteristic::BtCharacteristic(
+  const std::string& uuid,
+  const EncodableList& properties,
+  const int64_t* handle)
+ : uuid_(uuid),
+    properties_(properties),
+    handle_(handle ? std::optional<int64_t>(*handle) : std::nullopt) {}
+
 const std::string& BtCharacteristic::uuid() const {
   return uuid_;
 }
@@ -670,11 +698,25 @@ void BtCharacteristic::set_properties(const EncodableList& value_arg) {
 }
 
 
+const int64_t* BtCharacteristic::handle() const {
+  return handle_ ? &(*handle_) : nullptr;
+}
+
+void BtCharacteristic::set_handle(const int64_t* value_arg) {
+  handle_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void BtCharacteristic::set_handle(int64_t value_arg) {
+  handle_ = value_arg;
+}
+
+
 EncodableList BtCharacteristic::ToEncodableList() const {
   EncodableList list;
-  list.reserve(2);
+  list.reserve(3);
   list.push_back(EncodableValue(uuid_));
   list.push_back(EncodableValue(properties_));
+  list.push_back(handle_ ? EncodableValue(*handle_) : EncodableValue());
   return list;
 }
 
@@ -682,11 +724,15 @@ BtCharacteristic BtCharacteristic::FromEncodableList(const EncodableList& list)
   BtCharacteristic decoded(
     std::get<std::string>(list[0]),
     std::get<EncodableList>(list[1]));
+  auto& encodable_handle = list[2];
+  if (!encodable_handle.IsNull()) {
+    decoded.set_handle(std::get<int64_t>(encodable_handle));
+  }
   return decoded;
 }
 
 bool BtCharacteristic::operator==(const BtCharacteristic& other) const {
-  return PigeonInternalDeepEquals(uuid_, other.uuid_) && PigeonInternalDeepEquals(properties_, other.properties_);
+  return PigeonInternalDeepEquals(uuid_, other.uuid_) && PigeonInternalDeepEquals(properties_, other.properties_) && PigeonInternalDeepEquals(handle_, other.handle_);
 }
 
 bool BtCharacteristic::operator!=(const BtCharacteristic& other) const {
@@ -697,6 +743,7 @@ size_t BtCharacteristic::Hash() const {
   size_t result = 1;
   result = result * 31 + PigeonInternalDeepHash(uuid_);
   result = result * 31 + PigeonInternalDeepHash(properties_);
+  result = result * 31 + PigeonInternalDeepHash(handle_);
   return result;
 }
 
@@ -1061,165 +1108,1895 @@ size_t PigeonInternalDeepHash(const BtGattWriteRequest& v) {
   return v.Hash();
 }
 
+// BtDeviceDelta
 
-PigeonInternalCodecSerializer::PigeonInternalCodecSerializer() {}
+BtDeviceDelta::BtDeviceDelta(
+  const std::string& mac_address,
+  int64_t changed_fields)
+ : mac_address_(mac_address),
+    changed_fields_(changed_fields) {}
 
-EncodableValue PigeonInternalCodecSerializer::ReadValueOfType(
-  uint8_t type,
-  ::flutter::ByteStreamReader* stream) const {
-  switch (type) {
-    case 129: {
-        return CustomEncodableValue(BtStatus::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
-      }
-    case 130: {
-        return CustomEncodableValue(BtDevice::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
-      }
-    case 131: {
-        return CustomEncodableValue(BtManufacturerData::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
-      }
-    case 132: {
-        return CustomEncodableValue(BtServiceData::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
-      }
-    case 133: {
-        return CustomEncodableValue(BtService::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
-      }
-    case 134: {
-        return CustomEncodableValue(BtCharacteristic::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
-      }
-    case 135: {
-        return CustomEncodableValue(BtCharacteristicNotification::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
-      }
-    case 136: {
-        return CustomEncodableValue(BtGattReadRequest::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
-      }
-    case 137: {
-        return CustomEncodableValue(BtGattWriteRequest::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
-      }
-    default:
-      return ::flutter::StandardCodecSerializer::ReadValueOfType(type, stream);
-    }
+BtDeviceDelta::BtDeviceDelta(
+  const std::string& mac_address,
+  int64_t changed_fields,
+  const std::string* name,
+  const int64_t* rssi,
+  const int64_t* tx_power,
+  const EncodableList* manufacturer_data,
+  const EncodableList* service_data,
+  const int64_t* address_type)
+ : mac_address_(mac_address),
+    changed_fields_(changed_fields),
+    name_(name ? std::optional<std::string>(*name) : std::nullopt),
+    rssi_(rssi ? std::optional<int64_t>(*rssi) : std::nullopt),
+    tx_power_(tx_power ? std::optional<int64_t>(*tx_power) : std::nullopt),
+    manufacturer_data_(manufacturer_data ? std::optional<::flutter::EncodableList>(*manufacturer_data) : std::nullopt),
+    service_data_(service_data ? std::optional<::flutter::EncodableList>(*service_data) : std::nullopt),
+    address_type_(address_type ? std::optional<int64_t>(*address_type) : std::nullopt) {}
+
+const std::string& BtDeviceDelta::mac_address() const {
+  return mac_address_;
 }
 
-void PigeonInternalCodecSerializer::WriteValue(
-  const EncodableValue& value,
-  ::flutter::ByteStreamWriter* stream) const {
-  if (const CustomEncodableValue* custom_value = std::get_if<CustomEncodableValue>(&value)) {
-    if (custom_value->type() == typeid(BtStatus)) {
-      stream->WriteByte(129);
-      WriteValue(EncodableValue(std::any_cast<BtStatus>(*custom_value).ToEncodableList()), stream);
-      return;
-    }
-    if (custom_value->type() == typeid(BtDevice)) {
-      stream->WriteByte(130);
-      WriteValue(EncodableValue(std::any_cast<BtDevice>(*custom_value).ToEncodableList()), stream);
-      return;
-    }
-    if (custom_value->type() == typeid(BtManufacturerData)) {
-      stream->WriteByte(131);
-      WriteValue(EncodableValue(std::any_cast<BtManufacturerData>(*custom_value).ToEncodableList()), stream);
-      return;
-    }
-    if (custom_value->type() == typeid(BtServiceData)) {
-      stream->WriteByte(132);
-      WriteValue(EncodableValue(std::any_cast<BtServiceData>(*custom_value).ToEncodableList()), stream);
-      return;
-    }
-    if (custom_value->type() == typeid(BtService)) {
-      stream->WriteByte(133);
-      WriteValue(EncodableValue(std::any_cast<BtService>(*custom_value).ToEncodableList()), stream);
-      return;
-    }
-    if (custom_value->type() == typeid(BtCharacteristic)) {
-      stream->WriteByte(134);
-      WriteValue(EncodableValue(std::any_cast<BtCharacteristic>(*custom_value).ToEncodableList()), stream);
-      return;
-    }
-    if (custom_value->type() == typeid(BtCharacteristicNotification)) {
-      stream->WriteByte(135);
-      WriteValue(EncodableValue(std::any_cast<BtCharacteristicNotification>(*custom_value).ToEncodableList()), stream);
-      return;
-    }
-    if (custom_value->type() == typeid(BtGattReadRequest)) {
-      stream->WriteByte(136);
-      WriteValue(EncodableValue(std::any_cast<BtGattReadRequest>(*custom_value).ToEncodableList()), stream);
-      return;
-    }
-    if (custom_value->type() == typeid(BtGattWriteRequest)) {
-      stream->WriteByte(137);
-      WriteValue(EncodableValue(std::any_cast<BtGattWriteRequest>(*custom_value).ToEncodableList()), stream);
-      return;
-    }
-  }
-  ::flutter::StandardCodecSerializer::WriteValue(value, stream);
+void BtDeviceDelta::set_mac_address(std::string_view value_arg) {
+  mac_address_ = value_arg;
 }
 
-/// The codec used by LayrzBlePlatformChannel.
-const ::flutter::StandardMessageCodec& LayrzBlePlatformChannel::GetCodec() {
-  return ::flutter::StandardMessageCodec::GetInstance(&PigeonInternalCodecSerializer::GetInstance());
+
+int64_t BtDeviceDelta::changed_fields() const {
+  return changed_fields_;
 }
 
-// Sets up an instance of `LayrzBlePlatformChannel` to handle messages through the `binary_messenger`.
-void LayrzBlePlatformChannel::SetUp(
-  ::flutter::BinaryMessenger* binary_messenger,
-  LayrzBlePlatformChannel* api) {
-  LayrzBlePlatformChannel::SetUp(binary_messenger, api, "");
+void BtDeviceDelta::set_changed_fields(int64_t value_arg) {
+  changed_fields_ = value_arg;
 }
 
-void LayrzBlePlatformChannel::SetUp(
-  ::flutter::BinaryMessenger* binary_messenger,
-  LayrzBlePlatformChannel* api,
-  const std::string& message_channel_suffix) {
-  const std::string prepended_suffix = message_channel_suffix.length() > 0 ? std::string(".") + message_channel_suffix : "";
-  {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getStatuses" + prepended_suffix, &GetCodec());
-    if (api != nullptr) {
-      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
-        try {
-          api->GetStatuses([reply](ErrorOr<BtStatus>&& output) {
-            if (output.has_error()) {
-              reply(WrapError(output.error()));
-              return;
-            }
-            EncodableList wrapped;
-            wrapped.push_back(CustomEncodableValue(std::move(output).TakeValue()));
-            reply(EncodableValue(std::move(wrapped)));
-          });
-        } catch (const std::exception& exception) {
-          reply(WrapError(exception.what()));
-        }
-      });
-    } else {
-      channel.SetMessageHandler(nullptr);
-    }
+
+const std::string* BtDeviceDelta::name() const {
+  return name_ ? &(*name_) : nullptr;
+}
+
+void BtDeviceDelta::set_name(const std::string_view* value_arg) {
+  name_ = value_arg ? std::optional<std::string>(*value_arg) : std::nullopt;
+}
+
+void BtDeviceDelta::set_name(std::string_view value_arg) {
+  name_ = value_arg;
+}
+
+
+const int64_t* BtDeviceDelta::rssi() const {
+  return rssi_ ? &(*rssi_) : nullptr;
+}
+
+void BtDeviceDelta::set_rssi(const int64_t* value_arg) {
+  rssi_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void BtDeviceDelta::set_rssi(int64_t value_arg) {
+  rssi_ = value_arg;
+}
+
+
+const int64_t* BtDeviceDelta::tx_power() const {
+  return tx_power_ ? &(*tx_power_) : nullptr;
+}
+
+void BtDeviceDelta::set_tx_power(const int64_t* value_arg) {
+  tx_power_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void BtDeviceDelta::set_tx_power(int64_t value_arg) {
+  tx_power_ = value_arg;
+}
+
+
+const EncodableList* BtDeviceDelta::manufacturer_data() const {
+  return manufacturer_data_ ? &(*manufacturer_data_) : nullptr;
+}
+
+void BtDeviceDelta::set_manufacturer_data(const EncodableList* value_arg) {
+  manufacturer_data_ = value_arg ? std::optional<EncodableList>(*value_arg) : std::nullopt;
+}
+
+void BtDeviceDelta::set_manufacturer_data(const EncodableList& value_arg) {
+  manufacturer_data_ = value_arg;
+}
+
+
+const EncodableList* BtDeviceDelta::service_data() const {
+  return service_data_ ? &(*service_data_) : nullptr;
+}
+
+void BtDeviceDelta::set_service_data(const EncodableList* value_arg) {
+  service_data_ = value_arg ? std::optional<EncodableList>(*value_arg) : std::nullopt;
+}
+
+void BtDeviceDelta::set_service_data(const EncodableList& value_arg) {
+  service_data_ = value_arg;
+}
+
+
+const int64_t* BtDeviceDelta::address_type() const {
+  return address_type_ ? &(*address_type_) : nullptr;
+}
+
+void BtDeviceDelta::set_address_type(const int64_t* value_arg) {
+  address_type_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void BtDeviceDelta::set_address_type(int64_t value_arg) {
+  address_type_ = value_arg;
+}
+
+
+EncodableList BtDeviceDelta::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(8);
+  list.push_back(EncodableValue(mac_address_));
+  list.push_back(EncodableValue(changed_fields_));
+  list.push_back(name_ ? EncodableValue(*name_) : EncodableValue());
+  list.push_back(rssi_ ? EncodableValue(*rssi_) : EncodableValue());
+  list.push_back(tx_power_ ? EncodableValue(*tx_power_) : EncodableValue());
+  list.push_back(manufacturer_data_ ? EncodableValue(*manufacturer_data_) : EncodableValue());
+  list.push_back(service_data_ ? EncodableValue(*service_data_) : EncodableValue());
+  list.push_back(address_type_ ? EncodableValue(*address_type_) : EncodableValue());
+  return list;
+}
+
+BtDeviceDelta BtDeviceDelta::FromEncodableList(const EncodableList& list) {
+  BtDeviceDelta decoded(
+    std::get<std::string>(list[0]),
+    std::get<int64_t>(list[1]));
+  auto& encodable_name = list[2];
+  if (!encodable_name.IsNull()) {
+    decoded.set_name(std::get<std::string>(encodable_name));
   }
-  {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.checkCapabilities" + prepended_suffix, &GetCodec());
-    if (api != nullptr) {
-      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
-        try {
-          api->CheckCapabilities([reply](ErrorOr<bool>&& output) {
-            if (output.has_error()) {
-              reply(WrapError(output.error()));
-              return;
-            }
-            EncodableList wrapped;
-            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
-            reply(EncodableValue(std::move(wrapped)));
-          });
-        } catch (const std::exception& exception) {
-          reply(WrapError(exception.what()));
-        }
-      });
-    } else {
-      channel.SetMessageHandler(nullptr);
-    }
+  auto& encodable_rssi = list[3];
+  if (!encodable_rssi.IsNull()) {
+    decoded.set_rssi(std::get<int64_t>(encodable_rssi));
   }
-  {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.checkScanPermissions" + prepended_suffix, &GetCodec());
-    if (api != nullptr) {
-      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+  auto& encodable_tx_power = list[4];
+  if (!encodable_tx_power.IsNull()) {
+    decoded.set_tx_power(std::get<int64_t>(encodable_tx_power));
+  }
+  auto& encodable_manufacturer_data = list[5];
+  if (!encodable_manufacturer_data.IsNull()) {
+    decoded.set_manufacturer_data(std::get<EncodableList>(encodable_manufacturer_data));
+  }
+  auto& encodable_service_data = list[6];
+  if (!encodable_service_data.IsNull()) {
+    decoded.set_service_data(std::get<EncodableList>(encodable_service_data));
+  }
+  auto& encodable_address_type = list[7];
+  if (!encodable_address_type.IsNull()) {
+    decoded.set_address_type(std::get<int64_t>(encodable_address_type));
+  }
+  return decoded;
+}
+
+bool BtDeviceDelta::operator==(const BtDeviceDelta& other) const {
+  return PigeonInternalDeepEquals(mac_address_, other.mac_address_) && PigeonInternalDeepEquals(changed_fields_, other.changed_fields_) && PigeonInternalDeepEquals(name_, other.name_) && PigeonInternalDeepEquals(rssi_, other.rssi_) && PigeonInternalDeepEquals(tx_power_, other.tx_power_) && PigeonInternalDeepEquals(manufacturer_data_, other.manufacturer_data_) && PigeonInternalDeepEquals(service_data_, other.service_data_) && PigeonInternalDeepEquals(address_type_, other.address_type_);
+}
+
+bool BtDeviceDelta::operator!=(const BtDeviceDelta& other) const {
+  return !(*this == other);
+}
+
+size_t BtDeviceDelta::Hash() const {
+  size_t result = 1;
+  result = result * 31 + PigeonInternalDeepHash(mac_address_);
+  result = result * 31 + PigeonInternalDeepHash(changed_fields_);
+  result = result * 31 + PigeonInternalDeepHash(name_);
+  result = result * 31 + PigeonInternalDeepHash(rssi_);
+  result = result * 31 + PigeonInternalDeepHash(tx_power_);
+  result = result * 31 + PigeonInternalDeepHash(manufacturer_data_);
+  result = result * 31 + PigeonInternalDeepHash(service_data_);
+  result = result * 31 + PigeonInternalDeepHash(address_type_);
+  return result;
+}
+
+size_t PigeonInternalDeepHash(const BtDeviceDelta& v) {
+  return v.Hash();
+}
+
+// BtScanCacheStats
+
+BtScanCacheStats::BtScanCacheStats(
+  int64_t devices,
+  int64_t max_devices,
+  int64_t device_ttl_ms,
+  int64_t evicted_by_ttl,
+  int64_t evicted_by_capacity,
+  int64_t approximate_bytes,
+  int64_t watcher_devices)
+ : devices_(devices),
+    max_devices_(max_devices),
+    device_ttl_ms_(device_ttl_ms),
+    evicted_by_ttl_(evicted_by_ttl),
+    evicted_by_capacity_(evicted_by_capacity),
+    approximate_bytes_(approximate_bytes),
+    watcher_devices_(watcher_devices) {}
+
+int64_t BtScanCacheStats::devices() const {
+  return devices_;
+}
+
+void BtScanCacheStats::set_devices(int64_t value_arg) {
+  devices_ = value_arg;
+}
+
+
+int64_t BtScanCacheStats::max_devices() const {
+  return max_devices_;
+}
+
+void BtScanCacheStats::set_max_devices(int64_t value_arg) {
+  max_devices_ = value_arg;
+}
+
+
+int64_t BtScanCacheStats::device_ttl_ms() const {
+  return device_ttl_ms_;
+}
+
+void BtScanCacheStats::set_device_ttl_ms(int64_t value_arg) {
+  device_ttl_ms_ = value_arg;
+}
+
+
+int64_t BtScanCacheStats::evicted_by_ttl() const {
+  return evicted_by_ttl_;
+}
+
+void BtScanCacheStats::set_evicted_by_ttl(int64_t value_arg) {
+  evicted_by_ttl_ = value_arg;
+}
+
+
+int64_t BtScanCacheStats::evicted_by_capacity() const {
+  return evicted_by_capacity_;
+}
+
+void BtScanCacheStats::set_evicted_by_capacity(int64_t value_arg) {
+  evicted_by_capacity_ = value_arg;
+}
+
+
+int64_t BtScanCacheStats::approximate_bytes() const {
+  return approximate_bytes_;
+}
+
+void BtScanCacheStats::set_approximate_bytes(int64_t value_arg) {
+  approximate_bytes_ = value_arg;
+}
+
+
+int64_t BtScanCacheStats::watcher_devices() const {
+  return watcher_devices_;
+}
+
+void BtScanCacheStats::set_watcher_devices(int64_t value_arg) {
+  watcher_devices_ = value_arg;
+}
+
+
+EncodableList BtScanCacheStats::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(7);
+  list.push_back(EncodableValue(devices_));
+  list.push_back(EncodableValue(max_devices_));
+  list.push_back(EncodableValue(device_ttl_ms_));
+  list.push_back(EncodableValue(evicted_by_ttl_));
+  list.push_back(EncodableValue(evicted_by_capacity_));
+  list.push_back(EncodableValue(approximate_bytes_));
+  list.push_back(EncodableValue(watcher_devices_));
+  return list;
+}
+
+BtScanCacheStats BtScanCacheStats::FromEncodableList(const EncodableList& list) {
+  BtScanCacheStats decoded(
+    std::get<int64_t>(list[0]),
+    std::get<int64_t>(list[1]),
+    std::get<int64_t>(list[2]),
+    std::get<int64_t>(list[3]),
+    std::get<int64_t>(list[4]),
+    std::get<int64_t>(list[5]),
+    std::get<int64_t>(list[6]));
+  return decoded;
+}
+
+bool BtScanCacheStats::operator==(const BtScanCacheStats& other) const {
+  return PigeonInternalDeepEquals(devices_, other.devices_) && PigeonInternalDeepEquals(max_devices_, other.max_devices_) && PigeonInternalDeepEquals(device_ttl_ms_, other.device_ttl_ms_) && PigeonInternalDeepEquals(evicted_by_ttl_, other.evicted_by_ttl_) && PigeonInternalDeepEquals(evicted_by_capacity_, other.evicted_by_capacity_) && PigeonInternalDeepEquals(approximate_bytes_, other.approximate_bytes_) && PigeonInternalDeepEquals(watcher_devices_, other.watcher_devices_);
+}
+
+bool BtScanCacheStats::operator!=(const BtScanCacheStats& other) const {
+  return !(*this == other);
+}
+
+size_t BtScanCacheStats::Hash() const {
+  size_t result = 1;
+  result = result * 31 + PigeonInternalDeepHash(devices_);
+  result = result * 31 + PigeonInternalDeepHash(max_devices_);
+  result = result * 31 + PigeonInternalDeepHash(device_ttl_ms_);
+  result = result * 31 + PigeonInternalDeepHash(evicted_by_ttl_);
+  result = result * 31 + PigeonInternalDeepHash(evicted_by_capacity_);
+  result = result * 31 + PigeonInternalDeepHash(approximate_bytes_);
+  result = result * 31 + PigeonInternalDeepHash(watcher_devices_);
+  return result;
+}
+
+size_t PigeonInternalDeepHash(const BtScanCacheStats& v) {
+  return v.Hash();
+}
+
+// BtManufacturerDataFilter
+
+BtManufacturerDataFilter::BtManufacturerDataFilter(
+  int64_t company_id,
+  int64_t offset,
+  const std::vector<uint8_t>& value,
+  int64_t group)
+ : company_id_(company_id),
+    offset_(offset),
+    value_(value),
+    group_(group) {}
+
+BtManufacturerDataFilter::BtManufacturerDataFilter(
+  int64_t company_id,
+  int64_t offset,
+  const std::vector<uint8_t>& value,
+  const std::vector<uint8_t>* mask,
+  int64_t group)
+ : company_id_(company_id),
+    offset_(offset),
+    value_(value),
+    mask_(mask ? std::optional<std::vector<uint8_t>>(*mask) : std::nullopt),
+    group_(group) {}
+
+int64_t BtManufacturerDataFilter::company_id() const {
+  return company_id_;
+}
+
+void BtManufacturerDataFilter::set_company_id(int64_t value_arg) {
+  company_id_ = value_arg;
+}
+
+
+int64_t BtManufacturerDataFilter::offset() const {
+  return offset_;
+}
+
+void BtManufacturerDataFilter::set_offset(int64_t value_arg) {
+  offset_ = value_arg;
+}
+
+
+const std::vector<uint8_t>& BtManufacturerDataFilter::value() const {
+  return value_;
+}
+
+void BtManufacturerDataFilter::set_value(const std::vector<uint8_t>& value_arg) {
+  value_ = value_arg;
+}
+
+
+const std::vector<uint8_t>* BtManufacturerDataFilter::mask() const {
+  return mask_ ? &(*mask_) : nullptr;
+}
+
+void BtManufacturerDataFilter::set_mask(const std::vector<uint8_t>* value_arg) {
+  mask_ = value_arg ? std::optional<std::vector<uint8_t>>(*value_arg) : std::nullopt;
+}
+
+void BtManufacturerDataFilter::set_mask(const std::vector<uint8_t>& value_arg) {
+  mask_ = value_arg;
+}
+
+
+int64_t BtManufacturerDataFilter::group() const {
+  return group_;
+}
+
+void BtManufacturerDataFilter::set_group(int64_t value_arg) {
+  group_ = value_arg;
+}
+
+
+EncodableList BtManufacturerDataFilter::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(5);
+  list.push_back(EncodableValue(company_id_));
+  list.push_back(EncodableValue(offset_));
+  list.push_back(EncodableValue(value_));
+  list.push_back(mask_ ? EncodableValue(*mask_) : EncodableValue());
+  list.push_back(EncodableValue(group_));
+  return list;
+}
+
+BtManufacturerDataFilter BtManufacturerDataFilter::FromEncodableList(const EncodableList& list) {
+  BtManufacturerDataFilter decoded(
+    std::get<int64_t>(list[0]),
+    std::get<int64_t>(list[1]),
+    std::get<std::vector<uint8_t>>(list[2]),
+    std::get<int64_t>(list[4]));
+  auto& encodable_mask = list[3];
+  if (!encodable_mask.IsNull()) {
+    decoded.set_mask(std::get<std::vector<uint8_t>>(encodable_mask));
+  }
+  return decoded;
+}
+
+bool BtManufacturerDataFilter::operator==(const BtManufacturerDataFilter& other) const {
+  return PigeonInternalDeepEquals(company_id_, other.company_id_) && PigeonInternalDeepEquals(offset_, other.offset_) && PigeonInternalDeepEquals(value_, other.value_) && PigeonInternalDeepEquals(mask_, other.mask_) && PigeonInternalDeepEquals(group_, other.group_);
+}
+
+bool BtManufacturerDataFilter::operator!=(const BtManufacturerDataFilter& other) const {
+  return !(*this == other);
+}
+
+size_t BtManufacturerDataFilter::Hash() const {
+  size_t result = 1;
+  result = result * 31 + PigeonInternalDeepHash(company_id_);
+  result = result * 31 + PigeonInternalDeepHash(offset_);
+  result = result * 31 + PigeonInternalDeepHash(value_);
+  result = result * 31 + PigeonInternalDeepHash(mask_);
+  result = result * 31 + PigeonInternalDeepHash(group_);
+  return result;
+}
+
+size_t PigeonInternalDeepHash(const BtManufacturerDataFilter& v) {
+  return v.Hash();
+}
+
+// BtScanMetrics
+
+BtScanMetrics::BtScanMetrics(
+  int64_t received,
+  int64_t dropped,
+  int64_t filtered,
+  int64_t duplicates,
+  int64_t merged,
+  int64_t coalesced,
+  int64_t encoded,
+  int64_t posted,
+  const EncodableList& ingest_latency_buckets,
+  int64_t ingest_latency_max_us,
+  const EncodableList& post_latency_buckets,
+  int64_t post_latency_max_us)
+ : received_(received),
+    dropped_(dropped),
+    filtered_(filtered),
+    duplicates_(duplicates),
+    merged_(merged),
+    coalesced_(coalesced),
+    encoded_(encoded),
+    posted_(posted),
+    ingest_latency_buckets_(ingest_latency_buckets),
+    ingest_latency_max_us_(ingest_latency_max_us),
+    post_latency_buckets_(post_latency_buckets),
+    post_latency_max_us_(post_latency_max_us) {}
+
+int64_t BtScanMetrics::received() const {
+  return received_;
+}
+
+void BtScanMetrics::set_received(int64_t value_arg) {
+  received_ = value_arg;
+}
+
+
+int64_t BtScanMetrics::dropped() const {
+  return dropped_;
+}
+
+void BtScanMetrics::set_dropped(int64_t value_arg) {
+  dropped_ = value_arg;
+}
+
+
+int64_t BtScanMetrics::filtered() const {
+  return filtered_;
+}
+
+void BtScanMetrics::set_filtered(int64_t value_arg) {
+  filtered_ = value_arg;
+}
+
+
+int64_t BtScanMetrics::duplicates() const {
+  return duplicates_;
+}
+
+void BtScanMetrics::set_duplicates(int64_t value_arg) {
+  duplicates_ = value_arg;
+}
+
+
+int64_t BtScanMetrics::merged() const {
+  return merged_;
+}
+
+void BtScanMetrics::set_merged(int64_t value_arg) {
+  merged_ = value_arg;
+}
+
+
+int64_t BtScanMetrics::coalesced() const {
+  return coalesced_;
+}
+
+void BtScanMetrics::set_coalesced(int64_t value_arg) {
+  coalesced_ = value_arg;
+}
+
+
+int64_t BtScanMetrics::encoded() const {
+  return encoded_;
+}
+
+void BtScanMetrics::set_encoded(int64_t value_arg) {
+  encoded_ = value_arg;
+}
+
+
+int64_t BtScanMetrics::posted() const {
+  return posted_;
+}
+
+void BtScanMetrics::set_posted(int64_t value_arg) {
+  posted_ = value_arg;
+}
+
+
+const EncodableList& BtScanMetrics::ingest_latency_buckets() const {
+  return ingest_latency_buckets_;
+}
+
+void BtScanMetrics::set_ingest_latency_buckets(const EncodableList& value_arg) {
+  ingest_latency_buckets_ = value_arg;
+}
+
+
+int64_t BtScanMetrics::ingest_latency_max_us() const {
+  return ingest_latency_max_us_;
+}
+
+void BtScanMetrics::set_ingest_latency_max_us(int64_t value_arg) {
+  ingest_latency_max_us_ = value_arg;
+}
+
+
+const EncodableList& BtScanMetrics::post_latency_buckets() const {
+  return post_latency_buckets_;
+}
+
+void BtScanMetrics::set_post_latency_buckets(const EncodableList& value_arg) {
+  post_latency_buckets_ = value_arg;
+}
+
+
+int64_t BtScanMetrics::post_latency_max_us() const {
+  return post_latency_max_us_;
+}
+
+void BtScanMetrics::set_post_latency_max_us(int64_t value_arg) {
+  post_latency_max_us_ = value_arg;
+}
+
+
+EncodableList BtScanMetrics::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(12);
+  list.push_back(EncodableValue(received_));
+  list.push_back(EncodableValue(dropped_));
+  list.push_back(EncodableValue(filtered_));
+  list.push_back(EncodableValue(duplicates_));
+  list.push_back(EncodableValue(merged_));
+  list.push_back(EncodableValue(coalesced_));
+  list.push_back(EncodableValue(encoded_));
+  list.push_back(EncodableValue(posted_));
+  list.push_back(EncodableValue(ingest_latency_buckets_));
+  list.push_back(EncodableValue(ingest_latency_max_us_));
+  list.push_back(EncodableValue(post_latency_buckets_));
+  list.push_back(EncodableValue(post_latency_max_us_));
+  return list;
+}
+
+BtScanMetrics BtScanMetrics::FromEncodableList(const EncodableList& list) {
+  BtScanMetrics decoded(
+    std::get<int64_t>(list[0]),
+    std::get<int64_t>(list[1]),
+    std::get<int64_t>(list[2]),
+    std::get<int64_t>(list[3]),
+    std::get<int64_t>(list[4]),
+    std::get<int64_t>(list[5]),
+    std::get<int64_t>(list[6]),
+    std::get<int64_t>(list[7]),
+    std::get<EncodableList>(list[8]),
+    std::get<int64_t>(list[9]),
+    std::get<EncodableList>(list[10]),
+    std::get<int64_t>(list[11]));
+  return decoded;
+}
+
+bool BtScanMetrics::operator==(const BtScanMetrics& other) const {
+  return PigeonInternalDeepEquals(received_, other.received_) && PigeonInternalDeepEquals(dropped_, other.dropped_) && PigeonInternalDeepEquals(filtered_, other.filtered_) && PigeonInternalDeepEquals(duplicates_, other.duplicates_) && PigeonInternalDeepEquals(merged_, other.merged_) && PigeonInternalDeepEquals(coalesced_, other.coalesced_) && PigeonInternalDeepEquals(encoded_, other.encoded_) && PigeonInternalDeepEquals(posted_, other.posted_) && PigeonInternalDeepEquals(ingest_latency_buckets_, other.ingest_latency_buckets_) && PigeonInternalDeepEquals(ingest_latency_max_us_, other.ingest_latency_max_us_) && PigeonInternalDeepEquals(post_latency_buckets_, other.post_latency_buckets_) && PigeonInternalDeepEquals(post_latency_max_us_, other.post_latency_max_us_);
+}
+
+bool BtScanMetrics::operator!=(const BtScanMetrics& other) const {
+  return !(*this == other);
+}
+
+size_t BtScanMetrics::Hash() const {
+  size_t result = 1;
+  result = result * 31 + PigeonInternalDeepHash(received_);
+  result = result * 31 + PigeonInternalDeepHash(dropped_);
+  result = result * 31 + PigeonInternalDeepHash(filtered_);
+  result = result * 31 + PigeonInternalDeepHash(duplicates_);
+  result = result * 31 + PigeonInternalDeepHash(merged_);
+  result = result * 31 + PigeonInternalDeepHash(coalesced_);
+  result = result * 31 + PigeonInternalDeepHash(encoded_);
+  result = result * 31 + PigeonInternalDeepHash(posted_);
+  result = result * 31 + PigeonInternalDeepHash(ingest_latency_buckets_);
+  result = result * 31 + PigeonInternalDeepHash(ingest_latency_max_us_);
+  result = result * 31 + PigeonInternalDeepHash(post_latency_buckets_);
+  result = result * 31 + PigeonInternalDeepHash(post_latency_max_us_);
+  return result;
+}
+
+size_t PigeonInternalDeepHash(const BtScanMetrics& v) {
+  return v.Hash();
+}
+
+// BtScanQueueStats
+
+BtScanQueueStats::BtScanQueueStats(
+  int64_t policy,
+  int64_t capacity,
+  int64_t depth,
+  int64_t high_watermark,
+  int64_t queued_events,
+  int64_t delivered_events,
+  int64_t dropped_events,
+  int64_t dropped_devices,
+  int64_t deferred_flushes,
+  int64_t pauses,
+  int64_t paused_advertisements)
+ : policy_(policy),
+    capacity_(capacity),
+    depth_(depth),
+    high_watermark_(high_watermark),
+    queued_events_(queued_events),
+    delivered_events_(delivered_events),
+    dropped_events_(dropped_events),
+    dropped_devices_(dropped_devices),
+    deferred_flushes_(deferred_flushes),
+    pauses_(pauses),
+    paused_advertisements_(paused_advertisements) {}
+
+int64_t BtScanQueueStats::policy() const {
+  return policy_;
+}
+
+void BtScanQueueStats::set_policy(int64_t value_arg) {
+  policy_ = value_arg;
+}
+
+
+int64_t BtScanQueueStats::capacity() const {
+  return capacity_;
+}
+
+void BtScanQueueStats::set_capacity(int64_t value_arg) {
+  capacity_ = value_arg;
+}
+
+
+int64_t BtScanQueueStats::depth() const {
+  return depth_;
+}
+
+void BtScanQueueStats::set_depth(int64_t value_arg) {
+  depth_ = value_arg;
+}
+
+
+int64_t BtScanQueueStats::high_watermark() const {
+  return high_watermark_;
+}
+
+void BtScanQueueStats::set_high_watermark(int64_t value_arg) {
+  high_watermark_ = value_arg;
+}
+
+
+int64_t BtScanQueueStats::queued_events() const {
+  return queued_events_;
+}
+
+void BtScanQueueStats::set_queued_events(int64_t value_arg) {
+  queued_events_ = value_arg;
+}
+
+
+int64_t BtScanQueueStats::delivered_events() const {
+  return delivered_events_;
+}
+
+void BtScanQueueStats::set_delivered_events(int64_t value_arg) {
+  delivered_events_ = value_arg;
+}
+
+
+int64_t BtScanQueueStats::dropped_events() const {
+  return dropped_events_;
+}
+
+void BtScanQueueStats::set_dropped_events(int64_t value_arg) {
+  dropped_events_ = value_arg;
+}
+
+
+int64_t BtScanQueueStats::dropped_devices() const {
+  return dropped_devices_;
+}
+
+void BtScanQueueStats::set_dropped_devices(int64_t value_arg) {
+  dropped_devices_ = value_arg;
+}
+
+
+int64_t BtScanQueueStats::deferred_flushes() const {
+  return deferred_flushes_;
+}
+
+void BtScanQueueStats::set_deferred_flushes(int64_t value_arg) {
+  deferred_flushes_ = value_arg;
+}
+
+
+int64_t BtScanQueueStats::pauses() const {
+  return pauses_;
+}
+
+void BtScanQueueStats::set_pauses(int64_t value_arg) {
+  pauses_ = value_arg;
+}
+
+
+int64_t BtScanQueueStats::paused_advertisements() const {
+  return paused_advertisements_;
+}
+
+void BtScanQueueStats::set_paused_advertisements(int64_t value_arg) {
+  paused_advertisements_ = value_arg;
+}
+
+
+EncodableList BtScanQueueStats::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(11);
+  list.push_back(EncodableValue(policy_));
+  list.push_back(EncodableValue(capacity_));
+  list.push_back(EncodableValue(depth_));
+  list.push_back(EncodableValue(high_watermark_));
+  list.push_back(EncodableValue(queued_events_));
+  list.push_back(EncodableValue(delivered_events_));
+  list.push_back(EncodableValue(dropped_events_));
+  list.push_back(EncodableValue(dropped_devices_));
+  list.push_back(EncodableValue(deferred_flushes_));
+  list.push_back(EncodableValue(pauses_));
+  list.push_back(EncodableValue(paused_advertisements_));
+  return list;
+}
+
+BtScanQueueStats BtScanQueueStats::FromEncodableList(const EncodableList& list) {
+  BtScanQueueStats decoded(
+    std::get<int64_t>(list[0]),
+    std::get<int64_t>(list[1]),
+    std::get<int64_t>(list[2]),
+    std::get<int64_t>(list[3]),
+    std::get<int64_t>(list[4]),
+    std::get<int64_t>(list[5]),
+    std::get<int64_t>(list[6]),
+    std::get<int64_t>(list[7]),
+    std::get<int64_t>(list[8]),
+    std::get<int64_t>(list[9]),
+    std::get<int64_t>(list[10]));
+  return decoded;
+}
+
+bool BtScanQueueStats::operator==(const BtScanQueueStats& other) const {
+  return PigeonInternalDeepEquals(policy_, other.policy_) && PigeonInternalDeepEquals(capacity_, other.capacity_) && PigeonInternalDeepEquals(depth_, other.depth_) && PigeonInternalDeepEquals(high_watermark_, other.high_watermark_) && PigeonInternalDeepEquals(queued_events_, other.queued_events_) && PigeonInternalDeepEquals(delivered_events_, other.delivered_events_) && PigeonInternalDeepEquals(dropped_events_, other.dropped_events_) && PigeonInternalDeepEquals(dropped_devices_, other.dropped_devices_) && PigeonInternalDeepEquals(deferred_flushes_, other.deferred_flushes_) && PigeonInternalDeepEquals(pauses_, other.pauses_) && PigeonInternalDeepEquals(paused_advertisements_, other.paused_advertisements_);
+}
+
+bool BtScanQueueStats::operator!=(const BtScanQueueStats& other) const {
+  return !(*this == other);
+}
+
+size_t BtScanQueueStats::Hash() const {
+  size_t result = 1;
+  result = result * 31 + PigeonInternalDeepHash(policy_);
+  result = result * 31 + PigeonInternalDeepHash(capacity_);
+  result = result * 31 + PigeonInternalDeepHash(depth_);
+  result = result * 31 + PigeonInternalDeepHash(high_watermark_);
+  result = result * 31 + PigeonInternalDeepHash(queued_events_);
+  result = result * 31 + PigeonInternalDeepHash(delivered_events_);
+  result = result * 31 + PigeonInternalDeepHash(dropped_events_);
+  result = result * 31 + PigeonInternalDeepHash(dropped_devices_);
+  result = result * 31 + PigeonInternalDeepHash(deferred_flushes_);
+  result = result * 31 + PigeonInternalDeepHash(pauses_);
+  result = result * 31 + PigeonInternalDeepHash(paused_advertisements_);
+  return result;
+}
+
+size_t PigeonInternalDeepHash(const BtScanQueueStats& v) {
+  return v.Hash();
+}
+
+// BtAdvertisingInfo
+
+BtAdvertisingInfo::BtAdvertisingInfo(
+  bool extended,
+  int64_t primary_phy,
+  int64_t secondary_phy,
+  int64_t advertising_sid,
+  int64_t max_payload_length)
+ : extended_(extended),
+    primary_phy_(primary_phy),
+    secondary_phy_(secondary_phy),
+    advertising_sid_(advertising_sid),
+    max_payload_length_(max_payload_length) {}
+
+bool BtAdvertisingInfo::extended() const {
+  return extended_;
+}
+
+void BtAdvertisingInfo::set_extended(bool value_arg) {
+  extended_ = value_arg;
+}
+
+
+int64_t BtAdvertisingInfo::primary_phy() const {
+  return primary_phy_;
+}
+
+void BtAdvertisingInfo::set_primary_phy(int64_t value_arg) {
+  primary_phy_ = value_arg;
+}
+
+
+int64_t BtAdvertisingInfo::secondary_phy() const {
+  return secondary_phy_;
+}
+
+void BtAdvertisingInfo::set_secondary_phy(int64_t value_arg) {
+  secondary_phy_ = value_arg;
+}
+
+
+int64_t BtAdvertisingInfo::advertising_sid() const {
+  return advertising_sid_;
+}
+
+void BtAdvertisingInfo::set_advertising_sid(int64_t value_arg) {
+  advertising_sid_ = value_arg;
+}
+
+
+int64_t BtAdvertisingInfo::max_payload_length() const {
+  return max_payload_length_;
+}
+
+void BtAdvertisingInfo::set_max_payload_length(int64_t value_arg) {
+  max_payload_length_ = value_arg;
+}
+
+
+EncodableList BtAdvertisingInfo::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(5);
+  list.push_back(EncodableValue(extended_));
+  list.push_back(EncodableValue(primary_phy_));
+  list.push_back(EncodableValue(secondary_phy_));
+  list.push_back(EncodableValue(advertising_sid_));
+  list.push_back(EncodableValue(max_payload_length_));
+  return list;
+}
+
+BtAdvertisingInfo BtAdvertisingInfo::FromEncodableList(const EncodableList& list) {
+  BtAdvertisingInfo decoded(
+    std::get<bool>(list[0]),
+    std::get<int64_t>(list[1]),
+    std::get<int64_t>(list[2]),
+    std::get<int64_t>(list[3]),
+    std::get<int64_t>(list[4]));
+  return decoded;
+}
+
+bool BtAdvertisingInfo::operator==(const BtAdvertisingInfo& other) const {
+  return PigeonInternalDeepEquals(extended_, other.extended_) && PigeonInternalDeepEquals(primary_phy_, other.primary_phy_) && PigeonInternalDeepEquals(secondary_phy_, other.secondary_phy_) && PigeonInternalDeepEquals(advertising_sid_, other.advertising_sid_) && PigeonInternalDeepEquals(max_payload_length_, other.max_payload_length_);
+}
+
+bool BtAdvertisingInfo::operator!=(const BtAdvertisingInfo& other) const {
+  return !(*this == other);
+}
+
+size_t BtAdvertisingInfo::Hash() const {
+  size_t result = 1;
+  result = result * 31 + PigeonInternalDeepHash(extended_);
+  result = result * 31 + PigeonInternalDeepHash(primary_phy_);
+  result = result * 31 + PigeonInternalDeepHash(secondary_phy_);
+  result = result * 31 + PigeonInternalDeepHash(advertising_sid_);
+  result = result * 31 + PigeonInternalDeepHash(max_payload_length_);
+  return result;
+}
+
+size_t PigeonInternalDeepHash(const BtAdvertisingInfo& v) {
+  return v.Hash();
+}
+
+// BtConnectTimings
+
+BtConnectTimings::BtConnectTimings(
+  int64_t resolve_us,
+  int64_t services_us,
+  int64_t characteristics_us,
+  int64_t slowest_service_us,
+  int64_t total_us,
+  int64_t services,
+  int64_t characteristics,
+  int64_t failed_services,
+  int64_t concurrency)
+ : resolve_us_(resolve_us),
+    services_us_(services_us),
+    characteristics_us_(characteristics_us),
+    slowest_service_us_(slowest_service_us),
+    total_us_(total_us),
+    services_(services),
+    characteristics_(characteristics),
+    failed_services_(failed_services),
+    concurrency_(concurrency) {}
+
+int64_t BtConnectTimings::resolve_us() const {
+  return resolve_us_;
+}
+
+void BtConnectTimings::set_resolve_us(int64_t value_arg) {
+  resolve_us_ = value_arg;
+}
+
+
+int64_t BtConnectTimings::services_us() const {
+  return services_us_;
+}
+
+void BtConnectTimings::set_services_us(int64_t value_arg) {
+  services_us_ = value_arg;
+}
+
+
+int64_t BtConnectTimings::characteristics_us() const {
+  return characteristics_us_;
+}
+
+void BtConnectTimings::set_characteristics_us(int64_t value_arg) {
+  characteristics_us_ = value_arg;
+}
+
+
+int64_t BtConnectTimings::slowest_service_us() const {
+  return slowest_service_us_;
+}
+
+void BtConnectTimings::set_slowest_service_us(int64_t value_arg) {
+  slowest_service_us_ = value_arg;
+}
+
+
+int64_t BtConnectTimings::total_us() const {
+  return total_us_;
+}
+
+void BtConnectTimings::set_total_us(int64_t value_arg) {
+  total_us_ = value_arg;
+}
+
+
+int64_t BtConnectTimings::services() const {
+  return services_;
+}
+
+void BtConnectTimings::set_services(int64_t value_arg) {
+  services_ = value_arg;
+}
+
+
+int64_t BtConnectTimings::characteristics() const {
+  return characteristics_;
+}
+
+void BtConnectTimings::set_characteristics(int64_t value_arg) {
+  characteristics_ = value_arg;
+}
+
+
+int64_t BtConnectTimings::failed_services() const {
+  return failed_services_;
+}
+
+void BtConnectTimings::set_failed_services(int64_t value_arg) {
+  failed_services_ = value_arg;
+}
+
+
+int64_t BtConnectTimings::concurrency() const {
+  return concurrency_;
+}
+
+void BtConnectTimings::set_concurrency(int64_t value_arg) {
+  concurrency_ = value_arg;
+}
+
+
+EncodableList BtConnectTimings::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(9);
+  list.push_back(EncodableValue(resolve_us_));
+  list.push_back(EncodableValue(services_us_));
+  list.push_back(EncodableValue(characteristics_us_));
+  list.push_back(EncodableValue(slowest_service_us_));
+  list.push_back(EncodableValue(total_us_));
+  list.push_back(EncodableValue(services_));
+  list.push_back(EncodableValue(characteristics_));
+  list.push_back(EncodableValue(failed_services_));
+  list.push_back(EncodableValue(concurrency_));
+  return list;
+}
+
+BtConnectTimings BtConnectTimings::FromEncodableList(const EncodableList& list) {
+  BtConnectTimings decoded(
+    std::get<int64_t>(list[0]),
+    std::get<int64_t>(list[1]),
+    std::get<int64_t>(list[2]),
+    std::get<int64_t>(list[3]),
+    std::get<int64_t>(list[4]),
+    std::get<int64_t>(list[5]),
+    std::get<int64_t>(list[6]),
+    std::get<int64_t>(list[7]),
+    std::get<int64_t>(list[8]));
+  return decoded;
+}
+
+bool BtConnectTimings::operator==(const BtConnectTimings& other) const {
+  return PigeonInternalDeepEquals(resolve_us_, other.resolve_us_) && PigeonInternalDeepEquals(services_us_, other.services_us_) && PigeonInternalDeepEquals(characteristics_us_, other.characteristics_us_) && PigeonInternalDeepEquals(slowest_service_us_, other.slowest_service_us_) && PigeonInternalDeepEquals(total_us_, other.total_us_) && PigeonInternalDeepEquals(services_, other.services_) && PigeonInternalDeepEquals(characteristics_, other.characteristics_) && PigeonInternalDeepEquals(failed_services_, other.failed_services_) && PigeonInternalDeepEquals(concurrency_, other.concurrency_);
+}
+
+bool BtConnectTimings::operator!=(const BtConnectTimings& other) const {
+  return !(*this == other);
+}
+
+size_t BtConnectTimings::Hash() const {
+  size_t result = 1;
+  result = result * 31 + PigeonInternalDeepHash(resolve_us_);
+  result = result * 31 + PigeonInternalDeepHash(services_us_);
+  result = result * 31 + PigeonInternalDeepHash(characteristics_us_);
+  result = result * 31 + PigeonInternalDeepHash(slowest_service_us_);
+  result = result * 31 + PigeonInternalDeepHash(total_us_);
+  result = result * 31 + PigeonInternalDeepHash(services_);
+  result = result * 31 + PigeonInternalDeepHash(characteristics_);
+  result = result * 31 + PigeonInternalDeepHash(failed_services_);
+  result = result * 31 + PigeonInternalDeepHash(concurrency_);
+  return result;
+}
+
+size_t PigeonInternalDeepHash(const BtConnectTimings& v) {
+  return v.Hash();
+}
+
+
+PigeonInternalCodecSerializer::PigeonInternalCodecSerializer() {}
+
+EncodableValue PigeonInternalCodecSerializer::ReadValueOfType(
+  uint8_t type,
+  ::flutter::ByteStreamReader* stream) const {
+  switch (type) {
+    case 129: {
+        return CustomEncodableValue(BtStatus::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 130: {
+        return CustomEncodableValue(BtDevice::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 131: {
+        return CustomEncodableValue(BtManufacturerData::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 132: {
+        return CustomEncodableValue(BtServiceData::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 133: {
+        return CustomEncodableValue(BtService::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 134: {
+        return CustomEncodableValue(BtCharacteristic::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 135: {
+        return CustomEncodableValue(BtCharacteristicNotification::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 136: {
+        return CustomEncodableValue(BtGattReadRequest::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 137: {
+        return CustomEncodableValue(BtGattWriteRequest::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 138: {
+        return CustomEncodableValue(BtDeviceDelta::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 139: {
+        return CustomEncodableValue(BtScanCacheStats::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 140: {
+        return CustomEncodableValue(BtManufacturerDataFilter::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 141: {
+        return CustomEncodableValue(BtScanMetrics::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 142: {
+        return CustomEncodableValue(BtScanQueueStats::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 143: {
+        return CustomEncodableValue(BtAdvertisingInfo::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 144: {
+        return CustomEncodableValue(BtConnectTimings::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    default:
+      return ::flutter::StandardCodecSerializer::ReadValueOfType(type, stream);
+    }
+}
+
+void PigeonInternalCodecSerializer::WriteValue(
+  const EncodableValue& value,
+  ::flutter::ByteStreamWriter* stream) const {
+  if (const CustomEncodableValue* custom_value = std::get_if<CustomEncodableValue>(&value)) {
+    if (custom_value->type() == typeid(BtStatus)) {
+      stream->WriteByte(129);
+      WriteValue(EncodableValue(std::any_cast<BtStatus>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BtDevice)) {
+      stream->WriteByte(130);
+      WriteValue(EncodableValue(std::any_cast<BtDevice>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BtManufacturerData)) {
+      stream->WriteByte(131);
+      WriteValue(EncodableValue(std::any_cast<BtManufacturerData>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BtServiceData)) {
+      stream->WriteByte(132);
+      WriteValue(EncodableValue(std::any_cast<BtServiceData>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BtService)) {
+      stream->WriteByte(133);
+      WriteValue(EncodableValue(std::any_cast<BtService>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BtCharacteristic)) {
+      stream->WriteByte(134);
+      WriteValue(EncodableValue(std::any_cast<BtCharacteristic>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BtCharacteristicNotification)) {
+      stream->WriteByte(135);
+      WriteValue(EncodableValue(std::any_cast<BtCharacteristicNotification>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BtGattReadRequest)) {
+      stream->WriteByte(136);
+      WriteValue(EncodableValue(std::any_cast<BtGattReadRequest>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BtGattWriteRequest)) {
+      stream->WriteByte(137);
+      WriteValue(EncodableValue(std::any_cast<BtGattWriteRequest>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BtDeviceDelta)) {
+      stream->WriteByte(138);
+      WriteValue(EncodableValue(std::any_cast<BtDeviceDelta>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BtScanCacheStats)) {
+      stream->WriteByte(139);
+      WriteValue(EncodableValue(std::any_cast<BtScanCacheStats>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BtManufacturerDataFilter)) {
+      stream->WriteByte(140);
+      WriteValue(EncodableValue(std::any_cast<BtManufacturerDataFilter>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BtScanMetrics)) {
+      stream->WriteByte(141);
+      WriteValue(EncodableValue(std::any_cast<BtScanMetrics>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BtScanQueueStats)) {
+      stream->WriteByte(142);
+      WriteValue(EncodableValue(std::any_cast<BtScanQueueStats>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BtAdvertisingInfo)) {
+      stream->WriteByte(143);
+      WriteValue(EncodableValue(std::any_cast<BtAdvertisingInfo>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BtConnectTimings)) {
+      stream->WriteByte(144);
+      WriteValue(EncodableValue(std::any_cast<BtConnectTimings>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+  }
+  ::flutter::StandardCodecSerializer::WriteValue(value, stream);
+}
+
+/// The codec used by LayrzBlePlatformChannel.
+const ::flutter::StandardMessageCodec& LayrzBlePlatformChannel::GetCodec() {
+  return ::flutter::StandardMessageCodec::GetInstance(&PigeonInternalCodecSerializer::GetInstance());
+}
+
+// Sets up an instance of `LayrzBlePlatformChannel` to handle messages through the `binary_messenger`.
+void LayrzBlePlatformChannel::SetUp(
+  ::flutter::BinaryMessenger* binary_messenger,
+  LayrzBlePlatformChannel* api) {
+  LayrzBlePlatformChannel::SetUp(binary_messenger, api, "");
+}
+
+void LayrzBlePlatformChannel::SetUp(
+  ::flutter::BinaryMessenger* binary_messenger,
+  LayrzBlePlatformChannel* api,
+  const std::string& message_channel_suffix) {
+  const std::string prepended_suffix = message_channel_suffix.length() > 0 ? std::string(".") + message_channel_suffix : "";
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getStatuses" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->GetStatuses([reply](ErrorOr<BtStatus>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(CustomEncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.checkCapabilities" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->CheckCapabilities([reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.checkScanPermissions" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->CheckScanPermissions([reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.checkAdvertisePermissions" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->CheckAdvertisePermissions([reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.startScan" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_mac_address_arg = args.at(0);
+          const auto* mac_address_arg = std::get_if<std::string>(&encodable_mac_address_arg);
+          const auto& encodable_services_uuids_arg = args.at(1);
+          const auto* services_uuids_arg = std::get_if<EncodableList>(&encodable_services_uuids_arg);
+          api->StartScan(mac_address_arg, services_uuids_arg, [reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.stopScan" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_mac_address_arg = args.at(0);
+          const auto* mac_address_arg = std::get_if<std::string>(&encodable_mac_address_arg);
+          api->StopScan(mac_address_arg, [reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.connect" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_mac_address_arg = args.at(0);
+          if (encodable_mac_address_arg.IsNull()) {
+            reply(WrapError("mac_address_arg unexpectedly null."));
+            return;
+          }
+          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
+          api->Connect(mac_address_arg, [reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.disconnect" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_mac_address_arg = args.at(0);
+          const auto* mac_address_arg = std::get_if<std::string>(&encodable_mac_address_arg);
+          api->Disconnect(mac_address_arg, [reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setMtu" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_mac_address_arg = args.at(0);
+          if (encodable_mac_address_arg.IsNull()) {
+            reply(WrapError("mac_address_arg unexpectedly null."));
+            return;
+          }
+          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
+          const auto& encodable_new_mtu_arg = args.at(1);
+          if (encodable_new_mtu_arg.IsNull()) {
+            reply(WrapError("new_mtu_arg unexpectedly null."));
+            return;
+          }
+          const int64_t new_mtu_arg = encodable_new_mtu_arg.LongValue();
+          api->SetMtu(mac_address_arg, new_mtu_arg, [reply](ErrorOr<std::optional<int64_t>>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            auto output_optional = std::move(output).TakeValue();
+            if (output_optional) {
+              wrapped.push_back(EncodableValue(std::move(output_optional).value()));
+            } else {
+              wrapped.push_back(EncodableValue());
+            }
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.discoverServices" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_mac_address_arg = args.at(0);
+          if (encodable_mac_address_arg.IsNull()) {
+            reply(WrapError("mac_address_arg unexpectedly null."));
+            return;
+          }
+          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
+          api->DiscoverServices(mac_address_arg, [reply](ErrorOr<EncodableList>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.readCharacteristic" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_mac_address_arg = args.at(0);
+          if (encodable_mac_address_arg.IsNull()) {
+            reply(WrapError("mac_address_arg unexpectedly null."));
+            return;
+          }
+          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
+          const auto& encodable_service_uuid_arg = args.at(1);
+          if (encodable_service_uuid_arg.IsNull()) {
+            reply(WrapError("service_uuid_arg unexpectedly null."));
+            return;
+          }
+          const auto& service_uuid_arg = std::get<std::string>(encodable_service_uuid_arg);
+          const auto& encodable_characteristic_uuid_arg = args.at(2);
+          if (encodable_characteristic_uuid_arg.IsNull()) {
+            reply(WrapError("characteristic_uuid_arg unexpectedly null."));
+            return;
+          }
+          const auto& characteristic_uuid_arg = std::get<std::string>(encodable_characteristic_uuid_arg);
+          api->ReadCharacteristic(mac_address_arg, service_uuid_arg, characteristic_uuid_arg, [reply](ErrorOr<std::vector<uint8_t>>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.writeCharacteristic" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_mac_address_arg = args.at(0);
+          if (encodable_mac_address_arg.IsNull()) {
+            reply(WrapError("mac_address_arg unexpectedly null."));
+            return;
+          }
+          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
+          const auto& encodable_service_uuid_arg = args.at(1);
+          if (encodable_service_uuid_arg.IsNull()) {
+            reply(WrapError("service_uuid_arg unexpectedly null."));
+            return;
+          }
+          const auto& service_uuid_arg = std::get<std::string>(encodable_service_uuid_arg);
+          const auto& encodable_characteristic_uuid_arg = args.at(2);
+          if (encodable_characteristic_uuid_arg.IsNull()) {
+            reply(WrapError("characteristic_uuid_arg unexpectedly null."));
+            return;
+          }
+          const auto& characteristic_uuid_arg = std::get<std::string>(encodable_characteristic_uuid_arg);
+          const auto& encodable_payload_arg = args.at(3);
+          if (encodable_payload_arg.IsNull()) {
+            reply(WrapError("payload_arg unexpectedly null."));
+            return;
+          }
+          const auto& payload_arg = std::get<std::vector<uint8_t>>(encodable_payload_arg);
+          const auto& encodable_with_response_arg = args.at(4);
+          if (encodable_with_response_arg.IsNull()) {
+            reply(WrapError("with_response_arg unexpectedly null."));
+            return;
+          }
+          const auto& with_response_arg = std::get<bool>(encodable_with_response_arg);
+          api->WriteCharacteristic(mac_address_arg, service_uuid_arg, characteristic_uuid_arg, payload_arg, with_response_arg, [reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.startNotify" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_mac_address_arg = args.at(0);
+          if (encodable_mac_address_arg.IsNull()) {
+            reply(WrapError("mac_address_arg unexpectedly null."));
+            return;
+          }
+          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
+          const auto& encodable_service_uuid_arg = args.at(1);
+          if (encodable_service_uuid_arg.IsNull()) {
+            reply(WrapError("service_uuid_arg unexpectedly null."));
+            return;
+          }
+          const auto& service_uuid_arg = std::get<std::string>(encodable_service_uuid_arg);
+          const auto& encodable_characteristic_uuid_arg = args.at(2);
+          if (encodable_characteristic_uuid_arg.IsNull()) {
+            reply(WrapError("characteristic_uuid_arg unexpectedly null."));
+            return;
+          }
+          const auto& characteristic_uuid_arg = std::get<std::string>(encodable_characteristic_uuid_arg);
+          api->StartNotify(mac_address_arg, service_uuid_arg, characteristic_uuid_arg, [reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.stopNotify" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_mac_address_arg = args.at(0);
+          if (encodable_mac_address_arg.IsNull()) {
+            reply(WrapError("mac_address_arg unexpectedly null."));
+            return;
+          }
+          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
+          const auto& encodable_service_uuid_arg = args.at(1);
+          if (encodable_service_uuid_arg.IsNull()) {
+            reply(WrapError("service_uuid_arg unexpectedly null."));
+            return;
+          }
+          const auto& service_uuid_arg = std::get<std::string>(encodable_service_uuid_arg);
+          const auto& encodable_characteristic_uuid_arg = args.at(2);
+          if (encodable_characteristic_uuid_arg.IsNull()) {
+            reply(WrapError("characteristic_uuid_arg unexpectedly null."));
+            return;
+          }
+          const auto& characteristic_uuid_arg = std::get<std::string>(encodable_characteristic_uuid_arg);
+          api->StopNotify(mac_address_arg, service_uuid_arg, characteristic_uuid_arg, [reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.startAdvertise" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_manufacturer_data_arg = args.at(0);
+          if (encodable_manufacturer_data_arg.IsNull()) {
+            reply(WrapError("manufacturer_data_arg unexpectedly null."));
+            return;
+          }
+          const auto& manufacturer_data_arg = std::get<EncodableList>(encodable_manufacturer_data_arg);
+          const auto& encodable_service_data_arg = args.at(1);
+          if (encodable_service_data_arg.IsNull()) {
+            reply(WrapError("service_data_arg unexpectedly null."));
+            return;
+          }
+          const auto& service_data_arg = std::get<EncodableList>(encodable_service_data_arg);
+          const auto& encodable_can_connect_arg = args.at(2);
+          if (encodable_can_connect_arg.IsNull()) {
+            reply(WrapError("can_connect_arg unexpectedly null."));
+            return;
+          }
+          const auto& can_connect_arg = std::get<bool>(encodable_can_connect_arg);
+          const auto& encodable_name_arg = args.at(3);
+          const auto* name_arg = std::get_if<std::string>(&encodable_name_arg);
+          const auto& encodable_services_specs_arg = args.at(4);
+          if (encodable_services_specs_arg.IsNull()) {
+            reply(WrapError("services_specs_arg unexpectedly null."));
+            return;
+          }
+          const auto& services_specs_arg = std::get<EncodableList>(encodable_services_specs_arg);
+          const auto& encodable_allow_bluetooth5_arg = args.at(5);
+          if (encodable_allow_bluetooth5_arg.IsNull()) {
+            reply(WrapError("allow_bluetooth5_arg unexpectedly null."));
+            return;
+          }
+          const auto& allow_bluetooth5_arg = std::get<bool>(encodable_allow_bluetooth5_arg);
+          api->StartAdvertise(manufacturer_data_arg, service_data_arg, can_connect_arg, name_arg, services_specs_arg, allow_bluetooth5_arg, [reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.stopAdvertise" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->StopAdvertise([reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.respondReadRequest" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_request_id_arg = args.at(0);
+          if (encodable_request_id_arg.IsNull()) {
+            reply(WrapError("request_id_arg unexpectedly null."));
+            return;
+          }
+          const int64_t request_id_arg = encodable_request_id_arg.LongValue();
+          const auto& encodable_mac_address_arg = args.at(1);
+          if (encodable_mac_address_arg.IsNull()) {
+            reply(WrapError("mac_address_arg unexpectedly null."));
+            return;
+          }
+          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
+          const auto& encodable_offset_arg = args.at(2);
+          if (encodable_offset_arg.IsNull()) {
+            reply(WrapError("offset_arg unexpectedly null."));
+            return;
+          }
+          const int64_t offset_arg = encodable_offset_arg.LongValue();
+          const auto& encodable_data_arg = args.at(3);
+          const auto* data_arg = std::get_if<std::vector<uint8_t>>(&encodable_data_arg);
+          api->RespondReadRequest(request_id_arg, mac_address_arg, offset_arg, data_arg, [reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.respondWriteRequest" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_request_id_arg = args.at(0);
+          if (encodable_request_id_arg.IsNull()) {
+            reply(WrapError("request_id_arg unexpectedly null."));
+            return;
+          }
+          const int64_t request_id_arg = encodable_request_id_arg.LongValue();
+          const auto& encodable_mac_address_arg = args.at(1);
+          if (encodable_mac_address_arg.IsNull()) {
+            reply(WrapError("mac_address_arg unexpectedly null."));
+            return;
+          }
+          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
+          const auto& encodable_offset_arg = args.at(2);
+          if (encodable_offset_arg.IsNull()) {
+            reply(WrapError("offset_arg unexpectedly null."));
+            return;
+          }
+          const int64_t offset_arg = encodable_offset_arg.LongValue();
+          const auto& encodable_success_arg = args.at(3);
+          if (encodable_success_arg.IsNull()) {
+            reply(WrapError("success_arg unexpectedly null."));
+            return;
+          }
+          const auto& success_arg = std::get<bool>(encodable_success_arg);
+          api->RespondWriteRequest(request_id_arg, mac_address_arg, offset_arg, success_arg, [reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.sendNotification" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
-          api->CheckScanPermissions([reply](ErrorOr<bool>&& output) {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_service_uuid_arg = args.at(0);
+          if (encodable_service_uuid_arg.IsNull()) {
+            reply(WrapError("service_uuid_arg unexpectedly null."));
+            return;
+          }
+          const auto& service_uuid_arg = std::get<std::string>(encodable_service_uuid_arg);
+          const auto& encodable_characteristic_uuid_arg = args.at(1);
+          if (encodable_characteristic_uuid_arg.IsNull()) {
+            reply(WrapError("characteristic_uuid_arg unexpectedly null."));
+            return;
+          }
+          const auto& characteristic_uuid_arg = std::get<std::string>(encodable_characteristic_uuid_arg);
+          const auto& encodable_payload_arg = args.at(2);
+          if (encodable_payload_arg.IsNull()) {
+            reply(WrapError("payload_arg unexpectedly null."));
+            return;
+          }
+          const auto& payload_arg = std::get<std::vector<uint8_t>>(encodable_payload_arg);
+          const auto& encodable_request_confirmation_arg = args.at(3);
+          if (encodable_request_confirmation_arg.IsNull()) {
+            reply(WrapError("request_confirmation_arg unexpectedly null."));
+            return;
+          }
+          const auto& request_confirmation_arg = std::get<bool>(encodable_request_confirmation_arg);
+          api->SendNotification(service_uuid_arg, characteristic_uuid_arg, payload_arg, request_confirmation_arg, [reply](ErrorOr<bool>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
@@ -1237,11 +3014,11 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.checkAdvertisePermissions" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.openBluetoothSettings" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
-          api->CheckAdvertisePermissions([reply](ErrorOr<bool>&& output) {
+          api->OpenBluetoothSettings([reply](ErrorOr<bool>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
@@ -1259,16 +3036,11 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.startScan" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.requestScanResync" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
-          const auto& args = std::get<EncodableList>(message);
-          const auto& encodable_mac_address_arg = args.at(0);
-          const auto* mac_address_arg = std::get_if<std::string>(&encodable_mac_address_arg);
-          const auto& encodable_services_uuids_arg = args.at(1);
-          const auto* services_uuids_arg = std::get_if<EncodableList>(&encodable_services_uuids_arg);
-          api->StartScan(mac_address_arg, services_uuids_arg, [reply](ErrorOr<bool>&& output) {
+          api->RequestScanResync([reply](ErrorOr<bool>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
@@ -1286,14 +3058,16 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.stopScan" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanCacheLimits" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
           const auto& args = std::get<EncodableList>(message);
-          const auto& encodable_mac_address_arg = args.at(0);
-          const auto* mac_address_arg = std::get_if<std::string>(&encodable_mac_address_arg);
-          api->StopScan(mac_address_arg, [reply](ErrorOr<bool>&& output) {
+          const auto& encodable_max_devices_arg = args.at(0);
+          const auto* max_devices_arg = std::get_if<int64_t>(&encodable_max_devices_arg);
+          const auto& encodable_device_ttl_ms_arg = args.at(1);
+          const auto* device_ttl_ms_arg = std::get_if<int64_t>(&encodable_device_ttl_ms_arg);
+          api->SetScanCacheLimits(max_devices_arg, device_ttl_ms_arg, [reply](ErrorOr<bool>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
@@ -1311,18 +3085,46 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.connect" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getScanCacheStats" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->GetScanCacheStats([reply](ErrorOr<BtScanCacheStats>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(CustomEncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanAddressFilters" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
           const auto& args = std::get<EncodableList>(message);
-          const auto& encodable_mac_address_arg = args.at(0);
-          if (encodable_mac_address_arg.IsNull()) {
-            reply(WrapError("mac_address_arg unexpectedly null."));
+          const auto& encodable_allowlist_arg = args.at(0);
+          if (encodable_allowlist_arg.IsNull()) {
+            reply(WrapError("allowlist_arg unexpectedly null."));
             return;
           }
-          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
-          api->Connect(mac_address_arg, [reply](ErrorOr<bool>&& output) {
+          const auto& allowlist_arg = std::get<EncodableList>(encodable_allowlist_arg);
+          const auto& encodable_denylist_arg = args.at(1);
+          if (encodable_denylist_arg.IsNull()) {
+            reply(WrapError("denylist_arg unexpectedly null."));
+            return;
+          }
+          const auto& denylist_arg = std::get<EncodableList>(encodable_denylist_arg);
+          api->SetScanAddressFilters(allowlist_arg, denylist_arg, [reply](ErrorOr<bool>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
@@ -1340,14 +3142,18 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.disconnect" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setManufacturerDataFilters" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
           const auto& args = std::get<EncodableList>(message);
-          const auto& encodable_mac_address_arg = args.at(0);
-          const auto* mac_address_arg = std::get_if<std::string>(&encodable_mac_address_arg);
-          api->Disconnect(mac_address_arg, [reply](ErrorOr<bool>&& output) {
+          const auto& encodable_filters_arg = args.at(0);
+          if (encodable_filters_arg.IsNull()) {
+            reply(WrapError("filters_arg unexpectedly null."));
+            return;
+          }
+          const auto& filters_arg = std::get<EncodableList>(encodable_filters_arg);
+          api->SetManufacturerDataFilters(filters_arg, [reply](ErrorOr<bool>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
@@ -1365,35 +3171,107 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setMtu" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getManufacturerDataFilterHits" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->GetManufacturerDataFilterHits([reply](ErrorOr<EncodableList>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setRssiSmoothing" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
           const auto& args = std::get<EncodableList>(message);
-          const auto& encodable_mac_address_arg = args.at(0);
-          if (encodable_mac_address_arg.IsNull()) {
-            reply(WrapError("mac_address_arg unexpectedly null."));
+          const auto& encodable_mode_arg = args.at(0);
+          if (encodable_mode_arg.IsNull()) {
+            reply(WrapError("mode_arg unexpectedly null."));
             return;
           }
-          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
-          const auto& encodable_new_mtu_arg = args.at(1);
-          if (encodable_new_mtu_arg.IsNull()) {
-            reply(WrapError("new_mtu_arg unexpectedly null."));
+          const int64_t mode_arg = encodable_mode_arg.LongValue();
+          const auto& encodable_ema_alpha_arg = args.at(1);
+          if (encodable_ema_alpha_arg.IsNull()) {
+            reply(WrapError("ema_alpha_arg unexpectedly null."));
             return;
           }
-          const int64_t new_mtu_arg = encodable_new_mtu_arg.LongValue();
-          api->SetMtu(mac_address_arg, new_mtu_arg, [reply](ErrorOr<std::optional<int64_t>>&& output) {
+          const auto& ema_alpha_arg = std::get<double>(encodable_ema_alpha_arg);
+          const auto& encodable_kalman_process_noise_arg = args.at(2);
+          if (encodable_kalman_process_noise_arg.IsNull()) {
+            reply(WrapError("kalman_process_noise_arg unexpectedly null."));
+            return;
+          }
+          const auto& kalman_process_noise_arg = std::get<double>(encodable_kalman_process_noise_arg);
+          const auto& encodable_kalman_measurement_noise_arg = args.at(3);
+          if (encodable_kalman_measurement_noise_arg.IsNull()) {
+            reply(WrapError("kalman_measurement_noise_arg unexpectedly null."));
+            return;
+          }
+          const auto& kalman_measurement_noise_arg = std::get<double>(encodable_kalman_measurement_noise_arg);
+          const auto& encodable_median_window_arg = args.at(4);
+          if (encodable_median_window_arg.IsNull()) {
+            reply(WrapError("median_window_arg unexpectedly null."));
+            return;
+          }
+          const int64_t median_window_arg = encodable_median_window_arg.LongValue();
+          const auto& encodable_min_delta_dbm_arg = args.at(5);
+          if (encodable_min_delta_dbm_arg.IsNull()) {
+            reply(WrapError("min_delta_dbm_arg unexpectedly null."));
+            return;
+          }
+          const int64_t min_delta_dbm_arg = encodable_min_delta_dbm_arg.LongValue();
+          const auto& encodable_max_interval_ms_arg = args.at(6);
+          if (encodable_max_interval_ms_arg.IsNull()) {
+            reply(WrapError("max_interval_ms_arg unexpectedly null."));
+            return;
+          }
+          const int64_t max_interval_ms_arg = encodable_max_interval_ms_arg.LongValue();
+          api->SetRssiSmoothing(mode_arg, ema_alpha_arg, kalman_process_noise_arg, kalman_measurement_noise_arg, median_window_arg, min_delta_dbm_arg, max_interval_ms_arg, [reply](ErrorOr<bool>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
             }
             EncodableList wrapped;
-            auto output_optional = std::move(output).TakeValue();
-            if (output_optional) {
-              wrapped.push_back(EncodableValue(std::move(output_optional).value()));
-            } else {
-              wrapped.push_back(EncodableValue());
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanCapture" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_path_arg = args.at(0);
+          const auto* path_arg = std::get_if<std::string>(&encodable_path_arg);
+          api->SetScanCapture(path_arg, [reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
             }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
             reply(EncodableValue(std::move(wrapped)));
           });
         } catch (const std::exception& exception) {
@@ -1405,18 +3283,40 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.discoverServices" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getScanMetrics" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
           const auto& args = std::get<EncodableList>(message);
-          const auto& encodable_mac_address_arg = args.at(0);
-          if (encodable_mac_address_arg.IsNull()) {
-            reply(WrapError("mac_address_arg unexpectedly null."));
+          const auto& encodable_reset_arg = args.at(0);
+          if (encodable_reset_arg.IsNull()) {
+            reply(WrapError("reset_arg unexpectedly null."));
             return;
           }
-          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
-          api->DiscoverServices(mac_address_arg, [reply](ErrorOr<EncodableList>&& output) {
+          const auto& reset_arg = std::get<bool>(encodable_reset_arg);
+          api->GetScanMetrics(reset_arg, [reply](ErrorOr<BtScanMetrics>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(CustomEncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.dumpScanMetrics" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->DumpScanMetrics([reply](ErrorOr<bool>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
@@ -1434,36 +3334,86 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.readCharacteristic" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanBackpressure" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
           const auto& args = std::get<EncodableList>(message);
-          const auto& encodable_mac_address_arg = args.at(0);
-          if (encodable_mac_address_arg.IsNull()) {
-            reply(WrapError("mac_address_arg unexpectedly null."));
+          const auto& encodable_policy_arg = args.at(0);
+          if (encodable_policy_arg.IsNull()) {
+            reply(WrapError("policy_arg unexpectedly null."));
             return;
           }
-          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
-          const auto& encodable_service_uuid_arg = args.at(1);
-          if (encodable_service_uuid_arg.IsNull()) {
-            reply(WrapError("service_uuid_arg unexpectedly null."));
+          const int64_t policy_arg = encodable_policy_arg.LongValue();
+          const auto& encodable_max_queued_devices_arg = args.at(1);
+          if (encodable_max_queued_devices_arg.IsNull()) {
+            reply(WrapError("max_queued_devices_arg unexpectedly null."));
             return;
           }
-          const auto& service_uuid_arg = std::get<std::string>(encodable_service_uuid_arg);
-          const auto& encodable_characteristic_uuid_arg = args.at(2);
-          if (encodable_characteristic_uuid_arg.IsNull()) {
-            reply(WrapError("characteristic_uuid_arg unexpectedly null."));
+          const int64_t max_queued_devices_arg = encodable_max_queued_devices_arg.LongValue();
+          api->SetScanBackpressure(policy_arg, max_queued_devices_arg, [reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getScanQueueStats" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->GetScanQueueStats([reply](ErrorOr<BtScanQueueStats>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(CustomEncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getAdvertisingInfo" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_mac_address_arg = args.at(0);
+          if (encodable_mac_address_arg.IsNull()) {
+            reply(WrapError("mac_address_arg unexpectedly null."));
             return;
           }
-          const auto& characteristic_uuid_arg = std::get<std::string>(encodable_characteristic_uuid_arg);
-          api->ReadCharacteristic(mac_address_arg, service_uuid_arg, characteristic_uuid_arg, [reply](ErrorOr<std::vector<uint8_t>>&& output) {
+          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
+          api->GetAdvertisingInfo(mac_address_arg, [reply](ErrorOr<std::optional<BtAdvertisingInfo>>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
             }
             EncodableList wrapped;
-            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            auto output_optional = std::move(output).TakeValue();
+            if (output_optional) {
+              wrapped.push_back(CustomEncodableValue(std::move(output_optional).value()));
+            } else {
+              wrapped.push_back(EncodableValue());
+            }
             reply(EncodableValue(std::move(wrapped)));
           });
         } catch (const std::exception& exception) {
@@ -1475,48 +3425,22 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.writeCharacteristic" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.getConnectTimings" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
-          const auto& args = std::get<EncodableList>(message);
-          const auto& encodable_mac_address_arg = args.at(0);
-          if (encodable_mac_address_arg.IsNull()) {
-            reply(WrapError("mac_address_arg unexpectedly null."));
-            return;
-          }
-          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
-          const auto& encodable_service_uuid_arg = args.at(1);
-          if (encodable_service_uuid_arg.IsNull()) {
-            reply(WrapError("service_uuid_arg unexpectedly null."));
-            return;
-          }
-          const auto& service_uuid_arg = std::get<std::string>(encodable_service_uuid_arg);
-          const auto& encodable_characteristic_uuid_arg = args.at(2);
-          if (encodable_characteristic_uuid_arg.IsNull()) {
-            reply(WrapError("characteristic_uuid_arg unexpectedly null."));
-            return;
-          }
-          const auto& characteristic_uuid_arg = std::get<std::string>(encodable_characteristic_uuid_arg);
-          const auto& encodable_payload_arg = args.at(3);
-          if (encodable_payload_arg.IsNull()) {
-            reply(WrapError("payload_arg unexpectedly null."));
-            return;
-          }
-          const auto& payload_arg = std::get<std::vector<uint8_t>>(encodable_payload_arg);
-          const auto& encodable_with_response_arg = args.at(4);
-          if (encodable_with_response_arg.IsNull()) {
-            reply(WrapError("with_response_arg unexpectedly null."));
-            return;
-          }
-          const auto& with_response_arg = std::get<bool>(encodable_with_response_arg);
-          api->WriteCharacteristic(mac_address_arg, service_uuid_arg, characteristic_uuid_arg, payload_arg, with_response_arg, [reply](ErrorOr<bool>&& output) {
+          api->GetConnectTimings([reply](ErrorOr<std::optional<BtConnectTimings>>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
             }
             EncodableList wrapped;
-            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            auto output_optional = std::move(output).TakeValue();
+            if (output_optional) {
+              wrapped.push_back(CustomEncodableValue(std::move(output_optional).value()));
+            } else {
+              wrapped.push_back(EncodableValue());
+            }
             reply(EncodableValue(std::move(wrapped)));
           });
         } catch (const std::exception& exception) {
@@ -1528,30 +3452,14 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.startNotify" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setGattCache" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
           const auto& args = std::get<EncodableList>(message);
-          const auto& encodable_mac_address_arg = args.at(0);
-          if (encodable_mac_address_arg.IsNull()) {
-            reply(WrapError("mac_address_arg unexpectedly null."));
-            return;
-          }
-          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
-          const auto& encodable_service_uuid_arg = args.at(1);
-          if (encodable_service_uuid_arg.IsNull()) {
-            reply(WrapError("service_uuid_arg unexpectedly null."));
-            return;
-          }
-          const auto& service_uuid_arg = std::get<std::string>(encodable_service_uuid_arg);
-          const auto& encodable_characteristic_uuid_arg = args.at(2);
-          if (encodable_characteristic_uuid_arg.IsNull()) {
-            reply(WrapError("characteristic_uuid_arg unexpectedly null."));
-            return;
-          }
-          const auto& characteristic_uuid_arg = std::get<std::string>(encodable_characteristic_uuid_arg);
-          api->StartNotify(mac_address_arg, service_uuid_arg, characteristic_uuid_arg, [reply](ErrorOr<bool>&& output) {
+          const auto& encodable_directory_arg = args.at(0);
+          const auto* directory_arg = std::get_if<std::string>(&encodable_directory_arg);
+          api->SetGattCache(directory_arg, [reply](ErrorOr<bool>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
@@ -1569,30 +3477,11 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.stopNotify" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.clearGattCache" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
-          const auto& args = std::get<EncodableList>(message);
-          const auto& encodable_mac_address_arg = args.at(0);
-          if (encodable_mac_address_arg.IsNull()) {
-            reply(WrapError("mac_address_arg unexpectedly null."));
-            return;
-          }
-          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
-          const auto& encodable_service_uuid_arg = args.at(1);
-          if (encodable_service_uuid_arg.IsNull()) {
-            reply(WrapError("service_uuid_arg unexpectedly null."));
-            return;
-          }
-          const auto& service_uuid_arg = std::get<std::string>(encodable_service_uuid_arg);
-          const auto& encodable_characteristic_uuid_arg = args.at(2);
-          if (encodable_characteristic_uuid_arg.IsNull()) {
-            reply(WrapError("characteristic_uuid_arg unexpectedly null."));
-            return;
-          }
-          const auto& characteristic_uuid_arg = std::get<std::string>(encodable_characteristic_uuid_arg);
-          api->StopNotify(mac_address_arg, service_uuid_arg, characteristic_uuid_arg, [reply](ErrorOr<bool>&& output) {
+          api->ClearGattCache([reply](ErrorOr<int64_t>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
@@ -1610,44 +3499,18 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.startAdvertise" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setLazyServiceDiscovery" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
           const auto& args = std::get<EncodableList>(message);
-          const auto& encodable_manufacturer_data_arg = args.at(0);
-          if (encodable_manufacturer_data_arg.IsNull()) {
-            reply(WrapError("manufacturer_data_arg unexpectedly null."));
-            return;
-          }
-          const auto& manufacturer_data_arg = std::get<EncodableList>(encodable_manufacturer_data_arg);
-          const auto& encodable_service_data_arg = args.at(1);
-          if (encodable_service_data_arg.IsNull()) {
-            reply(WrapError("service_data_arg unexpectedly null."));
-            return;
-          }
-          const auto& service_data_arg = std::get<EncodableList>(encodable_service_data_arg);
-          const auto& encodable_can_connect_arg = args.at(2);
-          if (encodable_can_connect_arg.IsNull()) {
-            reply(WrapError("can_connect_arg unexpectedly null."));
-            return;
-          }
-          const auto& can_connect_arg = std::get<bool>(encodable_can_connect_arg);
-          const auto& encodable_name_arg = args.at(3);
-          const auto* name_arg = std::get_if<std::string>(&encodable_name_arg);
-          const auto& encodable_services_specs_arg = args.at(4);
-          if (encodable_services_specs_arg.IsNull()) {
-            reply(WrapError("services_specs_arg unexpectedly null."));
-            return;
-          }
-          const auto& services_specs_arg = std::get<EncodableList>(encodable_services_specs_arg);
-          const auto& encodable_allow_bluetooth5_arg = args.at(5);
-          if (encodable_allow_bluetooth5_arg.IsNull()) {
-            reply(WrapError("allow_bluetooth5_arg unexpectedly null."));
+          const auto& encodable_enabled_arg = args.at(0);
+          if (encodable_enabled_arg.IsNull()) {
+            reply(WrapError("enabled_arg unexpectedly null."));
             return;
           }
-          const auto& allow_bluetooth5_arg = std::get<bool>(encodable_allow_bluetooth5_arg);
-          api->StartAdvertise(manufacturer_data_arg, service_data_arg, can_connect_arg, name_arg, services_specs_arg, allow_bluetooth5_arg, [reply](ErrorOr<bool>&& output) {
+          const auto& enabled_arg = std::get<bool>(encodable_enabled_arg);
+          api->SetLazyServiceDiscovery(enabled_arg, [reply](ErrorOr<bool>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
@@ -1665,11 +3528,18 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.stopAdvertise" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.readCharacteristicByHandle" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
-          api->StopAdvertise([reply](ErrorOr<bool>&& output) {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_handle_arg = args.at(0);
+          if (encodable_handle_arg.IsNull()) {
+            reply(WrapError("handle_arg unexpectedly null."));
+            return;
+          }
+          const int64_t handle_arg = encodable_handle_arg.LongValue();
+          api->ReadCharacteristicByHandle(handle_arg, [reply](ErrorOr<std::vector<uint8_t>>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
@@ -1687,32 +3557,30 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.respondReadRequest" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.writeCharacteristicByHandle" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
           const auto& args = std::get<EncodableList>(message);
-          const auto& encodable_request_id_arg = args.at(0);
-          if (encodable_request_id_arg.IsNull()) {
-            reply(WrapError("request_id_arg unexpectedly null."));
+          const auto& encodable_handle_arg = args.at(0);
+          if (encodable_handle_arg.IsNull()) {
+            reply(WrapError("handle_arg unexpectedly null."));
             return;
           }
-          const int64_t request_id_arg = encodable_request_id_arg.LongValue();
-          const auto& encodable_mac_address_arg = args.at(1);
-          if (encodable_mac_address_arg.IsNull()) {
-            reply(WrapError("mac_address_arg unexpectedly null."));
+          const int64_t handle_arg = encodable_handle_arg.LongValue();
+          const auto& encodable_payload_arg = args.at(1);
+          if (encodable_payload_arg.IsNull()) {
+            reply(WrapError("payload_arg unexpectedly null."));
             return;
           }
-          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
-          const auto& encodable_offset_arg = args.at(2);
-          if (encodable_offset_arg.IsNull()) {
-            reply(WrapError("offset_arg unexpectedly null."));
+          const auto& payload_arg = std::get<std::vector<uint8_t>>(encodable_payload_arg);
+          const auto& encodable_with_response_arg = args.at(2);
+          if (encodable_with_response_arg.IsNull()) {
+            reply(WrapError("with_response_arg unexpectedly null."));
             return;
           }
-          const int64_t offset_arg = encodable_offset_arg.LongValue();
-          const auto& encodable_data_arg = args.at(3);
-          const auto* data_arg = std::get_if<std::vector<uint8_t>>(&encodable_data_arg);
-          api->RespondReadRequest(request_id_arg, mac_address_arg, offset_arg, data_arg, [reply](ErrorOr<bool>&& output) {
+          const auto& with_response_arg = std::get<bool>(encodable_with_response_arg);
+          api->WriteCharacteristicByHandle(handle_arg, payload_arg, with_response_arg, [reply](ErrorOr<bool>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
@@ -1730,36 +3598,18 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.respondWriteRequest" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.startNotifyByHandle" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
           const auto& args = std::get<EncodableList>(message);
-          const auto& encodable_request_id_arg = args.at(0);
-          if (encodable_request_id_arg.IsNull()) {
-            reply(WrapError("request_id_arg unexpectedly null."));
-            return;
-          }
-          const int64_t request_id_arg = encodable_request_id_arg.LongValue();
-          const auto& encodable_mac_address_arg = args.at(1);
-          if (encodable_mac_address_arg.IsNull()) {
-            reply(WrapError("mac_address_arg unexpectedly null."));
-            return;
-          }
-          const auto& mac_address_arg = std::get<std::string>(encodable_mac_address_arg);
-          const auto& encodable_offset_arg = args.at(2);
-          if (encodable_offset_arg.IsNull()) {
-            reply(WrapError("offset_arg unexpectedly null."));
-            return;
-          }
-          const int64_t offset_arg = encodable_offset_arg.LongValue();
-          const auto& encodable_success_arg = args.at(3);
-          if (encodable_success_arg.IsNull()) {
-            reply(WrapError("success_arg unexpectedly null."));
+          const auto& encodable_handle_arg = args.at(0);
+          if (encodable_handle_arg.IsNull()) {
+            reply(WrapError("handle_arg unexpectedly null."));
             return;
           }
-          const auto& success_arg = std::get<bool>(encodable_success_arg);
-          api->RespondWriteRequest(request_id_arg, mac_address_arg, offset_arg, success_arg, [reply](ErrorOr<bool>&& output) {
+          const int64_t handle_arg = encodable_handle_arg.LongValue();
+          api->StartNotifyByHandle(handle_arg, [reply](ErrorOr<bool>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
@@ -1777,36 +3627,18 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.sendNotification" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.stopNotifyByHandle" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
           const auto& args = std::get<EncodableList>(message);
-          const auto& encodable_service_uuid_arg = args.at(0);
-          if (encodable_service_uuid_arg.IsNull()) {
-            reply(WrapError("service_uuid_arg unexpectedly null."));
-            return;
-          }
-          const auto& service_uuid_arg = std::get<std::string>(encodable_service_uuid_arg);
-          const auto& encodable_characteristic_uuid_arg = args.at(1);
-          if (encodable_characteristic_uuid_arg.IsNull()) {
-            reply(WrapError("characteristic_uuid_arg unexpectedly null."));
-            return;
-          }
-          const auto& characteristic_uuid_arg = std::get<std::string>(encodable_characteristic_uuid_arg);
-          const auto& encodable_payload_arg = args.at(2);
-          if (encodable_payload_arg.IsNull()) {
-            reply(WrapError("payload_arg unexpectedly null."));
-            return;
-          }
-          const auto& payload_arg = std::get<std::vector<uint8_t>>(encodable_payload_arg);
-          const auto& encodable_request_confirmation_arg = args.at(3);
-          if (encodable_request_confirmation_arg.IsNull()) {
-            reply(WrapError("request_confirmation_arg unexpectedly null."));
+          const auto& encodable_handle_arg = args.at(0);
+          if (encodable_handle_arg.IsNull()) {
+            reply(WrapError("handle_arg unexpectedly null."));
             return;
           }
-          const auto& request_confirmation_arg = std::get<bool>(encodable_request_confirmation_arg);
-          api->SendNotification(service_uuid_arg, characteristic_uuid_arg, payload_arg, request_confirmation_arg, [reply](ErrorOr<bool>&& output) {
+          const int64_t handle_arg = encodable_handle_arg.LongValue();
+          api->StopNotifyByHandle(handle_arg, [reply](ErrorOr<bool>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
@@ -1824,11 +3656,18 @@ void LayrzBlePlatformChannel::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.openBluetoothSettings" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.layrz_ble.LayrzBlePlatformChannel.setScanCoalescingWindow" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
-          api->OpenBluetoothSettings([reply](ErrorOr<bool>&& output) {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_window_ms_arg = args.at(0);
+          if (encodable_window_ms_arg.IsNull()) {
+            reply(WrapError("window_ms_arg unexpectedly null."));
+            return;
+          }
+          const int64_t window_ms_arg = encodable_window_ms_arg.LongValue();
+          api->SetScanCoalescingWindow(window_ms_arg, [reply](ErrorOr<bool>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
@@ -1903,6 +3742,31 @@ void LayrzBleCallbackChannel::OnScanResult(
   });
 }
 
+void LayrzBleCallbackChannel::OnScanResults(
+  const EncodableList& devices_arg,
+  std::function<void(void)>&& on_success,
+  std::function<void(const FlutterError&)>&& on_error) {
+  const std::string channel_name = "dev.flutter.pigeon.layrz_ble.LayrzBleCallbackChannel.onScanResults" + message_channel_suffix_;
+  BasicMessageChannel<> channel(binary_messenger_, channel_name, &GetCodec());
+  EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
+    EncodableValue(devices_arg),
+  });
+  channel.Send(encoded_api_arguments, [channel_name, on_success = std::move(on_success), on_error = std::move(on_error)](const uint8_t* reply, size_t reply_size) {
+    std::unique_ptr<EncodableValue> response = GetCodec().DecodeMessage(reply, reply_size);
+    const auto& encodable_return_value = *response;
+    const auto* list_return_value = std::get_if<EncodableList>(&encodable_return_value);
+    if (list_return_value) {
+      if (list_return_value->size() > 1) {
+        on_error(FlutterError(std::get<std::string>(list_return_value->at(0)), std::get<std::string>(list_return_value->at(1)), list_return_value->at(2)));
+      } else {
+        on_success();
+      }
+    } else {
+      on_error(CreateConnectionError(channel_name));
+    } 
+  });
+}
+
 void LayrzBleCallbackChannel::OnBluetoothOn(
   std::function<void(void)>&& on_success,
   std::function<void(const FlutterError&)>&& on_error) {
@@ -2237,4 +4101,56 @@ void LayrzBleCallbackChannel::OnGattMtuChanged(
   });
 }
 
+void LayrzBleCallbackChannel::OnScanDeltas(
+  const EncodableList& deltas_arg,
+  std::function<void(void)>&& on_success,
+  std::function<void(const FlutterError&)>&& on_error) {
+  const std::string channel_name = "dev.flutter.pigeon.layrz_ble.LayrzBleCallbackChannel.onScanDeltas" + message_channel_suffix_;
+  BasicMessageChannel<> channel(binary_messenger_, channel_name, &GetCodec());
+  EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
+    EncodableValue(deltas_arg),
+  });
+  channel.Send(encoded_api_arguments, [channel_name, on_success = std::move(on_success), on_error = std::move(on_error)](const uint8_t* reply, size_t reply_size) {
+    std::unique_ptr<EncodableValue> response = GetCodec().DecodeMessage(reply, reply_size);
+    const auto& encodable_return_value = *response;
+    const auto* list_return_value = std::get_if<EncodableList>(&encodable_return_value);
+    if (list_return_value) {
+      if (list_return_value->size() > 1) {
+        on_error(FlutterError(std::get<std::string>(list_return_value->at(0)), std::get<std::string>(list_return_value->at(1)), list_return_value->at(2)));
+      } else {
+        on_success();
+      }
+    } else {
+      on_error(CreateConnectionError(channel_name));
+    } 
+  });
+}
+
+void LayrzBleCallbackChannel::OnDeviceLost(
+  const std::string& mac_address_arg,
+  const int64_t* address_type_arg,
+  std::function<void(void)>&& on_success,
+  std::function<void(const FlutterError&)>&& on_error) {
+  const std::string channel_name = "dev.flutter.pigeon.layrz_ble.LayrzBleCallbackChannel.onDeviceLost" + message_channel_suffix_;
+  BasicMessageChannel<> channel(binary_messenger_, channel_name, &GetCodec());
+  EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
+    EncodableValue(mac_address_arg),
+    address_type_arg ? EncodableValue(*address_type_arg) : EncodableValue(),
+  });
+  channel.Send(encoded_api_arguments, [channel_name, on_success = std::move(on_success), on_error = std::move(on_error)](const uint8_t* reply, size_t reply_size) {
+    std::unique_ptr<EncodableValue> response = GetCodec().DecodeMessage(reply, reply_size);
+    const auto& encodable_return_value = *response;
+    const auto* list_return_value = std::get_if<EncodableList>(&encodable_return_value);
+    if (list_return_value) {
+      if (list_return_value->size() > 1) {
+        on_error(FlutterError(std::get<std::string>(list_return_value->at(0)), std::get<std::string>(list_return_value->at(1)), list_return_value->at(2)));
+      } else {
+        on_success();
+      }
+    } else {
+      on_error(CreateConnectionError(channel_name));
+    } 
+  });
+}
+
 }  // namespace layrz_ble
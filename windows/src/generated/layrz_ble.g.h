@@ -192,7 +192,8 @@ class BtServiceData {
   // Constructs an object setting all fields.
   explicit BtServiceData(
     int64_t uuid,
-    const std::vector<uint8_t>* data);
+    const std::vector<uint8_t>* data,
+    const std::string* full_uuid);
 
   int64_t uuid() const;
   void set_uuid(int64_t value_arg);
@@ -201,6 +202,10 @@ class BtServiceData {
   void set_data(const std::vector<uint8_t>* value_arg);
   void set_data(const std::vector<uint8_t>& value_arg);
 
+  const std::string* full_uuid() const;
+  void set_full_uuid(const std::string_view* value_arg);
+  void set_full_uuid(std::string_view value_arg);
+
   bool operator==(const BtServiceData& other) const;
   bool operator!=(const BtServiceData& other) const;
   /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
@@ -213,6 +218,7 @@ class BtServiceData {
   friend class PigeonInternalCodecSerializer;
   int64_t uuid_;
   std::optional<std::vector<uint8_t>> data_;
+  std::optional<std::string> full_uuid_;
 };
 
 
@@ -248,17 +254,27 @@ class BtService {
 // Generated class from Pigeon that represents data sent in messages.
 class BtCharacteristic {
  public:
-  // Constructs an object setting all fields.
+  // Constructs an object setting all non-nullable fields.
   explicit BtCharacteristic(
     const std::string& uuid,
     const ::flutter::EncodableList& properties);
 
+  // Constructs an object setting all fields.
+  explicit BtCharacteristic(
+    const std::string& uuid,
+    const ::flutter::EncodableList& properties,
+    const int64_t* handle);
+
   const std::string& uuid() const;
   void set_uuid(std::string_view value_arg);
 
   const ::flutter::EncodableList& properties() const;
   void set_properties(const ::flutter::EncodableList& value_arg);
 
+  const int64_t* handle() const;
+  void set_handle(const int64_t* value_arg);
+  void set_handle(int64_t value_arg);
+
   bool operator==(const BtCharacteristic& other) const;
   bool operator!=(const BtCharacteristic& other) const;
   /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
@@ -271,6 +287,7 @@ class BtCharacteristic {
   friend class PigeonInternalCodecSerializer;
   std::string uuid_;
   ::flutter::EncodableList properties_;
+  std::optional<int64_t> handle_;
 };
 
 
@@ -427,6 +444,443 @@ class BtGattWriteRequest {
 };
 
 
+// Generated class from Pigeon that represents data sent in messages.
+class BtDeviceDelta {
+ public:
+  // Constructs an object setting all non-nullable fields.
+  explicit BtDeviceDelta(
+    const std::string& mac_address,
+    int64_t changed_fields);
+
+  // Constructs an object setting all fields.
+  explicit BtDeviceDelta(
+    const std::string& mac_address,
+    int64_t changed_fields,
+    const std::string* name,
+    const int64_t* rssi,
+    const int64_t* tx_power,
+    const ::flutter::EncodableList* manufacturer_data,
+    const ::flutter::EncodableList* service_data,
+    const int64_t* address_type);
+
+  const std::string& mac_address() const;
+  void set_mac_address(std::string_view value_arg);
+
+  int64_t changed_fields() const;
+  void set_changed_fields(int64_t value_arg);
+
+  const std::string* name() const;
+  void set_name(const std::string_view* value_arg);
+  void set_name(std::string_view value_arg);
+
+  const int64_t* rssi() const;
+  void set_rssi(const int64_t* value_arg);
+  void set_rssi(int64_t value_arg);
+
+  const int64_t* tx_power() const;
+  void set_tx_power(const int64_t* value_arg);
+  void set_tx_power(int64_t value_arg);
+
+  const ::flutter::EncodableList* manufacturer_data() const;
+  void set_manufacturer_data(const ::flutter::EncodableList* value_arg);
+  void set_manufacturer_data(const ::flutter::EncodableList& value_arg);
+
+  const ::flutter::EncodableList* service_data() const;
+  void set_service_data(const ::flutter::EncodableList* value_arg);
+  void set_service_data(const ::flutter::EncodableList& value_arg);
+
+  const int64_t* address_type() const;
+  void set_address_type(const int64_t* value_arg);
+  void set_address_type(int64_t value_arg);
+
+  bool operator==(const BtDeviceDelta& other) const;
+  bool operator!=(const BtDeviceDelta& other) const;
+  /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
+  size_t Hash() const;
+ private:
+  static BtDeviceDelta FromEncodableList(const ::flutter::EncodableList& list);
+  ::flutter::EncodableList ToEncodableList() const;
+  friend class LayrzBlePlatformChannel;
+  friend class LayrzBleCallbackChannel;
+  friend class PigeonInternalCodecSerializer;
+  std::string mac_address_;
+  int64_t changed_fields_;
+  std::optional<std::string> name_;
+  std::optional<int64_t> rssi_;
+  std::optional<int64_t> tx_power_;
+  std::optional<::flutter::EncodableList> manufacturer_data_;
+  std::optional<::flutter::EncodableList> service_data_;
+  std::optional<int64_t> address_type_;
+};
+
+
+// Generated class from Pigeon that represents data sent in messages.
+class BtScanCacheStats {
+ public:
+  // Constructs an object setting all fields.
+  explicit BtScanCacheStats(
+    int64_t devices,
+    int64_t max_devices,
+    int64_t device_ttl_ms,
+    int64_t evicted_by_ttl,
+    int64_t evicted_by_capacity,
+    int64_t approximate_bytes,
+    int64_t watcher_devices);
+
+  int64_t devices() const;
+  void set_devices(int64_t value_arg);
+
+  int64_t max_devices() const;
+  void set_max_devices(int64_t value_arg);
+
+  int64_t device_ttl_ms() const;
+  void set_device_ttl_ms(int64_t value_arg);
+
+  int64_t evicted_by_ttl() const;
+  void set_evicted_by_ttl(int64_t value_arg);
+
+  int64_t evicted_by_capacity() const;
+  void set_evicted_by_capacity(int64_t value_arg);
+
+  int64_t approximate_bytes() const;
+  void set_approximate_bytes(int64_t value_arg);
+
+  int64_t watcher_devices() const;
+  void set_watcher_devices(int64_t value_arg);
+
+  bool operator==(const BtScanCacheStats& other) const;
+  bool operator!=(const BtScanCacheStats& other) const;
+  /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
+  size_t Hash() const;
+ private:
+  static BtScanCacheStats FromEncodableList(const ::flutter::EncodableList& list);
+  ::flutter::EncodableList ToEncodableList() const;
+  friend class LayrzBlePlatformChannel;
+  friend class LayrzBleCallbackChannel;
+  friend class PigeonInternalCodecSerializer;
+  int64_t devices_;
+  int64_t max_devices_;
+  int64_t device_ttl_ms_;
+  int64_t evicted_by_ttl_;
+  int64_t evicted_by_capacity_;
+  int64_t approximate_bytes_;
+  int64_t watcher_devices_;
+};
+
+
+// Generated class from Pigeon that represents data sent in messages.
+class BtManufacturerDataFilter {
+ public:
+  // Constructs an object setting all non-nullable fields.
+  explicit BtManufacturerDataFilter(
+    int64_t company_id,
+    int64_t offset,
+    const std::vector<uint8_t>& value,
+    int64_t group);
+
+  // Constructs an object setting all fields.
+  explicit BtManufacturerDataFilter(
+    int64_t company_id,
+    int64_t offset,
+    const std::vector<uint8_t>& value,
+    const std::vector<uint8_t>* mask,
+    int64_t group);
+
+  int64_t company_id() const;
+  void set_company_id(int64_t value_arg);
+
+  int64_t offset() const;
+  void set_offset(int64_t value_arg);
+
+  const std::vector<uint8_t>& value() const;
+  void set_value(const std::vector<uint8_t>& value_arg);
+
+  const std::vector<uint8_t>* mask() const;
+  void set_mask(const std::vector<uint8_t>* value_arg);
+  void set_mask(const std::vector<uint8_t>& value_arg);
+
+  int64_t group() const;
+  void set_group(int64_t value_arg);
+
+  bool operator==(const BtManufacturerDataFilter& other) const;
+  bool operator!=(const BtManufacturerDataFilter& other) const;
+  /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
+  size_t Hash() const;
+ private:
+  static BtManufacturerDataFilter FromEncodableList(const ::flutter::EncodableList& list);
+  ::flutter::EncodableList ToEncodableList() const;
+  friend class LayrzBlePlatformChannel;
+  friend class LayrzBleCallbackChannel;
+  friend class PigeonInternalCodecSerializer;
+  int64_t company_id_;
+  int64_t offset_;
+  std::vector<uint8_t> value_;
+  std::optional<std::vector<uint8_t>> mask_;
+  int64_t group_;
+};
+
+
+// Generated class from Pigeon that represents data sent in messages.
+class BtScanMetrics {
+ public:
+  // Constructs an object setting all fields.
+  explicit BtScanMetrics(
+    int64_t received,
+    int64_t dropped,
+    int64_t filtered,
+    int64_t duplicates,
+    int64_t merged,
+    int64_t coalesced,
+    int64_t encoded,
+    int64_t posted,
+    const ::flutter::EncodableList& ingest_latency_buckets,
+    int64_t ingest_latency_max_us,
+    const ::flutter::EncodableList& post_latency_buckets,
+    int64_t post_latency_max_us);
+
+  int64_t received() const;
+  void set_received(int64_t value_arg);
+
+  int64_t dropped() const;
+  void set_dropped(int64_t value_arg);
+
+  int64_t filtered() const;
+  void set_filtered(int64_t value_arg);
+
+  int64_t duplicates() const;
+  void set_duplicates(int64_t value_arg);
+
+  int64_t merged() const;
+  void set_merged(int64_t value_arg);
+
+  int64_t coalesced() const;
+  void set_coalesced(int64_t value_arg);
+
+  int64_t encoded() const;
+  void set_encoded(int64_t value_arg);
+
+  int64_t posted() const;
+  void set_posted(int64_t value_arg);
+
+  const ::flutter::EncodableList& ingest_latency_buckets() const;
+  void set_ingest_latency_buckets(const ::flutter::EncodableList& value_arg);
+
+  int64_t ingest_latency_max_us() const;
+  void set_ingest_latency_max_us(int64_t value_arg);
+
+  const ::flutter::EncodableList& post_latency_buckets() const;
+  void set_post_latency_buckets(const ::flutter::EncodableList& value_arg);
+
+  int64_t post_latency_max_us() const;
+  void set_post_latency_max_us(int64_t value_arg);
+
+  bool operator==(const BtScanMetrics& other) const;
+  bool operator!=(const BtScanMetrics& other) const;
+  /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
+  size_t Hash() const;
+ private:
+  static BtScanMetrics FromEncodableList(const ::flutter::EncodableList& list);
+  ::flutter::EncodableList ToEncodableList() const;
+  friend class LayrzBlePlatformChannel;
+  friend class LayrzBleCallbackChannel;
+  friend class PigeonInternalCodecSerializer;
+  int64_t received_;
+  int64_t dropped_;
+  int64_t filtered_;
+  int64_t duplicates_;
+  int64_t merged_;
+  int64_t coalesced_;
+  int64_t encoded_;
+  int64_t posted_;
+  ::flutter::EncodableList ingest_latency_buckets_;
+  int64_t ingest_latency_max_us_;
+  ::flutter::EncodableList post_latency_buckets_;
+  int64_t post_latency_max_us_;
+};
+
+
+// Generated class from Pigeon that represents data sent in messages.
+class BtScanQueueStats {
+ public:
+  // Constructs an object setting all fields.
+  explicit BtScanQueueStats(
+    int64_t policy,
+    int64_t capacity,
+    int64_t depth,
+    int64_t high_watermark,
+    int64_t queued_events,
+    int64_t delivered_events,
+    int64_t dropped_events,
+    int64_t dropped_devices,
+    int64_t deferred_flushes,
+    int64_t pauses,
+    int64_t paused_advertisements);
+
+  int64_t policy() const;
+  void set_policy(int64_t value_arg);
+
+  int64_t capacity() const;
+  void set_capacity(int64_t value_arg);
+
+  int64_t depth() const;
+  void set_depth(int64_t value_arg);
+
+  int64_t high_watermark() const;
+  void set_high_watermark(int64_t value_arg);
+
+  int64_t queued_events() const;
+  void set_queued_events(int64_t value_arg);
+
+  int64_t delivered_events() const;
+  void set_delivered_events(int64_t value_arg);
+
+  int64_t dropped_events() const;
+  void set_dropped_events(int64_t value_arg);
+
+  int64_t dropped_devices() const;
+  void set_dropped_devices(int64_t value_arg);
+
+  int64_t deferred_flushes() const;
+  void set_deferred_flushes(int64_t value_arg);
+
+  int64_t pauses() const;
+  void set_pauses(int64_t value_arg);
+
+  int64_t paused_advertisements() const;
+  void set_paused_advertisements(int64_t value_arg);
+
+  bool operator==(const BtScanQueueStats& other) const;
+  bool operator!=(const BtScanQueueStats& other) const;
+  /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
+  size_t Hash() const;
+ private:
+  static BtScanQueueStats FromEncodableList(const ::flutter::EncodableList& list);
+  ::flutter::EncodableList ToEncodableList() const;
+  friend class LayrzBlePlatformChannel;
+  friend class LayrzBleCallbackChannel;
+  friend class PigeonInternalCodecSerializer;
+  int64_t policy_;
+  int64_t capacity_;
+  int64_t depth_;
+  int64_t high_watermark_;
+  int64_t queued_events_;
+  int64_t delivered_events_;
+  int64_t dropped_events_;
+  int64_t dropped_devices_;
+  int64_t deferred_flushes_;
+  int64_t pauses_;
+  int64_t paused_advertisements_;
+};
+
+
+// Generated class from Pigeon that represents data sent in messages.
+class BtAdvertisingInfo {
+ public:
+  // Constructs an object setting all fields.
+  explicit BtAdvertisingInfo(
+    bool extended,
+    int64_t primary_phy,
+    int64_t secondary_phy,
+    int64_t advertising_sid,
+    int64_t max_payload_length);
+
+  bool extended() const;
+  void set_extended(bool value_arg);
+
+  int64_t primary_phy() const;
+  void set_primary_phy(int64_t value_arg);
+
+  int64_t secondary_phy() const;
+  void set_secondary_phy(int64_t value_arg);
+
+  int64_t advertising_sid() const;
+  void set_advertising_sid(int64_t value_arg);
+
+  int64_t max_payload_length() const;
+  void set_max_payload_length(int64_t value_arg);
+
+  bool operator==(const BtAdvertisingInfo& other) const;
+  bool operator!=(const BtAdvertisingInfo& other) const;
+  /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
+  size_t Hash() const;
+ private:
+  static BtAdvertisingInfo FromEncodableList(const ::flutter::EncodableList& list);
+  ::flutter::EncodableList ToEncodableList() const;
+  friend class LayrzBlePlatformChannel;
+  friend class LayrzBleCallbackChannel;
+  friend class PigeonInternalCodecSerializer;
+  bool extended_;
+  int64_t primary_phy_;
+  int64_t secondary_phy_;
+  int64_t advertising_sid_;
+  int64_t max_payload_length_;
+};
+
+
+// Generated class from Pigeon that represents data sent in messages.
+class BtConnectTimings {
+ public:
+  // Constructs an object setting all fields.
+  explicit BtConnectTimings(
+    int64_t resolve_us,
+    int64_t services_us,
+    int64_t characteristics_us,
+    int64_t slowest_service_us,
+    int64_t total_us,
+    int64_t services,
+    int64_t characteristics,
+    int64_t failed_services,
+    int64_t concurrency);
+
+  int64_t resolve_us() const;
+  void set_resolve_us(int64_t value_arg);
+
+  int64_t services_us() const;
+  void set_services_us(int64_t value_arg);
+
+  int64_t characteristics_us() const;
+  void set_characteristics_us(int64_t value_arg);
+
+  int64_t slowest_service_us() const;
+  void set_slowest_service_us(int64_t value_arg);
+
+  int64_t total_us() const;
+  void set_total_us(int64_t value_arg);
+
+  int64_t services() const;
+  void set_services(int64_t value_arg);
+
+  int64_t characteristics() const;
+  void set_characteristics(int64_t value_arg);
+
+  int64_t failed_services() const;
+  void set_failed_services(int64_t value_arg);
+
+  int64_t concurrency() const;
+  void set_concurrency(int64_t value_arg);
+
+  bool operator==(const BtConnectTimings& other) const;
+  bool operator!=(const BtConnectTimings& other) const;
+  /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
+  size_t Hash() const;
+ private:
+  static BtConnectTimings FromEncodableList(const ::flutter::EncodableList& list);
+  ::flutter::EncodableList ToEncodableList() const;
+  friend class LayrzBlePlatformChannel;
+  friend class LayrzBleCallbackChannel;
+  friend class PigeonInternalCodecSerializer;
+  int64_t resolve_us_;
+  int64_t services_us_;
+  int64_t characteristics_us_;
+  int64_t slowest_service_us_;
+  int64_t total_us_;
+  int64_t services_;
+  int64_t characteristics_;
+  int64_t failed_services_;
+  int64_t concurrency_;
+};
+
+
 class PigeonInternalCodecSerializer : public ::flutter::StandardCodecSerializer {
  public:
   PigeonInternalCodecSerializer();
@@ -524,6 +978,69 @@ class LayrzBlePlatformChannel {
     bool request_confirmation,
     std::function<void(ErrorOr<bool> reply)> result) = 0;
   virtual void OpenBluetoothSettings(std::function<void(ErrorOr<bool> reply)> result) = 0;
+  virtual void RequestScanResync(std::function<void(ErrorOr<bool> reply)> result) = 0;
+  virtual void SetScanCacheLimits(
+    const int64_t* max_devices,
+    const int64_t* device_ttl_ms,
+    std::function<void(ErrorOr<bool> reply)> result) = 0;
+  virtual void GetScanCacheStats(std::function<void(ErrorOr<BtScanCacheStats> reply)> result) = 0;
+  virtual void SetScanAddressFilters(
+    const ::flutter::EncodableList& allowlist,
+    const ::flutter::EncodableList& denylist,
+    std::function<void(ErrorOr<bool> reply)> result) = 0;
+  virtual void SetManufacturerDataFilters(
+    const ::flutter::EncodableList& filters,
+    std::function<void(ErrorOr<bool> reply)> result) = 0;
+  virtual void GetManufacturerDataFilterHits(std::function<void(ErrorOr<::flutter::EncodableList> reply)> result) = 0;
+  virtual void SetRssiSmoothing(
+    int64_t mode,
+    double ema_alpha,
+    double kalman_process_noise,
+    double kalman_measurement_noise,
+    int64_t median_window,
+    int64_t min_delta_dbm,
+    int64_t max_interval_ms,
+    std::function<void(ErrorOr<bool> reply)> result) = 0;
+  virtual void SetScanCapture(
+    const std::string* path,
+    std::function<void(ErrorOr<bool> reply)> result) = 0;
+  virtual void GetScanMetrics(
+    bool reset,
+    std::function<void(ErrorOr<BtScanMetrics> reply)> result) = 0;
+  virtual void DumpScanMetrics(std::function<void(ErrorOr<bool> reply)> result) = 0;
+  virtual void SetScanBackpressure(
+    int64_t policy,
+    int64_t max_queued_devices,
+    std::function<void(ErrorOr<bool> reply)> result) = 0;
+  virtual void GetScanQueueStats(std::function<void(ErrorOr<BtScanQueueStats> reply)> result) = 0;
+  virtual void GetAdvertisingInfo(
+    const std::string& mac_address,
+    std::function<void(ErrorOr<std::optional<BtAdvertisingInfo>> reply)> result) = 0;
+  virtual void GetConnectTimings(std::function<void(ErrorOr<std::optional<BtConnectTimings>> reply)> result) = 0;
+  virtual void SetGattCache(
+    const std::string* directory,
+    std::function<void(ErrorOr<bool> reply)> result) = 0;
+  virtual void ClearGattCache(std::function<void(ErrorOr<int64_t> reply)> result) = 0;
+  virtual void SetLazyServiceDiscovery(
+    bool enabled,
+    std::function<void(ErrorOr<bool> reply)> result) = 0;
+  virtual void ReadCharacteristicByHandle(
+    int64_t handle,
+    std::function<void(ErrorOr<std::vector<uint8_t>> reply)> result) = 0;
+  virtual void WriteCharacteristicByHandle(
+    int64_t handle,
+    const std::vector<uint8_t>& payload,
+    bool with_response,
+    std::function<void(ErrorOr<bool> reply)> result) = 0;
+  virtual void StartNotifyByHandle(
+    int64_t handle,
+    std::function<void(ErrorOr<bool> reply)> result) = 0;
+  virtual void StopNotifyByHandle(
+    int64_t handle,
+    std::function<void(ErrorOr<bool> reply)> result) = 0;
+  virtual void SetScanCoalescingWindow(
+    int64_t window_ms,
+    std::function<void(ErrorOr<bool> reply)> result) = 0;
 
   // The codec used by LayrzBlePlatformChannel.
   static const ::flutter::StandardMessageCodec& GetCodec();
@@ -552,6 +1069,10 @@ class LayrzBleCallbackChannel {
     const BtDevice& device,
     std::function<void(void)>&& on_success,
     std::function<void(const FlutterError&)>&& on_error);
+  void OnScanResults(
+    const ::flutter::EncodableList& devices,
+    std::function<void(void)>&& on_success,
+    std::function<void(const FlutterError&)>&& on_error);
   void OnBluetoothOn(
     std::function<void(void)>&& on_success,
     std::function<void(const FlutterError&)>&& on_error);
@@ -603,6 +1124,15 @@ class LayrzBleCallbackChannel {
     int64_t new_mtu,
     std::function<void(void)>&& on_success,
     std::function<void(const FlutterError&)>&& on_error);
+  void OnScanDeltas(
+    const ::flutter::EncodableList& deltas,
+    std::function<void(void)>&& on_success,
+    std::function<void(const FlutterError&)>&& on_error);
+  void OnDeviceLost(
+    const std::string& mac_address,
+    const int64_t* address_type,
+    std::function<void(void)>&& on_success,
+    std::function<void(const FlutterError&)>&& on_error);
  private:
   ::flutter::BinaryMessenger* binary_messenger_;
   std::string message_channel_suffix_;
@@ -5,10 +5,19 @@ namespace layrz_ble {
   using layrz_ble::LayrzBleCallbackChannel;
   using layrz_ble::LayrzBlePlatformChannel;
 
-  std::string LayrzBlePlugin::filteredDeviceId = std::string("");
   std::unique_ptr<BleScanResult> LayrzBlePlugin::connectedDevice = nullptr;
+  std::optional<BluetoothLEDevice> LayrzBlePlugin::connectedBtDevice = std::nullopt;
   static std::unique_ptr<LayrzBleCallbackChannel> callbackChannel;
 
+  // Properties of the classic watcher devices
+  static constexpr wchar_t kClassicAddressProperty[] = L"System.Devices.Aep.DeviceAddress";
+  static constexpr wchar_t kClassicSignalStrengthProperty[] = L"System.Devices.Aep.SignalStrength";
+  static constexpr wchar_t kClassicNameProperty[] = L"System.ItemNameDisplay";
+
+  // GetCharacteristicsAsync requests in flight while connecting, the stack serializes the ATT requests of
+  // a link anyway, a few are enough to hide the round trips
+  static constexpr size_t kMaxConcurrentDiscoveries = 4;
+
   /// @brief Register the plugin with the registrar
   /// @param registrar
   /// @return void
@@ -22,11 +31,18 @@ namespace layrz_ble {
   /// @brief Construct a new LayrzBlePlugin object
   /// @param registrar
   LayrzBlePlugin::LayrzBlePlugin(flutter::PluginRegistrarWindows *registrar) : uiThreadHandler_(registrar) {
+    scanEngine_.setEvictionHandler([this](const BleScanResult &device, EvictionReason) {
+      onDeviceEvicted(device);
+    });
     GetRadiosAsync();
   }
 
   /// @brief Destroy the LayrzBlePlugin object
-  LayrzBlePlugin::~LayrzBlePlugin() = default;
+  LayrzBlePlugin::~LayrzBlePlugin() {
+    stopLeWatcher();
+    stopScanFlushTimer();
+    scanIngest_.stop();
+  }
 
   /// @brief Get the Radios available on the system
   /// @return winrt::fire_and_forget
@@ -145,11 +161,30 @@ namespace layrz_ble {
     const flutter::EncodableList* services_uuids,
     std::function<void(ErrorOr<bool> reply)> result
   ) {
-    if (mac_address != nullptr) {
-      // Set the filtered device ID to the provided MAC address and uppercase it
-      filteredDeviceId = toUppercase(*mac_address);
-    } else {
-      filteredDeviceId = std::string("");
+    {
+      std::lock_guard<std::mutex> lock(scanMutex_);
+      if (mac_address != nullptr) {
+        // Set the filtered device ID to the provided MAC address, the engine uppercases it
+        scanEngine_.setFilteredDeviceId(*mac_address);
+      } else {
+        scanEngine_.setFilteredDeviceId("");
+      }
+
+      // The services are matched against the raw advertisements, the unrelated devices never reach the table
+      ServiceUuidFilter serviceFilter;
+      if (services_uuids != nullptr) {
+        for (const auto &value : *services_uuids) {
+          const auto *uuid = std::get_if<std::string>(&value);
+          if (uuid == nullptr || !serviceFilter.add(*uuid)) {
+            Log("Ignoring invalid service UUID in the scan filter");
+          }
+        }
+      }
+      Log("Scanning for %zu service UUIDs", serviceFilter.size());
+      scanEngine_.setServiceFilter(std::move(serviceFilter));
+
+      // A new scan starts with full snapshots, the Flutter side drops its cache as well
+      scanDeltas_.clear();
     }
 
     if (btRadio && btRadio.State() == RadioState::On) {
@@ -164,13 +199,33 @@ namespace layrz_ble {
         Log("Bluetooth(Classic) watcher already started");
       }
 
+      // The worker merges what the `Received` handler pushes into the ingest ring
+      scanIngest_.resetStats();
+      scanIngest_.start([this](const std::vector<AdvertisementView> &batch) {
+        handleBleAdvertisements(batch);
+      });
+      {
+        std::lock_guard<std::mutex> producer(leProducerMutex_);
+        leProducing_ = true;
+      }
+
       if (leScanner.Status() != BluetoothLEAdvertisementWatcherStatus::Started) {
         Log("Starting Bluetooth LE watcher");
-        leScanner.Start();
+        try {
+          leScanner.Start();
+        } catch (...) {
+          // The reused watcher may still be stopping from the previous scan
+          Log("Bluetooth LE watcher could not be started, status: %s", castLeScannerStatus(leScanner.Status()).c_str());
+          stopLeWatcher();
+          scanIngest_.stop();
+          result(false);
+          return;
+        }
       } else {
         Log("Bluetooth LE watcher already started");
       }
 
+      startScanFlushTimer();
       result(true);
       return;
     }
@@ -194,15 +249,545 @@ namespace layrz_ble {
 
     if (leScanner != nullptr) {
       Log("Stopping Bluetooth LE watcher");
-      leScanner.Stop();
-      leScanner = nullptr;
+      stopLeWatcher();
     } else {
       Log("Bluetooth LE watcher is not running");
     }
 
+    // Merge the advertisements still in the ring, then send whatever is pending of the last window
+    scanIngest_.stop();
+    stopScanFlushTimer();
+    flushScanResults(true);
+
+    auto ingestStats = scanIngest_.Stats();
+    Log(
+      "Scan ingest: %llu advertisements (%llu extended, %llu truncated) in %llu batches, %llu overruns, max ring depth %zu of %zu",
+      static_cast<unsigned long long>(ingestStats.processed),
+      static_cast<unsigned long long>(ingestStats.extended),
+      static_cast<unsigned long long>(ingestStats.truncated),
+      static_cast<unsigned long long>(ingestStats.batches),
+      static_cast<unsigned long long>(ingestStats.overruns),
+      ingestStats.highWatermark,
+      ingestStats.capacity
+    );
+    Log("Scan metrics: %s", scanMetrics_.format().c_str());
+
+    logScanQueueStats();
+
+    {
+      std::lock_guard<std::mutex> lock(scanMutex_);
+      if (scanEngine_.ServiceFilter().isEnabled()) {
+        Log(
+          "Service filter: %llu devices matched, %llu advertisements dropped",
+          static_cast<unsigned long long>(scanEngine_.ServiceFilterMatches()),
+          static_cast<unsigned long long>(scanEngine_.ServiceFilterDrops())
+        );
+      }
+      if (scanEngine_.ManufacturerFilter().isEnabled()) {
+        Log(
+          "Manufacturer data filter: %llu advertisements dropped",
+          static_cast<unsigned long long>(scanEngine_.ManufacturerFilterDrops())
+        );
+      }
+      if (scanCapture_ != nullptr) {
+        scanCapture_->flush();
+      }
+      Log(
+        "Classic devices: %zu known, %llu LE names resolved from them",
+        deviceIdentities_.size(),
+        static_cast<unsigned long long>(deviceIdentities_.ResolvedNames())
+      );
+    }
+
+    result(true);
+  }
+
+  /// @brief Send a full snapshot of every visible device on the next flush
+  /// @param result the callback to return the result
+  /// @return void
+  /// @note Called by the Flutter side when it gets a delta of a device it does not know,
+  /// like after a hot restart in the middle of a scan
+  void LayrzBlePlugin::RequestScanResync(std::function<void(ErrorOr<bool> reply)> result) {
+    {
+      std::lock_guard<std::mutex> lock(scanMutex_);
+      scanDeltas_.requestResync();
+
+      if (scanCoalescer_.isEnabled()) {
+        auto nowUs = monotonicNowUs();
+        for (const auto &device : scanEngine_.VisibleDevices()) {
+          scanCoalescer_.add(device.Key(), nowUs);
+        }
+      }
+    }
+
+    result(true);
+  }
+
+  /// @brief Bound the table of visible devices
+  /// @param max_devices max number of devices, 0 for unbounded, nullptr to keep the current one
+  /// @param device_ttl_ms time after which an unseen device is evicted, 0 to disable the aging, nullptr to
+  /// keep the current one
+  /// @param result the callback to return the result
+  /// @return void
+  /// @note Evicted devices are reported to the Flutter side through onDeviceLost
+  void LayrzBlePlugin::SetScanCacheLimits(const int64_t* max_devices, const int64_t* device_ttl_ms, std::function<void(ErrorOr<bool> reply)> result) {
+    if ((max_devices && *max_devices < 0) || (device_ttl_ms && *device_ttl_ms < 0)) {
+      // A null limit is left unchanged, 0 would read as unbounded
+      std::string maxDevices = max_devices ? std::to_string(*max_devices) + " devices" : "devices unchanged";
+      std::string deviceTtl = device_ttl_ms ? std::to_string(*device_ttl_ms) + " ms" : "TTL unchanged";
+      Log("Invalid scan cache limits: %s, %s", maxDevices.c_str(), deviceTtl.c_str());
+      result(false);
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(scanMutex_);
+      if (max_devices) {
+        scanEngine_.setMaxDevices(static_cast<size_t>(*max_devices));
+      }
+      if (device_ttl_ms) {
+        scanEngine_.setDeviceTtlUs(*device_ttl_ms * 1000);
+      }
+    }
+
+    result(true);
+  }
+
+  /// @brief Set the window over which the scan results are coalesced
+  /// @param window_ms milliseconds, 0 sends every merged result right away, one message per advertisement
+  /// @param result the callback to return the result
+  /// @return void
+  /// @note The devices pending under the previous window are flushed, and the flush timer of a running
+  /// scan is restarted with the new period (or not at all with a window of 0)
+  void LayrzBlePlugin::SetScanCoalescingWindow(int64_t window_ms, std::function<void(ErrorOr<bool> reply)> result) {
+    if (window_ms < 0) {
+      Log("Invalid scan coalescing window: %lld ms", static_cast<long long>(window_ms));
+      result(false);
+      return;
+    }
+
+    bool scanning = scanIngest_.isRunning();
+    stopScanFlushTimer();
+    {
+      std::lock_guard<std::mutex> lock(scanMutex_);
+      scanCoalescer_.setWindowUs(window_ms * 1000);
+    }
+    flushScanResults(true);
+
+    if (scanning) {
+      startScanFlushTimer();
+    }
+
+    Log("Scan coalescing window: %lld ms", static_cast<long long>(window_ms));
+    result(true);
+  }
+
+  /// @brief Get the size and the memory usage of the table of visible devices
+  /// @param result the callback to return the stats
+  /// @return void
+  void LayrzBlePlugin::GetScanCacheStats(std::function<void(ErrorOr<BtScanCacheStats> reply)> result) {
+    std::lock_guard<std::mutex> lock(scanMutex_);
+    result(BtScanCacheStats(
+      static_cast<int64_t>(scanEngine_.size()),
+      static_cast<int64_t>(scanEngine_.MaxDevices()),
+      scanEngine_.DeviceTtlUs() / 1000,
+      static_cast<int64_t>(scanEngine_.EvictedByTtl()),
+      static_cast<int64_t>(scanEngine_.EvictedByCapacity()),
+      static_cast<int64_t>(scanEngine_.ApproximateBytes()),
+      static_cast<int64_t>(deviceIdentities_.size())
+    ));
+  }
+
+  /// @brief Replace the allowlist and denylist of addresses of the scan, the watchers keep running
+  /// @param allowlist the only addresses to report, an empty list allows every address
+  /// @param denylist the addresses to never report, it wins over the allowlist
+  /// @param result the callback to return the result
+  /// @return void
+  /// @note The sets are built before taking the scan lock, so the advertisements are not held back by a
+  /// large list. The visible devices rejected by the new lists are reported as lost.
+  void LayrzBlePlugin::SetScanAddressFilters(
+    const flutter::EncodableList& allowlist,
+    const flutter::EncodableList& denylist,
+    std::function<void(ErrorOr<bool> reply)> result
+  ) {
+    std::vector<uint64_t> allowed;
+    std::vector<uint64_t> denied;
+    if (!parseAddressList(allowlist, allowed) || !parseAddressList(denylist, denied)) {
+      result(false);
+      return;
+    }
+
+    AddressFilter filter;
+    filter.setAllowed(allowed);
+    filter.setDenied(denied);
+
+    size_t evicted = 0;
+    {
+      std::lock_guard<std::mutex> lock(scanMutex_);
+      evicted = scanEngine_.setAddressLists(std::move(filter));
+    }
+
+    Log("Scan address filters: %zu allowed, %zu denied, %zu visible devices dropped", allowed.size(), denied.size(), evicted);
+    result(true);
+  }
+
+  /// @brief Replace the manufacturer data filters of the scan, the watchers keep running
+  /// @param filters list of BtManufacturerDataFilter, an empty list disables the filter
+  /// @param result the callback to return the result
+  /// @return void
+  /// @note The filters are compiled here, the `Received` handler matches the raw bytes against them.
+  /// Only the new devices are checked, the visible ones are kept.
+  void LayrzBlePlugin::SetManufacturerDataFilters(const flutter::EncodableList& filters, std::function<void(ErrorOr<bool> reply)> result) {
+    std::vector<ManufacturerDataRule> rules;
+    rules.reserve(filters.size());
+    for (const auto &value : filters) {
+      const auto *custom = std::get_if<flutter::CustomEncodableValue>(&value);
+      if (custom == nullptr) {
+        Log("Invalid manufacturer data filter");
+        result(false);
+        return;
+      }
+
+      const auto &filter = std::any_cast<const BtManufacturerDataFilter&>(*custom);
+      if (filter.company_id() < 0 || filter.company_id() > 0xFFFF || filter.offset() < 0 || filter.group() < 0) {
+        Log("Invalid manufacturer data filter: company 0x%llX, offset %lld", filter.company_id(), filter.offset());
+        result(false);
+        return;
+      }
+
+      ManufacturerDataRule rule;
+      rule.companyId = static_cast<uint16_t>(filter.company_id());
+      rule.offset = static_cast<size_t>(filter.offset());
+      rule.value = filter.value();
+      if (filter.mask() != nullptr) {
+        rule.mask = *filter.mask();
+      }
+      rule.group = static_cast<uint32_t>(filter.group());
+      rules.push_back(std::move(rule));
+    }
+
+    ManufacturerDataFilter compiled;
+    if (!compiled.compile(rules)) {
+      Log("Invalid manufacturer data filters, up to %zu filters whose mask matches the value size", ManufacturerDataFilter::kMaxRules);
+      result(false);
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(scanMutex_);
+      scanEngine_.setManufacturerFilter(std::move(compiled));
+    }
+
+    Log("%zu manufacturer data filters set", rules.size());
+    result(true);
+  }
+
+  /// @brief Get the number of advertisements matched by each manufacturer data filter
+  /// @param result the callback to return the counters, in the order of the filters
+  /// @return void
+  void LayrzBlePlugin::GetManufacturerDataFilterHits(std::function<void(ErrorOr<flutter::EncodableList> reply)> result) {
+    flutter::EncodableList hits;
+    {
+      std::lock_guard<std::mutex> lock(scanMutex_);
+      for (uint64_t count : scanEngine_.ManufacturerFilter().Hits()) {
+        hits.push_back(flutter::EncodableValue(static_cast<int64_t>(count)));
+      }
+    }
+
+    result(hits);
+  }
+
+  /// @brief Set how the RSSI of the scanned devices is smoothed and when it is reported again
+  /// @param mode 0 none, 1 EMA, 2 Kalman, 3 median
+  /// @param ema_alpha weight of a new sample for the EMA, in (0, 1]
+  /// @param kalman_process_noise variance of the real signal change between samples, in dBm²
+  /// @param kalman_measurement_noise variance of the measurement noise, in dBm²
+  /// @param median_window number of samples of the median, odd and up to 15
+  /// @param min_delta_dbm move of the smoothed RSSI needed to report it
+  /// @param max_interval_ms time after which a smaller move is reported anyway, 0 to disable
+  /// @param result the callback to return the result
+  /// @return void
+  void LayrzBlePlugin::SetRssiSmoothing(
+    int64_t mode,
+    double ema_alpha,
+    double kalman_process_noise,
+    double kalman_measurement_noise,
+    int64_t median_window,
+    int64_t min_delta_dbm,
+    int64_t max_interval_ms,
+    std::function<void(ErrorOr<bool> reply)> result
+  ) {
+    if (mode < static_cast<int64_t>(RssiSmoothingMode::kNone) || mode > static_cast<int64_t>(RssiSmoothingMode::kMedian) ||
+        median_window < 0 || max_interval_ms < 0) {
+      Log("Invalid RSSI smoothing: mode %lld, window %lld, interval %lld ms", mode, median_window, max_interval_ms);
+      result(false);
+      return;
+    }
+
+    RssiSmoothingConfig config;
+    config.mode = static_cast<RssiSmoothingMode>(mode);
+    config.emaAlpha = ema_alpha;
+    config.kalmanProcessNoise = kalman_process_noise;
+    config.kalmanMeasurementNoise = kalman_measurement_noise;
+    config.medianWindow = static_cast<size_t>(median_window);
+    config.minDeltaDbm = min_delta_dbm;
+    config.maxIntervalUs = max_interval_ms * 1000;
+
+    bool valid = false;
+    {
+      std::lock_guard<std::mutex> lock(scanMutex_);
+      valid = scanEngine_.setRssiSmoothing(config);
+    }
+
+    if (!valid) {
+      Log("Invalid RSSI smoothing parameters for mode %lld", mode);
+    }
+    result(valid);
+  }
+
+  /// @brief Record the raw advertisements of the scan to a capture file, or stop recording
+  /// @param path the capture file, appended to if it exists, nullptr to stop the capture
+  /// @param result the callback to return the result
+  /// @return void
+  /// @note The records are written by the ingest worker, before the merge, so the filtered ones are kept.
+  /// The file is opened and closed outside of the scan lock.
+  void LayrzBlePlugin::SetScanCapture(const std::string* path, std::function<void(ErrorOr<bool> reply)> result) {
+    std::unique_ptr<CaptureWriter> capture;
+    if (path != nullptr) {
+      capture = std::make_unique<CaptureWriter>();
+      std::string error;
+      if (!capture->open(*path, error)) {
+        Log("Cannot start the scan capture: %s", error.c_str());
+        result(false);
+        return;
+      }
+      Log("Capturing the scan advertisements to %s", path->c_str());
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(scanMutex_);
+      scanCapture_.swap(capture);
+    }
+
+    if (capture != nullptr) {
+      Log(
+        "Scan capture of %s closed, %llu records",
+        capture->Path().c_str(),
+        static_cast<unsigned long long>(capture->RecordCount())
+      );
+    }
+    result(true);
+  }
+
+  /// @brief Get the counters and latency histograms of the scan path
+  /// @param reset start the metrics over once read
+  /// @param result the callback to return the metrics
+  /// @return void
+  /// @note The counters are read one by one while the scan runs, they may be off by the advertisements
+  /// in flight
+  void LayrzBlePlugin::GetScanMetrics(bool reset, std::function<void(ErrorOr<BtScanMetrics> reply)> result) {
+    auto histogram = [](const LatencyHistogram &latencies) {
+      flutter::EncodableList buckets;
+      buckets.reserve(LatencyHistogram::kBucketCount);
+      for (size_t i = 0; i < LatencyHistogram::kBucketCount; i++) {
+        buckets.push_back(flutter::EncodableValue(static_cast<int64_t>(latencies.Bucket(i))));
+      }
+      return buckets;
+    };
+    auto count = [this](ScanStage stage) {
+      return static_cast<int64_t>(scanMetrics_.Count(stage));
+    };
+
+    BtScanMetrics metrics(
+      count(ScanStage::kReceived),
+      count(ScanStage::kDropped),
+      count(ScanStage::kFiltered),
+      count(ScanStage::kDuplicate),
+      count(ScanStage::kMerged),
+      count(ScanStage::kCoalesced),
+      count(ScanStage::kEncoded),
+      count(ScanStage::kPosted),
+      histogram(scanMetrics_.IngestLatency()),
+      scanMetrics_.IngestLatency().MaxUs(),
+      histogram(scanMetrics_.PostLatency()),
+      scanMetrics_.PostLatency().MaxUs()
+    );
+
+    if (reset) {
+      scanMetrics_.reset();
+    }
+    result(metrics);
+  }
+
+  /// @brief Write the scan metrics to the log
+  /// @param result the callback to return the result
+  /// @return void
+  void LayrzBlePlugin::DumpScanMetrics(std::function<void(ErrorOr<bool> reply)> result) {
+    Log("Scan metrics: %s", scanMetrics_.format().c_str());
+
+    logScanQueueStats();
+    result(true);
+  }
+
+  /// @brief Write the counters of the scan event queue to the log
+  /// @return void
+  void LayrzBlePlugin::logScanQueueStats() {
+    auto queueStats = scanEvents_.Stats();
+    Log(
+      "Scan events (%s): %llu queued, %llu dropped (%llu devices), %llu flushes held back, %llu pauses, max depth %zu of %zu devices",
+      backpressurePolicyName(queueStats.policy),
+      static_cast<unsigned long long>(queueStats.queuedEvents),
+      static_cast<unsigned long long>(queueStats.droppedEvents),
+      static_cast<unsigned long long>(queueStats.droppedDevices),
+      static_cast<unsigned long long>(queueStats.deferredFlushes),
+      static_cast<unsigned long long>(queueStats.pauses),
+      queueStats.highWatermark,
+      queueStats.capacity
+    );
+  } // logScanQueueStats
+
+  /// @brief Bound the scan messages waiting for the UI thread
+  /// @param policy 0 drop oldest, 1 latest per device, 2 pause watcher
+  /// @param max_queued_devices max number of waiting devices, at least 1
+  /// @param result the callback to return the result
+  /// @return void
+  void LayrzBlePlugin::SetScanBackpressure(int64_t policy, int64_t max_queued_devices, std::function<void(ErrorOr<bool> reply)> result) {
+    if (policy < 0 || policy > static_cast<int64_t>(BackpressurePolicy::kPauseWatcher) || max_queued_devices < 1) {
+      Log("Invalid scan backpressure: policy %lld, %lld devices", static_cast<long long>(policy), static_cast<long long>(max_queued_devices));
+      result(false);
+      return;
+    }
+
+    scanEvents_.setPolicy(static_cast<BackpressurePolicy>(policy));
+    scanEvents_.setCapacity(static_cast<size_t>(max_queued_devices));
+    Log(
+      "Scan backpressure: %s, up to %lld queued devices",
+      backpressurePolicyName(static_cast<BackpressurePolicy>(policy)),
+      static_cast<long long>(max_queued_devices)
+    );
     result(true);
   }
 
+  /// @brief Get the counters of the scan messages waiting for the UI thread
+  /// @param result the callback to return the stats
+  /// @return void
+  void LayrzBlePlugin::GetScanQueueStats(std::function<void(ErrorOr<BtScanQueueStats> reply)> result) {
+    auto stats = scanEvents_.Stats();
+    result(BtScanQueueStats(
+      static_cast<int64_t>(stats.policy),
+      static_cast<int64_t>(stats.capacity),
+      static_cast<int64_t>(stats.depth),
+      static_cast<int64_t>(stats.highWatermark),
+      static_cast<int64_t>(stats.queuedEvents),
+      static_cast<int64_t>(stats.deliveredEvents),
+      static_cast<int64_t>(stats.droppedEvents),
+      static_cast<int64_t>(stats.droppedDevices),
+      static_cast<int64_t>(stats.deferredFlushes),
+      static_cast<int64_t>(stats.pauses),
+      static_cast<int64_t>(stats.pausedAdvertisements)
+    ));
+  }
+
+  /// @brief Get the Bluetooth 5 advertising details of a visible device
+  /// @param mac_address the address of the device
+  /// @param result the callback to return the details, std::nullopt if the device is not visible
+  /// @return void
+  /// @note The PHYs stay unknown before the Windows 11 24H2 SDK, the advertising SID is never reported
+  void LayrzBlePlugin::GetAdvertisingInfo(const std::string& mac_address, std::function<void(ErrorOr<std::optional<BtAdvertisingInfo>> reply)> result) {
+    std::lock_guard<std::mutex> lock(scanMutex_);
+    auto visible = scanEngine_.findByDeviceId(mac_address);
+    if (visible == nullptr) {
+      result(ErrorOr<std::optional<BtAdvertisingInfo>>(std::nullopt));
+      return;
+    }
+
+    BtAdvertisingInfo info(
+      visible->isExtended(),
+      static_cast<int64_t>(visible->PrimaryPhy()),
+      static_cast<int64_t>(visible->SecondaryPhy()),
+      static_cast<int64_t>(visible->AdvertisingSid()),
+      static_cast<int64_t>(visible->MaxPayloadLength())
+    );
+    result(ErrorOr<std::optional<BtAdvertisingInfo>>(std::move(info)));
+  }
+
+  /// @brief Get the phases of the last successful connection
+  /// @param result the callback to return the timings, std::nullopt before the first connection
+  /// @return void
+  void LayrzBlePlugin::GetConnectTimings(std::function<void(ErrorOr<std::optional<BtConnectTimings>> reply)> result) {
+    std::optional<ConnectTimings> timings;
+    {
+      std::lock_guard<std::mutex> lock(connectTimingsMutex_);
+      timings = lastConnectTimings_;
+    }
+    if (!timings) {
+      result(ErrorOr<std::optional<BtConnectTimings>>(std::nullopt));
+      return;
+    }
+
+    BtConnectTimings payload(
+      timings->resolveUs,
+      timings->servicesUs,
+      timings->characteristicsUs,
+      timings->slowestServiceUs,
+      timings->totalUs,
+      static_cast<int64_t>(timings->services),
+      static_cast<int64_t>(timings->characteristics),
+      static_cast<int64_t>(timings->failedServices),
+      static_cast<int64_t>(timings->concurrency)
+    );
+    result(ErrorOr<std::optional<BtConnectTimings>>(std::move(payload)));
+  }
+
+  /// @brief Cache the GATT layouts of the connected devices in a directory
+  /// @param directory nullptr disables the cache, the files are kept
+  /// @param result the callback to return the result
+  /// @return void
+  void LayrzBlePlugin::SetGattCache(const std::string* directory, std::function<void(ErrorOr<bool> reply)> result) {
+    if (directory == nullptr) {
+      gattCache_.close();
+      Log("GATT cache disabled");
+      result(true);
+      return;
+    }
+
+    std::string error;
+    if (!gattCache_.open(*directory, error)) {
+      Log("Cannot use the GATT cache: %s", error.c_str());
+      result(false);
+      return;
+    }
+    Log("Caching the GATT layouts in %s", directory->c_str());
+    result(true);
+  }
+
+  /// @brief Choose between discovering every service on connect and discovering them on first use
+  /// @param enabled true to connect without discovering, applies to the next connection
+  /// @param result the callback to return the result
+  /// @return void
+  void LayrzBlePlugin::SetLazyServiceDiscovery(bool enabled, std::function<void(ErrorOr<bool> reply)> result) {
+    lazyDiscovery_ = enabled;
+    Log("Service discovery: %s", enabled ? "on first use" : "on connect");
+    result(true);
+  }
+
+  /// @brief Delete every cached GATT layout
+  /// @param result the callback to return the number of layouts deleted
+  /// @return void
+  void LayrzBlePlugin::ClearGattCache(std::function<void(ErrorOr<int64_t> reply)> result) {
+    auto erased = gattCache_.clear();
+    auto stats = gattCache_.Stats();
+    Log(
+      "GATT cache cleared, %zu layouts deleted (hits %llu, misses %llu, corrupt %llu, stores %llu)",
+      erased,
+      static_cast<unsigned long long>(stats.hits),
+      static_cast<unsigned long long>(stats.misses),
+      static_cast<unsigned long long>(stats.corrupt),
+      static_cast<unsigned long long>(stats.stores)
+    );
+    result(static_cast<int64_t>(erased));
+  }
+
   /// @brief Connect to a device
   /// @param mac_address the address of the device to connect to
   /// @param result the callback to return the result of the connection
@@ -224,8 +809,15 @@ namespace layrz_ble {
   /// @return void
   /// @note The result is returned as a boolean
   winrt::fire_and_forget LayrzBlePlugin::connectAsync(const std::string& mac_address, std::function<void(ErrorOr<bool> reply)> result) {
-    auto it = visibleDevices.find(toUppercase(mac_address));
-    if (it == visibleDevices.end()) {
+    std::optional<BleScanResult> found;
+    {
+      std::lock_guard<std::mutex> lock(scanMutex_);
+      auto visible = scanEngine_.findByDeviceId(mac_address);
+      if (visible != nullptr)
+        found = *visible;
+    }
+
+    if (!found) {
       Log("Device not found");
       result(false);
       return;
@@ -235,19 +827,22 @@ namespace layrz_ble {
       btScanner.Stop();
       btScanner = nullptr;
     }
-    if (leScanner != nullptr) {
-      leScanner.Stop();
-      leScanner = nullptr;
-    }
+    stopLeWatcher();
+    scanIngest_.stop();
+    stopScanFlushTimer();
+    flushScanResults(true);
 
-    auto device = it->second;
+    BleScanResult device = *found;
     Log("Connecting to device: %s", mac_address.c_str());
 
+    auto connectStartUs = monotonicNowUs();
+    bool lazy = lazyDiscovery_;
     try {
       Log("Connecting to device async: %s", device.DeviceId().c_str());
       uint64_t btAddress = device.Address();
       Log("\tBluetooth address: %s", std::to_string(btAddress).c_str());
       auto btDevice = co_await BluetoothLEDevice::FromBluetoothAddressAsync(btAddress);
+      auto resolveUs = monotonicNowUs() - connectStartUs;
       if (!btDevice) {
         Log("Failed to connect to device %s", device.DeviceId().c_str());
         result(false);
@@ -257,35 +852,67 @@ namespace layrz_ble {
       Log("Connected to device: %s", device.DeviceId().c_str());
   
       servicesAndCharacteristics.clear();
+      characteristicIndex_.clear();
       servicesNotifying.clear();
-      device.setDevice(btDevice);
-  
-      Log("Device found, attempting to get GATT services");
-      auto servicesResult = co_await btDevice.GetGattServicesAsync((BluetoothCacheMode::Uncached));
-      auto status = servicesResult.Status();
-      if (status != GattCommunicationStatus::Success) {
-        Log("Failed to get GATT services");
-        result(false);
-        co_return;
-      }
-      Log("%d GATT services found", servicesResult.Services().Size());
+      allServicesDiscovered_ = false;
+      connectionLazy_ = lazy;
+
+      // A lazy connection discovers each service the first time it is referenced, see withCharacteristic()
+      GattLayout cached;
+      auto discovery = std::make_shared<GattDiscovery>();
+      auto gattCache = gattCache_.isEnabled() && !lazy ? GattCacheResult::kMiss : GattCacheResult::kDisabled;
+      if (!lazy) {
+        // A layout cached on disk is checked against what Windows already holds for the device, which
+        // costs no air time. Only a miss or a stale layout asks the device.
+        if (gattCache_.load(btAddress, cached)) {
+          Log("Device found, checking the cached GATT layout");
+          co_await discoverGattAsync(btDevice, BluetoothCacheMode::Cached, discovery);
+          if (discovery->success && discovery->layout.sameStructure(cached)) {
+            gattCache = GattCacheResult::kHit;
+          } else {
+            Log("Cached GATT layout is stale");
+            gattCache = GattCacheResult::kStale;
+            gattCache_.erase(btAddress);
+            discovery = std::make_shared<GattDiscovery>();
+          }
+        }
 
-      for (auto service : servicesResult.Services()) {
-        auto serviceUuid = toUppercase(GuidToString(service.Uuid()));
-        // Log("\tParsing service %s", serviceUuid.c_str());
-        servicesAndCharacteristics[serviceUuid] = BleService(service);
-  
-        auto characteristics = co_await service.GetCharacteristicsAsync(BluetoothCacheMode::Uncached);
-        for (auto characteristic : characteristics.Characteristics()) {
-          auto characteristicUuid = toUppercase(GuidToString(characteristic.Uuid()));
-          // Log("\t\tParsing characteristic %s", characteristicUuid.c_str());
-          servicesAndCharacteristics[serviceUuid].addCharacteristic(BleCharacteristic(characteristic));
+        if (gattCache != GattCacheResult::kHit) {
+          Log("Device found, attempting to get GATT services");
+          co_await discoverGattAsync(btDevice, BluetoothCacheMode::Uncached, discovery);
+          if (!discovery->success) {
+            Log("Failed to get GATT services");
+            result(false);
+            co_return;
+          }
         }
+        servicesAndCharacteristics = std::move(discovery->services);
+        allServicesDiscovered_ = true;
+      }
+      reindexServices();
+
+      auto timings = discovery->timings;
+      timings.resolveUs = resolveUs;
+      timings.gattCache = gattCache;
+      timings.lazy = lazy;
+      timings.totalUs = monotonicNowUs() - connectStartUs;
+      Log("Connect timings: %s", timings.format().c_str());
+      {
+        std::lock_guard<std::mutex> lock(connectTimingsMutex_);
+        lastConnectTimings_ = timings;
       }
   
       btDevice.ConnectionStatusChanged({this, &LayrzBlePlugin::onConnectionStatusChanged});
+      btDevice.GattServicesChanged({this, &LayrzBlePlugin::onGattServicesChanged});
       connectedDevice = std::make_unique<BleScanResult>(device);
+      connectedBtDevice = btDevice;
       result(true);
+
+      if (gattCache == GattCacheResult::kHit) {
+        refreshGattCacheAsync(btDevice, std::move(cached), GattRefresh::kValidate);
+      } else if (gattCache != GattCacheResult::kDisabled) {
+        refreshGattCacheAsync(btDevice, std::move(discovery->layout), GattRefresh::kStore);
+      }
     } catch (...) {
       Log("Failed to connect to device, general exception");
       result(false);
@@ -293,6 +920,190 @@ namespace layrz_ble {
     }
   } // connectAsync
 
+  /// @brief Discover the services and characteristics of a device
+  /// @param device
+  /// @param cacheMode Uncached asks the device, Cached only reads what Windows holds
+  /// @param discovery receives the table, the layout and the timings of the discovery
+  /// @return IAsyncAction
+  /// @note The characteristics of up to kMaxConcurrentDiscoveries services are requested at once, the
+  /// results are joined in the order of the services so the table is only touched by this coroutine
+  IAsyncAction LayrzBlePlugin::discoverGattAsync(BluetoothLEDevice device, BluetoothCacheMode cacheMode, std::shared_ptr<GattDiscovery> discovery) {
+    auto &timings = discovery->timings;
+    auto servicesStartUs = monotonicNowUs();
+    auto servicesResult = co_await device.GetGattServicesAsync(cacheMode);
+    timings.servicesUs = monotonicNowUs() - servicesStartUs;
+    if (servicesResult.Status() != GattCommunicationStatus::Success) {
+      co_return;
+    }
+    auto services = servicesResult.Services();
+    timings.services = services.Size();
+    Log("%d GATT services found", services.Size());
+
+    struct PendingDiscovery {
+      std::string serviceUuid;
+      size_t layoutIndex;
+      IAsyncOperation<GattCharacteristicsResult> operation;
+      int64_t startedUs;
+    };
+    std::deque<PendingDiscovery> pending;
+    uint32_t next = 0;
+    discovery->layout.address = device.BluetoothAddress();
+    discovery->layout.services.reserve(services.Size());
+    auto characteristicsStartUs = monotonicNowUs();
+    while (next < services.Size() || !pending.empty()) {
+      if (next < services.Size() && pending.size() < kMaxConcurrentDiscoveries) {
+        auto service = services.GetAt(next++);
+        auto serviceUuid = toUppercase(GuidToString(service.Uuid()));
+        discovery->services[serviceUuid] = BleService(service);
+
+        GattServiceLayout serviceLayout;
+        Uuid128::parse(serviceUuid, serviceLayout.uuid);
+        serviceLayout.handle = service.AttributeHandle();
+        discovery->layout.services.push_back(std::move(serviceLayout));
+
+        pending.push_back({
+          serviceUuid,
+          discovery->layout.services.size() - 1,
+          service.GetCharacteristicsAsync(cacheMode),
+          monotonicNowUs()
+        });
+        timings.concurrency = std::max(timings.concurrency, pending.size());
+        continue;
+      }
+
+      auto request = std::move(pending.front());
+      pending.pop_front();
+      auto characteristics = co_await request.operation;
+      timings.slowestServiceUs = std::max(timings.slowestServiceUs, monotonicNowUs() - request.startedUs);
+      if (characteristics.Status() != GattCommunicationStatus::Success) {
+        Log("Failed to get the characteristics of service %s", request.serviceUuid.c_str());
+        timings.failedServices++;
+        continue;
+      }
+
+      auto &service = discovery->services[request.serviceUuid];
+      auto &serviceLayout = discovery->layout.services[request.layoutIndex];
+      for (auto characteristic : characteristics.Characteristics()) {
+        service.addCharacteristic(BleCharacteristic(characteristic));
+
+        GattCharacteristicLayout characteristicLayout;
+        Uuid128::parse(toUppercase(GuidToString(characteristic.Uuid())), characteristicLayout.uuid);
+        characteristicLayout.handle = characteristic.AttributeHandle();
+        characteristicLayout.properties = static_cast<uint32_t>(characteristic.CharacteristicProperties());
+        serviceLayout.characteristics.push_back(characteristicLayout);
+        timings.characteristics++;
+      }
+    }
+    timings.characteristicsUs = monotonicNowUs() - characteristicsStartUs;
+    discovery->success = true;
+  } // discoverGattAsync
+
+  /// @brief Read the Database Hash characteristic of a device, always from the device
+  /// @param device
+  /// @return IAsyncOperation<IBuffer> nullptr if the device has no Database Hash or it cannot be read
+  IAsyncOperation<IBuffer> LayrzBlePlugin::readDatabaseHashAsync(BluetoothLEDevice device) {
+    auto services = co_await device.GetGattServicesForUuidAsync(
+      BluetoothUuidHelper::FromShortId(kGattServiceGenericAttribute),
+      BluetoothCacheMode::Cached
+    );
+    if (services.Status() != GattCommunicationStatus::Success || services.Services().Size() == 0) {
+      co_return nullptr;
+    }
+
+    auto characteristics = co_await services.Services().GetAt(0).GetCharacteristicsForUuidAsync(
+      BluetoothUuidHelper::FromShortId(kGattCharacteristicDatabaseHash),
+      BluetoothCacheMode::Cached
+    );
+    if (characteristics.Status() != GattCommunicationStatus::Success || characteristics.Characteristics().Size() == 0) {
+      co_return nullptr;
+    }
+
+    auto value = co_await characteristics.Characteristics().GetAt(0).ReadValueAsync(BluetoothCacheMode::Uncached);
+    if (value.Status() != GattCommunicationStatus::Success) {
+      co_return nullptr;
+    }
+    co_return value.Value();
+  } // readDatabaseHashAsync
+
+  /// @brief Keep the cached GATT layout of the connected device in sync, off the connect path
+  /// @param device
+  /// @param layout the layout served to the connection
+  /// @param refresh kStore saves a layout just discovered, kValidate checks a cached one against the
+  /// Database Hash of the device, kRediscover discovers it again
+  /// @return void
+  /// @note A layout found stale (or rediscovered) replaces the table of the connection on the UI thread,
+  /// where the host methods read it
+  winrt::fire_and_forget LayrzBlePlugin::refreshGattCacheAsync(BluetoothLEDevice device, GattLayout layout, GattRefresh refresh) {
+    uint64_t address = device.BluetoothAddress();
+    try {
+      std::vector<uint8_t> databaseHash;
+      auto hash = co_await readDatabaseHashAsync(device);
+      if (hash != nullptr) {
+        databaseHash = IBufferToVector(hash);
+      }
+
+      if (refresh == GattRefresh::kValidate) {
+        if (databaseHash == layout.databaseHash) {
+          Log(databaseHash.empty() ? "No GATT database hash, the cached layout is kept until a service change"
+                                   : "Cached GATT layout validated by the database hash");
+          co_return;
+        }
+        Log("GATT database hash changed, discovering again");
+        gattCache_.erase(address);
+        if (gattRediscovering_.exchange(true, std::memory_order_acq_rel)) {
+          co_return;
+        }
+        refresh = GattRefresh::kRediscover;
+      }
+
+      if (refresh == GattRefresh::kRediscover) {
+        auto discovery = std::make_shared<GattDiscovery>();
+        co_await discoverGattAsync(device, BluetoothCacheMode::Uncached, discovery);
+        if (!discovery->success) {
+          Log("Failed to discover the GATT services again");
+          gattCache_.erase(address);
+          gattRediscovering_.store(false, std::memory_order_release);
+          co_return;
+        }
+
+        layout = std::move(discovery->layout);
+        uiThreadHandler_.Post([this, address, discovery]() {
+          if (!connectedBtDevice || connectedBtDevice->BluetoothAddress() != address) {
+            return;
+          }
+          servicesAndCharacteristics = std::move(discovery->services);
+          allServicesDiscovered_ = true;
+          reindexServices();
+          Log("GATT services of the connection updated");
+        });
+        gattRediscovering_.store(false, std::memory_order_release);
+      }
+
+      layout.databaseHash = std::move(databaseHash);
+      if (gattCache_.store(layout)) {
+        Log("GATT layout cached: %zu services, %zu characteristics", layout.services.size(), layout.characteristicCount());
+      }
+    } catch (...) {
+      Log("Failed to refresh the GATT cache, general exception");
+      gattCache_.erase(address);
+      gattRediscovering_.store(false, std::memory_order_release);
+    }
+  } // refreshGattCacheAsync
+
+  /// @brief Handle the GattServicesChanged event of the connected device (Service Changed indication)
+  /// @param device
+  /// @param args
+  /// @return void
+  /// @note The cached layout is dropped right away, a burst of changes triggers a single discovery
+  void LayrzBlePlugin::onGattServicesChanged(BluetoothLEDevice device, IInspectable args) {
+    Log("GATT services changed");
+    gattCache_.erase(device.BluetoothAddress());
+    if (gattRediscovering_.exchange(true, std::memory_order_acq_rel)) {
+      return;
+    }
+    refreshGattCacheAsync(device, GattLayout(), GattRefresh::kRediscover);
+  } // onGattServicesChanged
+
   /// @brief Disconnect from a device
   /// @param mac_address the address of the device to disconnect from (Not used, Windows only supports single connection)
   /// @param result the callback to return the result of the disconnection
@@ -305,7 +1116,7 @@ namespace layrz_ble {
       return;
     }
 
-    auto device = connectedDevice.get()->Device();
+    auto device = connectedBtDevice;
     if (!device) {
       Log("Device not found");
       result(false);
@@ -321,8 +1132,12 @@ namespace layrz_ble {
     );
     
     connectedDevice = nullptr;
+    connectedBtDevice = std::nullopt;
     servicesNotifying.clear();
     servicesAndCharacteristics.clear();
+    characteristicIndex_.clear();
+    allServicesDiscovered_ = false;
+    connectionLazy_ = false;
 
     uiThreadHandler_.Post([this, payload]() {
       if (callbackChannel != nullptr) {
@@ -350,7 +1165,7 @@ namespace layrz_ble {
       return;
     }
 
-    auto device = connectedDevice.get()->Device();
+    auto device = connectedBtDevice;
     if (!device) {
       Log("Device not found");
       result(ErrorOr<std::optional<int64_t>>(std::nullopt));
@@ -397,18 +1212,65 @@ namespace layrz_ble {
       return;
     }
 
-    auto device = connectedDevice.get()->Device();
+    auto device = connectedBtDevice;
     if (!device) {
       Log("Device not found");
       result(ErrorOr<flutter::EncodableList>(flutter::EncodableList()));
       return;
     }
 
+    if (connectionLazy_ && !allServicesDiscovered_) {
+      discoverServicesAsync(*device, result);
+      return;
+    }
+
+    result(ErrorOr<flutter::EncodableList>(encodeServices()));
+    return;
+  }
+
+  /// @brief Discover every service of a lazy connection, then return them
+  /// @param device
+  /// @param result the callback to return the services, on the UI thread
+  /// @return void
+  /// @note The services already discovered on demand keep their entry, the notifications run on them
+  winrt::fire_and_forget LayrzBlePlugin::discoverServicesAsync(BluetoothLEDevice device, std::function<void(ErrorOr<flutter::EncodableList> reply)> result) {
+    uint64_t address = device.BluetoothAddress();
+    auto discovery = std::make_shared<GattDiscovery>();
+    try {
+      co_await discoverGattAsync(device, BluetoothCacheMode::Uncached, discovery);
+    } catch (...) {
+      Log("Failed to get GATT services, general exception");
+    }
+
+    uiThreadHandler_.Post([this, address, discovery, result]() {
+      if (!discovery->success || !connectedBtDevice || connectedBtDevice->BluetoothAddress() != address) {
+        Log("Failed to get GATT services");
+        result(ErrorOr<flutter::EncodableList>(flutter::EncodableList()));
+        return;
+      }
+
+      for (auto &[serviceUuid, service] : discovery->services) {
+        servicesAndCharacteristics.emplace(serviceUuid, std::move(service));
+      }
+      allServicesDiscovered_ = true;
+      reindexServices();
+      result(ErrorOr<flutter::EncodableList>(encodeServices()));
+    });
+  } // discoverServicesAsync
+
+  /// @brief Encode the services and characteristics of the connection
+  /// @return flutter::EncodableList list of BtService, each characteristic with its handle in characteristicIndex_
+  flutter::EncodableList LayrzBlePlugin::encodeServices() const {
     flutter::EncodableList output = {};
-    for (auto [serviceUuid, service] : servicesAndCharacteristics) {
+    for (const auto &[serviceUuid, service] : servicesAndCharacteristics) {
+      Uuid128 serviceKey;
+      Uuid128::parse(serviceUuid, serviceKey);
       flutter::EncodableList characteristicsOutput = {};
-      for (auto [characteristicUuid, characteristicItm] : service.Characteristics()) {
+      for (const auto &[characteristicUuid, characteristicItm] : service.Characteristics()) {
         auto characteristic = characteristicItm.Characteristic();
+        Uuid128 characteristicKey;
+        Uuid128::parse(characteristicUuid, characteristicKey);
+        int64_t handle = characteristicIndex_.handleOf(serviceKey, characteristicKey);
         flutter::EncodableList propertiesList = {};
         auto properties = characteristic.CharacteristicProperties();
         if ((properties & GattCharacteristicProperties::Read) == GattCharacteristicProperties::Read) {
@@ -443,15 +1305,139 @@ namespace layrz_ble {
           propertiesList.push_back(flutter::EncodableValue("WRITE_WO_RSP"));
         }
 
-        characteristicsOutput.push_back(flutter::CustomEncodableValue(BtCharacteristic(characteristicUuid, propertiesList)));
+        characteristicsOutput.push_back(flutter::CustomEncodableValue(BtCharacteristic(
+          characteristicUuid,
+          propertiesList,
+          handle == kInvalidCharacteristicHandle ? nullptr : &handle
+        )));
+      }
+
+      output.push_back(flutter::CustomEncodableValue(BtService(serviceUuid, characteristicsOutput)));
+    }
+
+    return output;
+  } // encodeServices
+
+  /// @brief Look up a characteristic of the connection
+  /// @param service_uuid
+  /// @param characteristic_uuid
+  /// @param callback receives the characteristic, nullptr if not found
+  /// @return void
+  /// @note The lookup goes through characteristicIndex_, nothing is copied nor allocated. On a lazy
+  /// connection a service never referenced is discovered first (by UUID, the other services are not
+  /// touched) and memoized, the callback then runs on the UI thread once the discovery is over.
+  void LayrzBlePlugin::withCharacteristic(
+    const std::string& service_uuid,
+    const std::string& characteristic_uuid,
+    std::function<void(GattCharacteristic characteristic)> callback
+  ) {
+    Uuid128 serviceUuid;
+    Uuid128 characteristicUuid;
+    if (!Uuid128::parse(service_uuid, serviceUuid) || !Uuid128::parse(characteristic_uuid, characteristicUuid)) {
+      Log("Invalid UUID %s / %s", service_uuid.c_str(), characteristic_uuid.c_str());
+      callback(nullptr);
+      return;
+    }
+
+    if (auto characteristic = characteristicIndex_.find(serviceUuid, characteristicUuid)) {
+      callback(*characteristic);
+      return;
+    }
+
+    if (characteristicIndex_.hasService(serviceUuid)) {
+      Log("Characteristic %s not found in service %s", characteristic_uuid.c_str(), service_uuid.c_str());
+    } else if (connectionLazy_ && !allServicesDiscovered_ && connectedBtDevice) {
+      discoverServiceAsync(*connectedBtDevice, serviceUuid, characteristicUuid, std::move(callback));
+      return;
+    } else {
+      Log("Service %s not found", service_uuid.c_str());
+    }
+    callback(nullptr);
+  } // withCharacteristic
+
+  /// @brief Add a service of the connection to characteristicIndex_
+  /// @param service
+  /// @return void
+  void LayrzBlePlugin::indexService(const BleService& service) {
+    Uuid128 serviceUuid;
+    Uuid128::parse(GuidToString(service.Service().Uuid()), serviceUuid);
+    characteristicIndex_.addService(serviceUuid);
+    for (const auto &[characteristicUuid, characteristic] : service.Characteristics()) {
+      Uuid128 uuid;
+      Uuid128::parse(characteristicUuid, uuid);
+      characteristicIndex_.insert(serviceUuid, uuid, characteristic.Characteristic());
+    }
+  } // indexService
+
+  /// @brief Rebuild characteristicIndex_ from servicesAndCharacteristics
+  /// @return void
+  void LayrzBlePlugin::reindexServices() {
+    characteristicIndex_.clear();
+    for (const auto &[serviceUuid, service] : servicesAndCharacteristics) {
+      indexService(service);
+    }
+  } // reindexServices
+
+  /// @brief Discover a single service of a lazy connection and memoize it
+  /// @param device
+  /// @param serviceUuid
+  /// @param characteristicUuid the characteristic handed to the callback
+  /// @param callback receives the characteristic on the UI thread, nullptr if not found
+  /// @return void
+  winrt::fire_and_forget LayrzBlePlugin::discoverServiceAsync(
+    BluetoothLEDevice device,
+    Uuid128 serviceUuid,
+    Uuid128 characteristicUuid,
+    std::function<void(GattCharacteristic characteristic)> callback
+  ) {
+    uint64_t address = device.BluetoothAddress();
+    auto serviceKey = serviceUuid.toString();
+    std::optional<BleService> discovered;
+    try {
+      auto startedUs = monotonicNowUs();
+      auto services = co_await device.GetGattServicesForUuidAsync(UuidToGuid(serviceUuid), BluetoothCacheMode::Uncached);
+      if (services.Status() == GattCommunicationStatus::Success && services.Services().Size() > 0) {
+        auto service = services.Services().GetAt(0);
+        auto characteristics = co_await service.GetCharacteristicsAsync(BluetoothCacheMode::Uncached);
+        if (characteristics.Status() == GattCommunicationStatus::Success) {
+          discovered = BleService(service);
+          for (auto characteristic : characteristics.Characteristics()) {
+            discovered->addCharacteristic(BleCharacteristic(characteristic));
+          }
+          Log(
+            "Service %s discovered on demand in %lld us, %d characteristics",
+            serviceKey.c_str(),
+            static_cast<long long>(monotonicNowUs() - startedUs),
+            characteristics.Characteristics().Size()
+          );
+        }
+      }
+    } catch (...) {
+      Log("Failed to discover service %s, general exception", serviceKey.c_str());
+    }
+
+    uiThreadHandler_.Post([this, address, serviceKey, serviceUuid, characteristicUuid, discovered, callback]() {
+      if (!discovered || !connectedBtDevice || connectedBtDevice->BluetoothAddress() != address) {
+        Log("Service %s not found", serviceKey.c_str());
+        callback(nullptr);
+        return;
       }
 
-      output.push_back(flutter::CustomEncodableValue(BtService(serviceUuid, characteristicsOutput)));
-    }
+      // A concurrent reference to the same service may have memoized it first, its entry is kept
+      auto [entry, inserted] = servicesAndCharacteristics.emplace(serviceKey, *discovered);
+      if (inserted) {
+        indexService(entry->second);
+      }
 
-    result(ErrorOr<flutter::EncodableList>(output));
-    return;
-  }
+      auto characteristic = characteristicIndex_.find(serviceUuid, characteristicUuid);
+      if (characteristic == nullptr) {
+        Log("Characteristic %s not found in service %s", characteristicUuid.toString().c_str(), serviceKey.c_str());
+        callback(nullptr);
+        return;
+      }
+      callback(*characteristic);
+    });
+  } // discoverServiceAsync
 
   /// @brief Read a characteristic from the device
   /// @param mac_address the address of the device to read the characteristic from (Not used, Windows only supports single connection)
@@ -472,30 +1458,56 @@ namespace layrz_ble {
       return;
     }
 
-    auto device = connectedDevice.get()->Device();
+    auto device = connectedBtDevice;
     if (!device) {
       Log("Device not found");
       result(ErrorOr<std::vector<uint8_t>>(std::vector<uint8_t>()));
       return;
     }
 
-    auto serviceSearch = servicesAndCharacteristics.find(toUppercase(service_uuid));
-    if (serviceSearch == servicesAndCharacteristics.end()) {
-      Log("Service %s not found", service_uuid.c_str());
+    withCharacteristic(service_uuid, characteristic_uuid, [this, result](GattCharacteristic characteristic) {
+      readResolvedCharacteristic(characteristic, result);
+    });
+    return;
+  }
+
+  /// @brief Read a characteristic from the device by its handle
+  /// @param handle the handle returned by DiscoverServices
+  /// @param result the callback to return the result of the read
+  /// @return void
+  /// @note The result is returned as a vector of bytes
+  void LayrzBlePlugin::ReadCharacteristicByHandle(
+    int64_t handle,
+    std::function<void(ErrorOr<std::vector<uint8_t>> reply)> result
+  ) {
+    if (connectedDevice == nullptr || !connectedBtDevice) {
+      Log("Not connected to a device");
       result(ErrorOr<std::vector<uint8_t>>(std::vector<uint8_t>()));
       return;
     }
-    auto service = serviceSearch->second;
 
-    auto characteristics = service.Characteristics();
-    auto characteristicsSearch = characteristics.find(toUppercase(characteristic_uuid));
-    if (characteristicsSearch == characteristics.end()) {
-      Log("Characteristic %s not found in service %s", characteristic_uuid.c_str(), service_uuid.c_str());
+    auto characteristic = characteristicIndex_.at(handle);
+    if (characteristic == nullptr) {
+      Log("Unknown characteristic handle %lld", static_cast<long long>(handle));
+      result(ErrorOr<std::vector<uint8_t>>(std::vector<uint8_t>()));
+      return;
+    }
+    readResolvedCharacteristic(*characteristic, result);
+  }
+
+  /// @brief Read a characteristic once resolved, by UUID or by handle
+  /// @param characteristic nullptr if not found
+  /// @param result the callback to return the result of the read
+  /// @return void
+  void LayrzBlePlugin::readResolvedCharacteristic(
+    GattCharacteristic characteristic,
+    std::function<void(ErrorOr<std::vector<uint8_t>> reply)> result
+  ) {
+    if (characteristic == nullptr) {
       result(ErrorOr<std::vector<uint8_t>>(std::vector<uint8_t>()));
       return;
     }
 
-    auto characteristic = characteristicsSearch->second.Characteristic();
     auto properties = characteristic.CharacteristicProperties();
     if ((properties & GattCharacteristicProperties::Read) != GattCharacteristicProperties::Read) {
       Log("Characteristic does not support reading");
@@ -504,8 +1516,7 @@ namespace layrz_ble {
     }
 
     readCharacteristicAsync(characteristic, result);
-    return;
-  }
+  } // readResolvedCharacteristic
 
   /// @brief Read a characteristic from the device asynchronously
   /// @param characteristic the characteristic to read
@@ -557,30 +1568,64 @@ namespace layrz_ble {
       return;
     }
 
-    auto device = connectedDevice.get()->Device();
+    auto device = connectedBtDevice;
     if (!device) {
       Log("Device not found");
       result(false);
       return;
     }
 
-    auto serviceSearch = servicesAndCharacteristics.find(toUppercase(service_uuid));
-    if (serviceSearch == servicesAndCharacteristics.end()) {
-      Log("Service %s not found", service_uuid.c_str());
+    withCharacteristic(service_uuid, characteristic_uuid, [this, payload, with_response, result](GattCharacteristic characteristic) {
+      writeResolvedCharacteristic(characteristic, payload, with_response, result);
+    });
+    return;
+  }
+
+  /// @brief Write a characteristic to the device by its handle
+  /// @param handle the handle returned by DiscoverServices
+  /// @param payload the payload to write to the characteristic
+  /// @param with_response whether to wait for a response from the device
+  /// @param result the callback to return the result of the write
+  /// @return void
+  /// @note No string is built nor hashed, for the write loops
+  void LayrzBlePlugin::WriteCharacteristicByHandle(
+    int64_t handle,
+    const std::vector<uint8_t>& payload,
+    bool with_response,
+    std::function<void(ErrorOr<bool> reply)> result
+  ) {
+    if (connectedDevice == nullptr || !connectedBtDevice) {
+      Log("Not connected to a device");
       result(false);
       return;
     }
-    auto service = serviceSearch->second;
 
-    auto characteristics = service.Characteristics();
-    auto characteristicsSearch = characteristics.find(toUppercase(characteristic_uuid));
-    if (characteristicsSearch == characteristics.end()) {
-      Log("Characteristic %s not found in service %s", characteristic_uuid.c_str(), service_uuid.c_str());
+    auto characteristic = characteristicIndex_.at(handle);
+    if (characteristic == nullptr) {
+      Log("Unknown characteristic handle %lld", static_cast<long long>(handle));
+      result(false);
+      return;
+    }
+    writeResolvedCharacteristic(*characteristic, payload, with_response, result);
+  }
+
+  /// @brief Write a characteristic once resolved, by UUID or by handle
+  /// @param characteristic nullptr if not found
+  /// @param payload the payload to write to the characteristic
+  /// @param with_response whether to wait for a response from the device
+  /// @param result the callback to return the result of the write
+  /// @return void
+  void LayrzBlePlugin::writeResolvedCharacteristic(
+    GattCharacteristic characteristic,
+    const std::vector<uint8_t>& payload,
+    bool with_response,
+    std::function<void(ErrorOr<bool> reply)> result
+  ) {
+    if (characteristic == nullptr) {
       result(false);
       return;
     }
 
-    auto characteristic = characteristicsSearch->second.Characteristic();
     auto properties = characteristic.CharacteristicProperties();
     if ((properties & GattCharacteristicProperties::Write) != GattCharacteristicProperties::Write &&
         (properties & GattCharacteristicProperties::WriteWithoutResponse) != GattCharacteristicProperties::WriteWithoutResponse) {
@@ -594,9 +1639,7 @@ namespace layrz_ble {
     } else {
       writeCharacteristicWithoutResponseAsync(characteristic, payload, result);
     }
-
-    return;
-  }
+  } // writeResolvedCharacteristic
 
   /// @brief Write a characteristic to the device with response asynchronously
   /// @param characteristic the characteristic to write
@@ -666,29 +1709,56 @@ namespace layrz_ble {
       return;
     }
 
-    auto device = connectedDevice.get()->Device();
+    auto device = connectedBtDevice;
     if (!device) {
       Log("Device not found");
       result(false);
       return;
     }
 
-    auto serviceSearch = servicesAndCharacteristics.find(toUppercase(service_uuid));
-    if (serviceSearch == servicesAndCharacteristics.end()) {
-      Log("Service %s not found", service_uuid.c_str());
+    withCharacteristic(service_uuid, characteristic_uuid, [this, result](GattCharacteristic characteristic) {
+      startNotifyResolved(characteristic, result);
+    });
+    return;
+  }
+
+  /// @brief Start notifications for a characteristic by its handle
+  /// @param handle the handle returned by DiscoverServices
+  /// @param result the callback to return the result of the start
+  /// @return void
+  /// @note The result is returned as a boolean
+  void LayrzBlePlugin::StartNotifyByHandle(
+    int64_t handle,
+    std::function<void(ErrorOr<bool> reply)> result
+  ) {
+    if (connectedDevice == nullptr || !connectedBtDevice) {
+      Log("Not connected to a device");
       result(false);
       return;
     }
-    auto service = serviceSearch->second;
 
-    auto characteristics = service.Characteristics();
-    auto characteristicsSearch = characteristics.find(toUppercase(characteristic_uuid));
-    if (characteristicsSearch == characteristics.end()) {
-      Log("Characteristic %s not found in service %s", characteristic_uuid.c_str(), service_uuid.c_str());
+    auto characteristic = characteristicIndex_.at(handle);
+    if (characteristic == nullptr) {
+      Log("Unknown characteristic handle %lld", static_cast<long long>(handle));
+      result(false);
+      return;
+    }
+    startNotifyResolved(*characteristic, result);
+  }
+
+  /// @brief Start notifications for a characteristic once resolved, by UUID or by handle
+  /// @param characteristic nullptr if not found
+  /// @param result the callback to return the result of the start
+  /// @return void
+  void LayrzBlePlugin::startNotifyResolved(
+    GattCharacteristic characteristic,
+    std::function<void(ErrorOr<bool> reply)> result
+  ) {
+    if (characteristic == nullptr) {
       result(false);
       return;
     }
-    auto characteristic = characteristicsSearch->second.Characteristic();
+
     auto properties = characteristic.CharacteristicProperties();
     if ((properties & GattCharacteristicProperties::Notify) != GattCharacteristicProperties::Notify &&
         (properties & GattCharacteristicProperties::Indicate) != GattCharacteristicProperties::Indicate) {
@@ -697,15 +1767,16 @@ namespace layrz_ble {
       return;
     }
 
-    if (servicesNotifying.find(characteristic_uuid) != servicesNotifying.end()) {
+    // Same key as startNotifyAsync
+    auto uuid = toUppercase(GuidToString(characteristic.Uuid()));
+    if (servicesNotifying.find(uuid) != servicesNotifying.end()) {
       Log("Already subscribed to characteristic notifications");
       result(true);
       return;
     }
 
     startNotifyAsync(characteristic, result);
-    return;
-  }
+  } // startNotifyResolved
 
   /// @brief Start notifications for a characteristic asynchronously
   /// @param characteristic the characteristic to start notifications for
@@ -758,29 +1829,54 @@ namespace layrz_ble {
       return;
     }
 
-    auto device = connectedDevice.get()->Device();
+    auto device = connectedBtDevice;
     if (!device) {
       Log("Device not found");
       result(false);
       return;
     }
 
-    auto serviceSearch = servicesAndCharacteristics.find(toUppercase(service_uuid));
-    if (serviceSearch == servicesAndCharacteristics.end()) {
-      Log("Service %s not found", service_uuid.c_str());
+    auto characteristic = characteristicIndex_.find(service_uuid, characteristic_uuid);
+    if (characteristic == nullptr) {
+      Log("Characteristic %s not found in service %s", characteristic_uuid.c_str(), service_uuid.c_str());
       result(false);
       return;
     }
-    auto service = serviceSearch->second;
+    stopNotifyResolved(*characteristic, result);
+  }
 
-    auto characteristics = service.Characteristics();
-    auto characteristicsSearch = characteristics.find(toUppercase(characteristic_uuid));
-    if (characteristicsSearch == characteristics.end()) {
-      Log("Characteristic %s not found in service %s", characteristic_uuid.c_str(), service_uuid.c_str());
+  /// @brief Stop notifications for a characteristic by its handle
+  /// @param handle the handle returned by DiscoverServices
+  /// @param result the callback to return the result of the stop
+  /// @return void
+  /// @note The result is returned as a boolean
+  void LayrzBlePlugin::StopNotifyByHandle(
+    int64_t handle,
+    std::function<void(ErrorOr<bool> reply)> result
+  ) {
+    if (connectedDevice == nullptr || !connectedBtDevice) {
+      Log("Not connected to a device");
+      result(false);
+      return;
+    }
+
+    auto characteristic = characteristicIndex_.at(handle);
+    if (characteristic == nullptr) {
+      Log("Unknown characteristic handle %lld", static_cast<long long>(handle));
       result(false);
       return;
     }
-    auto characteristic = characteristicsSearch->second.Characteristic();
+    stopNotifyResolved(*characteristic, result);
+  }
+
+  /// @brief Stop notifications for a characteristic once resolved, by UUID or by handle
+  /// @param characteristic
+  /// @param result the callback to return the result of the stop
+  /// @return void
+  void LayrzBlePlugin::stopNotifyResolved(
+    GattCharacteristic characteristic,
+    std::function<void(ErrorOr<bool> reply)> result
+  ) {
     auto properties = characteristic.CharacteristicProperties();
     if ((properties & GattCharacteristicProperties::Notify) != GattCharacteristicProperties::Notify &&
         (properties & GattCharacteristicProperties::Indicate) != GattCharacteristicProperties::Indicate) {
@@ -797,8 +1893,7 @@ namespace layrz_ble {
     }
 
     stopNotifyAsync(characteristic, result);
-    return;
-  }
+  } // stopNotifyResolved
 
   /// @brief Stop notifications for a characteristic asynchronously
   /// @param characteristic the characteristic to stop notifications for
@@ -875,6 +1970,7 @@ namespace layrz_ble {
 
     if (status == BluetoothConnectionStatus::Disconnected) {
       connectedDevice = nullptr;
+      connectedBtDevice = std::nullopt;
       servicesNotifying.clear();
 
       if (callbackChannel != nullptr) {
@@ -898,150 +1994,193 @@ namespace layrz_ble {
   /// @brief Setup the watcher
   /// @return void
   void LayrzBlePlugin::setupWatcher() {
-    deviceWatcherDevices.clear();
+    {
+      std::lock_guard<std::mutex> lock(scanMutex_);
+      deviceIdentities_.clear();
+    }
 
     if (btScanner == nullptr) {
       btScanner = DeviceInformation::CreateWatcher(Windows::Devices::Bluetooth::BluetoothDevice::GetDeviceSelector());
       // Subscribe to the Added event
       btScanner.Added([this](DeviceWatcher const&, DeviceInformation const& device) {
-        std::string deviceId = toUppercase(HStringToString(device.Id()));
-        deviceWatcherDevices.insert_or_assign(deviceId, device);
-        handleScanResult(device);
+        // The properties are read once here, the identity index keeps them
+        std::string classicId = HStringToString(device.Id());
+        auto properties = device.Properties();
+
+        uint64_t address = 0;
+        if (properties.HasKey(kClassicAddressProperty)) {
+          auto addressValue = properties.Lookup(kClassicAddressProperty).as<IPropertyValue>();
+          parseBluetoothAddress(HStringToString(addressValue.GetString()), address);
+        }
+        if (address == 0 && !DeviceIdentityIndex::addressFromClassicId(classicId, address)) {
+          Log("No address for the classic device %s", classicId.c_str());
+          return;
+        }
+
+        std::string name = HStringToString(device.Name());
+        std::string_view nameView(name);
+        std::optional<int64_t> rssi;
+        if (properties.HasKey(kClassicSignalStrengthProperty)) {
+          rssi = properties.Lookup(kClassicSignalStrengthProperty).as<IPropertyValue>().GetInt64();
+        }
+
+        DeviceIdentity identity;
+        {
+          // Shared with the LE path (name fallback)
+          std::lock_guard<std::mutex> lock(scanMutex_);
+          identity = deviceIdentities_.addClassic(classicId, address, &nameView, rssi ? &(*rssi) : nullptr);
+        }
+        handleScanResult(identity);
       });
       // Subscribe to the Updated event
       btScanner.Updated([this](DeviceWatcher const&, DeviceInformationUpdate const& args) {
-        auto deviceId = toUppercase(HStringToString(args.Id()));
-        auto it = deviceWatcherDevices.find(deviceId);
-        if (it != deviceWatcherDevices.end())  {
-          it->second.Update(args);
-          handleScanResult(it->second);
+        // Only the changed properties are in the update
+        std::string classicId = HStringToString(args.Id());
+        auto properties = args.Properties();
+
+        std::optional<std::string> name;
+        if (properties.HasKey(kClassicNameProperty)) {
+          name = HStringToString(properties.Lookup(kClassicNameProperty).as<IPropertyValue>().GetString());
+        }
+        std::optional<int64_t> rssi;
+        if (properties.HasKey(kClassicSignalStrengthProperty)) {
+          rssi = properties.Lookup(kClassicSignalStrengthProperty).as<IPropertyValue>().GetInt64();
+        }
+
+        std::optional<DeviceIdentity> identity;
+        {
+          std::lock_guard<std::mutex> lock(scanMutex_);
+          std::string_view nameView = name ? std::string_view(*name) : std::string_view();
+          auto updated = deviceIdentities_.updateClassic(classicId, name ? &nameView : nullptr, rssi ? &(*rssi) : nullptr);
+          if (updated != nullptr)
+            identity = *updated;
         }
+        if (identity)
+          handleScanResult(*identity);
       });
       // Subscribe to the Removed event
       btScanner.Removed([this](DeviceWatcher const&, DeviceInformationUpdate const& args) {
-        auto deviceId = toUppercase(HStringToString(args.Id()));
-        deviceWatcherDevices.erase(deviceId);
+        std::string classicId = HStringToString(args.Id());
+        std::lock_guard<std::mutex> lock(scanMutex_);
+        deviceIdentities_.removeClassic(classicId);
       });
     } // if (btScanner == nullptr)
 
     if (leScanner == nullptr) {
       leScanner = BluetoothLEAdvertisementWatcher();
       leScanner.ScanningMode(BluetoothLEScanningMode::Active);
-      // Subscribe to the Received event
-      leScanner.Received([this](BluetoothLEAdvertisementWatcher const&, BluetoothLEAdvertisementReceivedEventArgs const& args) {
-        auto macAddress = toUppercase(formatBluetoothAddress(args.BluetoothAddress()));
 
-        BleScanResult deviceInfo(macAddress);
-        deviceInfo.setAddress(args.BluetoothAddress());
+      // Bluetooth 5 extended (and chained) advertisements are only raised when asked for, up to 1650 bytes
+      if (ApiInformation::IsPropertyPresent(
+        L"Windows.Devices.Bluetooth.Advertisement.BluetoothLEAdvertisementWatcher",
+        L"AllowExtendedAdvertisements"
+      )) {
+        leScanner.AllowExtendedAdvertisements(true);
+        Log("Extended advertisements allowed on the LE watcher");
+      }
 
-        if (args.Advertisement() != nullptr)
-        {
-          auto manufacturerItems = args.Advertisement().ManufacturerData();
-          for (const auto &item : manufacturerItems) 
-          {
-            // Append the Company ID to manufacturerData
-            // Extract additional data from the IBuffer
-            auto dataBuffer = item.Data();
-            if (dataBuffer && dataBuffer.Length() > 0) 
-            {
-              std::vector<uint8_t> manufacturerData;
-              auto reader = winrt::Windows::Storage::Streams::DataReader::FromBuffer(dataBuffer);
-              std::vector<uint8_t> additionalData(dataBuffer.Length());
-              reader.ReadBytes(winrt::array_view<uint8_t>(additionalData));
-              // Append the additional data to manufacturerData
-              manufacturerData.insert(manufacturerData.end(), additionalData.begin(), additionalData.end());
-
-              deviceInfo.appendManufacturerData(
-                item.CompanyId(),
-                manufacturerData
-              );
-            } // if (dataBuffer && dataBuffer.Length() > 0)
-          } // for (const auto &item : manufacturerItems)
-
-          flutter::EncodableList serviceData = flutter::EncodableList();
-          auto serviceItems = args.Advertisement().DataSections();
-          for (const auto& section : serviceItems) 
-          {
-            auto dataType = section.DataType();
-            if (
-                dataType == BluetoothLEAdvertisementDataTypes::ServiceData16BitUuids() ||
-                dataType == BluetoothLEAdvertisementDataTypes::ServiceData32BitUuids() ||
-                dataType == BluetoothLEAdvertisementDataTypes::ServiceData128BitUuids() ) 
-            {
-              auto dataBuffer = section.Data();
-              if (dataBuffer && dataBuffer.Length() > 0) 
-              {
-                auto reader = winrt::Windows::Storage::Streams::DataReader::FromBuffer(dataBuffer);
-                std::vector<uint8_t> additionalData(dataBuffer.Length());
-                reader.ReadBytes(winrt::array_view<uint8_t>(additionalData));
-
-                // Separate UUID from additional data
-                size_t uuidLength = 0;
-
-                if (dataType == BluetoothLEAdvertisementDataTypes::ServiceData16BitUuids())  { // 16-bit UUID
-                  uuidLength = 2;
-                } else if (dataType == BluetoothLEAdvertisementDataTypes::ServiceData32BitUuids())  { // 32-bit UUID
-                  uuidLength = 4;
-                } else if (dataType == BluetoothLEAdvertisementDataTypes::ServiceData128BitUuids())  { // 128-bit UUID
-                  uuidLength = 16;
-                }
-
-                std::vector<uint8_t> uuidBytes(additionalData.begin(), additionalData.begin() + uuidLength);
-                uint16_t uuid = (uuidBytes[1] << 8) | uuidBytes[0];
-                std::vector<uint8_t> valueBytes(additionalData.begin() + uuidLength, additionalData.end());
-
-
-                deviceInfo.appendServiceData(uuid, valueBytes);
-              } // if (dataBuffer && dataBuffer.Length() > 0)
-            } // if (dataType == BluetoothLEAdvertisementDataTypes::ServiceData16BitUuids() || ...)
-          } // for (const auto& section : serviceItems)
-
-          auto name = HStringToString(args.Advertisement().LocalName());
-          if (!name.empty()) 
-            deviceInfo.setName(name);
-          else
-          {
-            auto it = deviceWatcherDevices.find(macAddress);
-            if (it != deviceWatcherDevices.end()) 
-              deviceInfo.setName(HStringToString(it->second.Name()));
-          } // if (!name.empty())
-        } // if (args.Advertisement() != nullptr)
+#ifdef NTDDI_WIN11_GE
+      scanPhyReported_ = ApiInformation::IsPropertyPresent(
+        L"Windows.Devices.Bluetooth.Advertisement.BluetoothLEAdvertisementReceivedEventArgs",
+        L"PrimaryPhy"
+      );
+#endif
+    } // if (leScanner == nullptr)
+
+    // Subscribe to the Received event, again on every scan as stopLeWatcher revokes it
+    if (!leReceivedToken_) {
+      leReceivedToken_ = leScanner.Received([this](BluetoothLEAdvertisementWatcher const&, BluetoothLEAdvertisementReceivedEventArgs const& args) {
+        // Only copy the advertisement into the ingest ring, the worker merges it. The watcher raises its
+        // events one at a time and the producer mutex keeps a handler of a stopped scan from overlapping the
+        // next one, so this handler is the single producer of the ring.
+        std::lock_guard<std::mutex> producer(leProducerMutex_);
+        if (!leProducing_) {
+          return;
+        }
+
+        scanMetrics_.add(ScanStage::kReceived);
+        if (scanEvents_.skipWhilePaused()) {
+          // The UI thread is behind under kPauseWatcher, counted by the scan event queue
+          return;
+        }
+
+        RawAdvertisement *record = scanIngest_.beginPush();
+        if (record == nullptr) {
+          // Ring full, the overrun is counted
+          scanMetrics_.add(ScanStage::kDropped);
+          return;
+        }
 
-        auto rssi = args.RawSignalStrengthInDBm();
-        if (rssi)
-          deviceInfo.setRssi(rssi);
+        record->address = args.BluetoothAddress();
+        record->addressType = static_cast<uint8_t>(args.BluetoothAddressType());
+        record->rssi = args.RawSignalStrengthInDBm();
+        record->timestampUs = monotonicNowUs();
 
         // Get the txPower
         if (args.TransmitPowerLevelInDBm()) {
-          auto txPower = args.TransmitPowerLevelInDBm().Value();
-          deviceInfo.setTxPower(static_cast<int16_t>(txPower));
+          record->hasTxPower = true;
+          record->txPower = static_cast<uint16_t>(args.TransmitPowerLevelInDBm().Value());
         }
 
-        handleBleScanResult(deviceInfo);
+#ifdef NTDDI_WIN11_GE
+        // WinRT does not report the advertising SID, it stays unknown
+        if (scanPhyReported_) {
+          record->primaryPhy = toAdvertisingPhy(args.PrimaryPhy());
+          record->secondaryPhy = toAdvertisingPhy(args.SecondaryPhy());
+        }
+#endif
+
+        // Flatten the data sections back into one contiguous raw advertisement, the scan engine parses
+        // it in place and only copies the sections that changed since the last advertisement
+        if (args.Advertisement() != nullptr)
+        {
+          for (const auto& section : args.Advertisement().DataSections())
+          {
+            auto dataBuffer = section.Data();
+            if (!dataBuffer || dataBuffer.Length() == 0)
+              continue;
+
+            record->appendSection(section.DataType(), dataBuffer.data(), dataBuffer.Length());
+          } // for (const auto& section : DataSections())
+        } // if (args.Advertisement() != nullptr)
+
+        scanIngest_.commitPush();
       });
-    } // if (leScanner == nullptr)
+    } // if (!leReceivedToken_)
   } // setupWatcher
 
-  /// @brief Handle the scan result
-  /// @param device 
+  /// @brief Stop the LE watcher, kept for the next scan
   /// @return void
-  void LayrzBlePlugin::handleScanResult(DeviceInformation device) {
-    auto properties = device.Properties();
-    
+  /// @note Revoking the `Received` handler does not wait for a handler already running, so the producer
+  /// mutex is taken once: past it no handler is between beginPush and commitPush, and the ones still to
+  /// come return right away. The ingest worker can then be stopped and restarted safely.
+  void LayrzBlePlugin::stopLeWatcher() {
+    if (leScanner == nullptr) {
+      return;
+    }
 
-    auto bluetoothAddressPropertyValue = properties.Lookup(L"System.Devices.Aep.DeviceAddress").as<IPropertyValue>();
-    std::string macAddress = toUppercase(HStringToString(bluetoothAddressPropertyValue.GetString()));
+    if (leReceivedToken_) {
+      leScanner.Received(leReceivedToken_);
+      leReceivedToken_ = {};
+    }
+    leScanner.Stop();
 
-    auto result = BleScanResult(macAddress);
-    if(!device.Name().empty())
-      result.setName(HStringToString(device.Name()));
+    std::lock_guard<std::mutex> producer(leProducerMutex_);
+    leProducing_ = false;
+  } // stopLeWatcher
 
-    if(properties.HasKey(L"System.Devices.Aep.SignalStrength"))
-    {
-      auto signalStrength = properties.Lookup(L"System.Devices.Aep.SignalStrength").as<IPropertyValue>();
-      result.setRssi(signalStrength.GetInt64());
-    }
+  /// @brief Handle a device reported by the classic watcher
+  /// @param identity the cached properties of the device
+  /// @return void
+  void LayrzBlePlugin::handleScanResult(const DeviceIdentity &identity) {
+    auto result = BleScanResult(identity.address, kAddressTypePublic);
+    if (identity.name)
+      result.setName(*identity.name);
 
+    if (identity.rssi)
+      result.setRssi(*identity.rssi);
+
+    result.setLastSeenUs(monotonicNowUs());
     handleBleScanResult(result);
   } // handleScanResult
 
@@ -1054,43 +2193,293 @@ namespace layrz_ble {
       return;
     }
 
-    if(filteredDeviceId.length() > 0 && toUppercase(result.DeviceId()) != toUppercase(filteredDeviceId)) {
+    // Merge the result into the visible devices, filtered out results are discarded here
+    std::lock_guard<std::mutex> lock(scanMutex_);
+    const auto merged = scanEngine_.merge(result);
+    if (merged == nullptr) {
       return;
     }
 
-    // Check if the result.deviceId is inside of visibleDevices
-    auto it = visibleDevices.find(result.DeviceId());
+    queueScanResult(*merged);
+  } // handleBleScanResult
 
-    if(it != visibleDevices.end()) {
-      // Update the existing device
-      // Check if the name is not empty to update it
-      auto &device = it->second;
-      if(result.Name()) {
-        device.setName(*result.Name());
+  /// @brief Merge a batch of raw BLE advertisements
+  /// @param batch the advertisements drained from the ingest ring, valid only during this call
+  /// @return void
+  /// @note Runs on the ingest worker, the scan mutex is taken once per batch.
+  /// The device is keyed by its address, the MAC string is only formatted when the device is sent
+  void LayrzBlePlugin::handleBleAdvertisements(const std::vector<AdvertisementView> &batch) {
+    std::lock_guard<std::mutex> lock(scanMutex_);
+    if (scanCapture_ != nullptr) {
+      for (const auto &advertisement : batch) {
+        scanCapture_->append(advertisement);
       }
+    }
 
-      if(result.Rssi()) {
-        device.setRssi(result.Rssi());
+    // The stage counters are summed over the batch, one atomic increment per stage
+    uint64_t filtered = 0;
+    uint64_t fingerprintHits = scanEngine_.FingerprintHits();
+    uint64_t absorbedUpdates = scanCoalescer_.AbsorbedUpdates();
+    auto &ingestLatency = scanMetrics_.IngestLatency();
+    auto nowUs = monotonicNowUs();
+
+    for (const auto &advertisement : batch) {
+      ingestLatency.record(nowUs - advertisement.timestampUs);
+      scanEngine_.evictStale(advertisement.timestampUs);
+      auto merged = scanEngine_.mergeAdvertisement(advertisement);
+      if (merged == nullptr) {
+        filtered++;
+        continue;
       }
 
-      if (!result.ServiceData()->empty()) {
-        for (const auto &serviceData : *result.ServiceData()) {
-          device.appendServiceData(serviceData.first, serviceData.second);
-        }
+      // Fallback to the name reported by the classic watcher for the same address
+      if (merged->Name() == nullptr) {
+        auto name = deviceIdentities_.resolveName(merged->Address());
+        if (name != nullptr)
+          merged = scanEngine_.updateName(merged->Key(), *name);
       }
 
-      if (!result.ManufacturerData()->empty()) {
-        for (const auto &mfd : *result.ManufacturerData()) {
-          device.appendManufacturerData(mfd.first, mfd.second);
-        }
+      queueScanResult(*merged);
+    }
+
+    scanMetrics_.add(ScanStage::kFiltered, filtered);
+    scanMetrics_.add(ScanStage::kMerged, batch.size() - filtered);
+    scanMetrics_.add(ScanStage::kDuplicate, scanEngine_.FingerprintHits() - fingerprintHits);
+    scanMetrics_.add(ScanStage::kCoalesced, scanCoalescer_.AbsorbedUpdates() - absorbedUpdates);
+  } // handleBleAdvertisements
+
+  /// @brief Queue a merged device to be sent to the Flutter side
+  /// @param device
+  /// @return void
+  /// @note With the coalescing enabled, only the device ID is recorded and the latest state of the
+  /// device is sent by the next flush, so a device advertising at 20 Hz costs one message per window.
+  /// Must be called with the scanMutex_ held.
+  void LayrzBlePlugin::queueScanResult(const BleScanResult &device) {
+    if (!scanCoalescer_.isEnabled()) {
+      emitScanResult(device);
+      return;
+    }
+
+    auto nowUs = monotonicNowUs();
+    scanCoalescer_.add(device.Key(), nowUs);
+  } // queueScanResult
+
+  /// @brief Send a visible device to the Flutter side right away
+  /// @param device
+  /// @return void
+  /// @note Must be called with the scanMutex_ held. Without a coalescer there is nothing to hold the
+  /// device back in, so with the UI thread behind the oldest queued messages are dropped (and the scan
+  /// paused under kPauseWatcher).
+  void LayrzBlePlugin::emitScanResult(const BleScanResult &device) {
+    if (callbackChannel == nullptr) {
+      return;
+    }
+
+    if (!scanEvents_.hasRoom(1) && scanEvents_.Policy() == BackpressurePolicy::kPauseWatcher) {
+      scanEvents_.pause();
+    }
+
+    BtDevice response = toBtDevice(device);
+    scanMetrics_.add(ScanStage::kEncoded);
+    scanMetrics_.PostLatency().record(monotonicNowUs() - device.LastSeenUs());
+
+    ScanEvent event;
+    event.deliver = [this, response = std::move(response)]() {
+      callbackChannel->OnScanResult(response, SuccessCallback, ErrorCallback);
+    };
+    postScanEvent(std::move(event));
+  } // emitScanResult
+
+  /// @brief Send the devices updated during the last coalescing window as one batch
+  /// @return void
+  /// @note With the deltas enabled, only the fields that changed since the last emission of each device
+  /// are sent, mostly the RSSI, and the devices that did not change at all are skipped.
+  /// When the UI thread is behind (the scan event queue has no room for the batch), kLatestPerDevice and
+  /// kPauseWatcher leave the devices in the coalescer: later updates of a device are absorbed there and
+  /// its latest state goes out with the first flush that fits.
+  /// @param force send the batch whatever the policy, for the last flush of a scan
+  void LayrzBlePlugin::flushScanResults(bool force) {
+    std::lock_guard<std::mutex> lock(scanMutex_);
+    // Also ages the table when no advertisement comes in
+    scanEngine_.evictStale(monotonicNowUs());
+    if (callbackChannel == nullptr || scanCoalescer_.pending() == 0) {
+      scanCoalescer_.take(scanFlushBatch_);
+      return;
+    }
+
+    if (!force && !scanEvents_.hasRoom(scanCoalescer_.pending())) {
+      switch (scanEvents_.Policy()) {
+        case BackpressurePolicy::kLatestPerDevice:
+          scanEvents_.defer();
+          return;
+        case BackpressurePolicy::kPauseWatcher:
+          scanEvents_.pause();
+          return;
+        case BackpressurePolicy::kDropOldest:
+          break;
       }
+    }
 
-      visibleDevices.insert_or_assign(result.DeviceId(), device);
-    } else {
-      visibleDevices.insert_or_assign(result.DeviceId(), result);
+    scanCoalescer_.take(scanFlushBatch_);
+    bool asDeltas = scanDeltas_.isEnabled();
+    flutter::EncodableList devices;
+    devices.reserve(scanFlushBatch_.size());
+
+    ScanEvent event;
+    if (asDeltas) {
+      // The devices of a dropped batch must be sent in full next time, see postScanEvent
+      event.devices.reserve(scanFlushBatch_.size());
+    }
+
+    auto nowUs = monotonicNowUs();
+    auto &postLatency = scanMetrics_.PostLatency();
+    for (const auto &key : scanFlushBatch_) {
+      auto device = scanEngine_.find(key);
+      if (device == nullptr)
+        continue;
+
+      if (!asDeltas) {
+        devices.push_back(flutter::CustomEncodableValue(toBtDevice(*device)));
+        postLatency.record(nowUs - device->LastSeenUs());
+        continue;
+      }
+
+      uint32_t fields = scanDeltas_.diff(*device);
+      if (fields != kDeltaNone) {
+        devices.push_back(flutter::CustomEncodableValue(toBtDeviceDelta(*device, fields)));
+        event.devices.push_back(key);
+        postLatency.record(nowUs - device->LastSeenUs());
+      }
+    }
+    scanMetrics_.add(ScanStage::kEncoded, devices.size());
+
+    if (devices.empty()) {
+      return;
+    }
+
+    event.weight = devices.size();
+    event.deliver = [this, asDeltas, devices = std::move(devices)]() {
+      if (asDeltas) {
+        callbackChannel->OnScanDeltas(devices, SuccessCallback, ErrorCallback);
+      } else {
+        callbackChannel->OnScanResults(devices, SuccessCallback, ErrorCallback);
+      }
+    };
+    postScanEvent(std::move(event));
+  } // flushScanResults
+
+  /// @brief Queue a scan message for the UI thread, bounded by the backpressure policy
+  /// @param event
+  /// @return void
+  /// @note The UI thread is only woken up when no drain is pending, so a busy UI thread never accumulates
+  /// more than one closure for the scan. The devices of a dropped delta batch are forgotten by the delta
+  /// tracker, their next emission is a full snapshot and the Flutter side does not keep a stale field.
+  /// Must be called with the scanMutex_ held.
+  void LayrzBlePlugin::postScanEvent(ScanEvent &&event) {
+    std::vector<ScanEvent> dropped;
+    bool wake = scanEvents_.push(std::move(event), &dropped);
+    scanMetrics_.add(ScanStage::kPosted);
+
+    for (const auto &droppedEvent : dropped) {
+      for (const auto &key : droppedEvent.devices) {
+        scanDeltas_.forget(key);
+      }
+    }
+
+    if (wake) {
+      uiThreadHandler_.Post([this]() {
+        scanEvents_.drain();
+      });
+    }
+  } // postScanEvent
+
+  /// @brief Forget a device evicted from the table of visible devices and report it as lost
+  /// @param device
+  /// @return void
+  /// @note Called by the scan engine with the scanMutex_ held, a pending update of the device in the
+  /// coalescer is dropped by the next flush as the device is not found anymore.
+  void LayrzBlePlugin::onDeviceEvicted(const BleScanResult &device) {
+    scanDeltas_.forget(device.Key());
+
+    if (callbackChannel != nullptr) {
+      ScanEvent event;
+      event.deliver = [this, macAddress = device.DeviceId(), addressType = static_cast<int64_t>(device.AddressType())]() {
+        callbackChannel->OnDeviceLost(macAddress, &addressType, SuccessCallback, ErrorCallback);
+      };
+      postScanEvent(std::move(event));
+    }
+  } // onDeviceEvicted
+
+  /// @brief Parse a list of MAC addresses from the Flutter side
+  /// @param list the addresses, as strings
+  /// @param addresses the parsed 48 bits addresses
+  /// @return bool false if an entry is not an address
+  bool LayrzBlePlugin::parseAddressList(const flutter::EncodableList& list, std::vector<uint64_t>& addresses) {
+    addresses.reserve(list.size());
+    for (const auto &value : list) {
+      const auto *text = std::get_if<std::string>(&value);
+      uint64_t address = 0;
+      if (text == nullptr || !parseBluetoothAddress(*text, address)) {
+        Log("Invalid address in the scan address filters");
+        return false;
+      }
+      addresses.push_back(address);
     }
+    return true;
+  } // parseAddressList
+
+  /// @brief Get the monotonic time used for the scan timestamps
+  /// @return int64_t microseconds
+  int64_t LayrzBlePlugin::monotonicNowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+  } // monotonicNowUs
+
+#ifdef NTDDI_WIN11_GE
+  /// @brief Convert a WinRT PHY type to the HCI value kept by the scan core
+  /// @param phy
+  /// @return uint8_t AdvertisingPhy
+  uint8_t LayrzBlePlugin::toAdvertisingPhy(BluetoothLEAdvertisementPhyType phy) {
+    switch (phy) {
+      case BluetoothLEAdvertisementPhyType::Uncoded1MPhy:
+        return kPhyLe1M;
+      case BluetoothLEAdvertisementPhyType::Uncoded2MPhy:
+        return kPhyLe2M;
+      case BluetoothLEAdvertisementPhyType::CodedPhy:
+        return kPhyLeCoded;
+      default:
+        return kPhyUnknown;
+    }
+  } // toAdvertisingPhy
+#endif
+
+  /// @brief Start the timer that flushes the coalesced scan results once per window
+  /// @return void
+  void LayrzBlePlugin::startScanFlushTimer() {
+    if (scanFlushTimer_ != nullptr || !scanCoalescer_.isEnabled()) {
+      return;
+    }
+
+    scanFlushTimer_ = ThreadPoolTimer::CreatePeriodicTimer(
+      [this](ThreadPoolTimer const&) { flushScanResults(); },
+      std::chrono::microseconds(scanCoalescer_.WindowUs())
+    );
+  } // startScanFlushTimer
 
-    const auto &device = visibleDevices[result.DeviceId()];
+  /// @brief Stop the flush timer, the pending results are kept
+  /// @return void
+  void LayrzBlePlugin::stopScanFlushTimer() {
+    if (scanFlushTimer_ != nullptr) {
+      scanFlushTimer_.Cancel();
+      scanFlushTimer_ = nullptr;
+    }
+  } // stopScanFlushTimer
+
+  /// @brief Encode a visible device for the Flutter side
+  /// @param device
+  /// @return BtDevice
+  BtDevice LayrzBlePlugin::toBtDevice(const BleScanResult &device) {
     BtDevice response(
       device.DeviceId(),
       flutter::EncodableList(),
@@ -1109,37 +2498,90 @@ namespace layrz_ble {
     }
 
     if (device.ManufacturerData() != nullptr) {
-      auto manufacturerDataList = flutter::EncodableList();
-      for (const auto &mfd : *device.ManufacturerData()) {
-        int64_t companyId = mfd.first;
-        std::vector<uint8_t> data = mfd.second;
-        BtManufacturerData mfData(companyId, &data);
-        manufacturerDataList.push_back(flutter::CustomEncodableValue(mfData));
-      }
-
-      response.set_manufacturer_data(manufacturerDataList);
+      response.set_manufacturer_data(encodeManufacturerData(*device.ManufacturerData()));
     }
     
     if (device.ServiceData() != nullptr) {
-      auto serviceDataList = flutter::EncodableList();
-      for (const auto &serviceData : *device.ServiceData()) {
-        int64_t uuid = serviceData.first;
-        std::vector<uint8_t> data = serviceData.second;
-
-        BtServiceData sData(uuid, &data);
+      response.set_service_data(encodeServiceData(*device.ServiceData()));
+    }
 
-        serviceDataList.push_back(flutter::CustomEncodableValue(sData));
+    return response;
+  } // toBtDevice
+
+  /// @brief Encode the changed fields of a visible device for the Flutter side
+  /// @param device
+  /// @param fields mask of ScanDeltaField, as returned by ScanDeltaTracker::diff
+  /// @return BtDeviceDelta
+  /// @note A flagged field left null means that it was cleared (only the TX power can be)
+  BtDeviceDelta LayrzBlePlugin::toBtDeviceDelta(const BleScanResult &device, uint32_t fields) {
+    BtDeviceDelta response(device.DeviceId(), static_cast<int64_t>(fields));
+    response.set_address_type(static_cast<int64_t>(device.AddressType()));
+
+    if (fields & kDeltaName) {
+      if (device.Name()) {
+        response.set_name(*device.Name());
+      } else {
+        response.set_name("Unknown");
       }
+    }
 
-      response.set_service_data(serviceDataList);
+    if (fields & kDeltaRssi) {
+      response.set_rssi(device.Rssi());
     }
-    
-    if(callbackChannel != nullptr) {
-      uiThreadHandler_.Post([this, response]() {
-        callbackChannel->OnScanResult(response, SuccessCallback, ErrorCallback);
-      });
+
+    if ((fields & kDeltaTxPower) && device.TxPower()) {
+      response.set_tx_power(device.TxPower());
     }
-  } // handleBleScanResult
+
+    if (fields & kDeltaManufacturerData) {
+      response.set_manufacturer_data(encodeManufacturerData(*device.ManufacturerData()));
+    }
+
+    if (fields & kDeltaServiceData) {
+      response.set_service_data(encodeServiceData(*device.ServiceData()));
+    }
+
+    return response;
+  } // toBtDeviceDelta
+
+  /// @brief Encode the manufacturer data of a device
+  /// @param manufacturerData
+  /// @return flutter::EncodableList of BtManufacturerData
+  flutter::EncodableList LayrzBlePlugin::encodeManufacturerData(const AdvPacketType &manufacturerData) {
+    auto manufacturerDataList = flutter::EncodableList();
+    manufacturerDataList.reserve(manufacturerData.size());
+    for (const auto &mfd : manufacturerData) {
+      int64_t companyId = mfd.first;
+      std::vector<uint8_t> data = mfd.second.toVector();
+      BtManufacturerData mfData(companyId, &data);
+      manufacturerDataList.push_back(flutter::CustomEncodableValue(mfData));
+    }
+    return manufacturerDataList;
+  } // encodeManufacturerData
+
+  /// @brief Encode the service data of a device
+  /// @param serviceData
+  /// @return flutter::EncodableList of BtServiceData
+  /// @note The base UUIDs are sent as their 16 or 32 bits alias. Any other 128 bits UUID is sent whole in
+  /// full_uuid, its uuid holds the first 32 bits for the readers of the integer alone.
+  flutter::EncodableList LayrzBlePlugin::encodeServiceData(const ServiceDataType &serviceData) {
+    auto serviceDataList = flutter::EncodableList();
+    serviceDataList.reserve(serviceData.size());
+    for (const auto &entry : serviceData) {
+      uint32_t shortUuid = 0;
+      std::optional<std::string> fullUuid;
+      if (!entry.first.toShort(shortUuid)) {
+        shortUuid = static_cast<uint32_t>(entry.first.msb >> 32);
+        fullUuid = entry.first.toString();
+      }
+      int64_t uuid = shortUuid;
+      std::vector<uint8_t> data = entry.second.toVector();
+      BtServiceData sData(uuid, &data, fullUuid ? &*fullUuid : nullptr);
+
+      serviceDataList.push_back(flutter::CustomEncodableValue(sData));
+    }
+    return serviceDataList;
+  } // encodeServiceData
 
   /// @brief Convert the DeviceWatcherStatus to string
   /// @param status 
@@ -11,19 +11,39 @@
 #include <winrt/base.h>
 #include <winrt/Windows.Foundation.h>
 #include <winrt/Windows.Foundation.Collections.h>
+#include <winrt/Windows.Foundation.Metadata.h>
 #include <winrt/Windows.Storage.Streams.h>
 #include <winrt/Windows.Devices.Enumeration.h>
 #include <winrt/Windows.Devices.Radios.h>
 #include <winrt/Windows.Devices.Bluetooth.h>
 #include <winrt/Windows.Devices.Bluetooth.Advertisement.h>
 #include <winrt/Windows.Devices.Bluetooth.GenericAttributeProfile.h>
+#include <winrt/Windows.System.Threading.h>
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <optional>
 
 #include "generated/layrz_ble.g.h"
 #include "gatt.h"
 #include "utils.h"
+#include "ad_parser.h"
+#include "adv_capture.h"
+#include "characteristic_table.h"
+#include "connect_timings.h"
+#include "gatt_layout.h"
+#include "identity_index.h"
+#include "scan_coalescer.h"
+#include "scan_delta.h"
+#include "scan_engine.h"
+#include "scan_event_queue.h"
+#include "scan_ingest.h"
+#include "scan_metrics.h"
 #include "scan_result.h"
+#include "service_filter.h"
 #include "thread_handler.hpp"
 
 
@@ -32,11 +52,13 @@ namespace layrz_ble
   using namespace winrt;
   using namespace winrt::Windows::Foundation;
   using namespace winrt::Windows::Foundation::Collections;
+  using namespace winrt::Windows::Foundation::Metadata;
   using namespace winrt::Windows::Devices::Radios;
   using namespace winrt::Windows::Devices::Enumeration;
   using namespace winrt::Windows::Devices::Bluetooth;
   using namespace winrt::Windows::Devices::Bluetooth::Advertisement;
   using namespace winrt::Windows::Devices::Bluetooth::GenericAttributeProfile;
+  using namespace winrt::Windows::System::Threading;
 
   class LayrzBlePlugin : public flutter::Plugin, public LayrzBlePlatformChannel
   {
@@ -51,24 +73,85 @@ namespace layrz_ble
       LayrzBlePlugin(const LayrzBlePlugin &) = delete;
       LayrzBlePlugin &operator=(const LayrzBlePlugin &) = delete;
 
-      static std::string filteredDeviceId;
-
       std::unordered_map<std::string, BleService> servicesAndCharacteristics{};
       std::unordered_map<std::string, winrt::event_token> servicesNotifying{};
+      // Characteristics of servicesAndCharacteristics by UUID, the lookup of the GATT operations
+      CharacteristicTable<GattCharacteristic> characteristicIndex_;
 
       Radio btRadio{nullptr};
       DeviceWatcher btScanner{nullptr};
       BluetoothLEAdvertisementWatcher leScanner{nullptr};
-      std::unordered_map<std::string, DeviceInformation> deviceWatcherDevices{};
-      std::unordered_map<std::string, BleScanResult> visibleDevices{};
 
       static std::unique_ptr<BleScanResult> connectedDevice;
+      static std::optional<BluetoothLEDevice> connectedBtDevice;
 
       winrt::fire_and_forget GetRadiosAsync();
 
       // Thread handling
       LayrzBlePluginUiThreadHandler uiThreadHandler_;
 
+      // Scan results merging, the watchers and the flush timer run on different threads
+      std::mutex scanMutex_;
+      ScanEngine scanEngine_;
+      ScanCoalescer scanCoalescer_;
+      ScanDeltaTracker scanDeltas_;
+      ThreadPoolTimer scanFlushTimer_{nullptr};
+      std::vector<DeviceKey> scanFlushBatch_;
+
+      // Raw advertisements, from the `Received` handler to the merge on a dedicated worker
+      ScanIngestWorker scanIngest_;
+      // Registration of the `Received` handler on leScanner, revoked when the scan stops (the watcher is reused)
+      winrt::event_token leReceivedToken_{};
+      // Held by the `Received` handler while it fills a ring slot, so stopping the scan waits for a running
+      // handler and the ring never has two producers. leProducing_ is guarded by it
+      std::mutex leProducerMutex_;
+      bool leProducing_ = false;
+
+      // Devices of the classic watcher by address, guarded by scanMutex_
+      DeviceIdentityIndex deviceIdentities_;
+
+      // Raw advertisements recorded for an offline replay, nullptr when not capturing, guarded by scanMutex_
+      std::unique_ptr<CaptureWriter> scanCapture_;
+
+      // Per-stage counters and latencies of the scan path, updated from every scan thread
+      ScanMetrics scanMetrics_;
+
+      // Scan messages waiting for the UI thread, bounded by the backpressure policy
+      ScanEventQueue scanEvents_;
+
+      // The received advertisements report their PHYs (Windows 11 24H2 and later)
+      bool scanPhyReported_ = false;
+
+      // Phases of the last successful connection, std::nullopt before the first one
+      std::mutex connectTimingsMutex_;
+      std::optional<ConnectTimings> lastConnectTimings_;
+
+      // GATT layouts of the known devices on disk, disabled until setGattCache is called
+      GattLayoutCache gattCache_;
+      // A discovery triggered by a service change is running
+      std::atomic<bool> gattRediscovering_{false};
+
+      // Connect without discovering, each service is discovered and memoized when first referenced
+      bool lazyDiscovery_ = false;
+      // Mode the current connection was opened in, lazyDiscovery_ only applies to the next one
+      bool connectionLazy_ = false;
+      // Every service of the connection is in servicesAndCharacteristics
+      bool allServicesDiscovered_ = false;
+
+      // Result of a GATT discovery, shared with the coroutine filling it
+      struct GattDiscovery {
+        bool success = false;
+        std::unordered_map<std::string, BleService> services;
+        GattLayout layout;
+        ConnectTimings timings;
+      };
+
+      enum class GattRefresh : uint8_t {
+        kStore,
+        kValidate,
+        kRediscover,
+      };
+
       void GetStatuses(std::function<void(ErrorOr<BtStatus> reply)> result);
       void CheckCapabilities(std::function<void(ErrorOr<bool> reply)> result);
       void CheckScanPermissions(std::function<void(ErrorOr<bool> reply)> result);
@@ -77,6 +160,37 @@ namespace layrz_ble
 
       void StartScan(const std::string* mac_address, const flutter::EncodableList* services_uuids, std::function<void(ErrorOr<bool> reply)> result);
       void StopScan(const std::string* mac_address, std::function<void(ErrorOr<bool> reply)> result);
+      void RequestScanResync(std::function<void(ErrorOr<bool> reply)> result);
+      void SetScanCacheLimits(const int64_t* max_devices, const int64_t* device_ttl_ms, std::function<void(ErrorOr<bool> reply)> result);
+      void SetScanCoalescingWindow(int64_t window_ms, std::function<void(ErrorOr<bool> reply)> result);
+      void GetScanCacheStats(std::function<void(ErrorOr<BtScanCacheStats> reply)> result);
+      void SetScanAddressFilters(
+        const flutter::EncodableList& allowlist,
+        const flutter::EncodableList& denylist,
+        std::function<void(ErrorOr<bool> reply)> result
+      );
+      void SetManufacturerDataFilters(const flutter::EncodableList& filters, std::function<void(ErrorOr<bool> reply)> result);
+      void GetManufacturerDataFilterHits(std::function<void(ErrorOr<flutter::EncodableList> reply)> result);
+      void SetRssiSmoothing(
+        int64_t mode,
+        double ema_alpha,
+        double kalman_process_noise,
+        double kalman_measurement_noise,
+        int64_t median_window,
+        int64_t min_delta_dbm,
+        int64_t max_interval_ms,
+        std::function<void(ErrorOr<bool> reply)> result
+      );
+      void SetScanCapture(const std::string* path, std::function<void(ErrorOr<bool> reply)> result);
+      void GetScanMetrics(bool reset, std::function<void(ErrorOr<BtScanMetrics> reply)> result);
+      void DumpScanMetrics(std::function<void(ErrorOr<bool> reply)> result);
+      void SetScanBackpressure(int64_t policy, int64_t max_queued_devices, std::function<void(ErrorOr<bool> reply)> result);
+      void GetScanQueueStats(std::function<void(ErrorOr<BtScanQueueStats> reply)> result);
+      void GetAdvertisingInfo(const std::string& mac_address, std::function<void(ErrorOr<std::optional<BtAdvertisingInfo>> reply)> result);
+      void GetConnectTimings(std::function<void(ErrorOr<std::optional<BtConnectTimings>> reply)> result);
+      void SetGattCache(const std::string* directory, std::function<void(ErrorOr<bool> reply)> result);
+      void ClearGattCache(std::function<void(ErrorOr<int64_t> reply)> result);
+      void SetLazyServiceDiscovery(bool enabled, std::function<void(ErrorOr<bool> reply)> result);
       void Connect(const std::string& mac_address, std::function<void(ErrorOr<bool> reply)> result);
       void Disconnect(const std::string* mac_address, std::function<void(ErrorOr<bool> reply)> result);
       void SetMtu(const std::string& mac_address, int64_t new_mtu, std::function<void(ErrorOr<std::optional<int64_t>> reply)> result);
@@ -90,6 +204,10 @@ namespace layrz_ble
       void RespondReadRequest(int64_t request_id, const std::string& mac_address, int64_t offset, const std::vector<uint8_t>* data, std::function<void(ErrorOr<bool> reply)> result);
       void RespondWriteRequest(int64_t request_id, const std::string& mac_address, int64_t offset, bool success, std::function<void(ErrorOr<bool> reply)> result);
       void SendNotification(const std::string& service_uuid, const std::string& characteristic_uuid, const std::vector<uint8_t>& payload, bool request_confirmation, std::function<void(ErrorOr<bool> reply)> result);
+      void ReadCharacteristicByHandle(int64_t handle, std::function<void(ErrorOr<std::vector<uint8_t>> reply)> result);
+      void WriteCharacteristicByHandle(int64_t handle, const std::vector<uint8_t>& payload, bool with_response, std::function<void(ErrorOr<bool> reply)> result);
+      void StartNotifyByHandle(int64_t handle, std::function<void(ErrorOr<bool> reply)> result);
+      void StopNotifyByHandle(int64_t handle, std::function<void(ErrorOr<bool> reply)> result);
 
     private:
       winrt::fire_and_forget connectAsync(const std::string& mac_address, std::function<void(ErrorOr<bool> reply)> result);
@@ -99,12 +217,54 @@ namespace layrz_ble
       winrt::fire_and_forget writeCharacteristicWithoutResponseAsync(GattCharacteristic characteristic, const std::vector<uint8_t>& payload, std::function<void(ErrorOr<bool> reply)> result);
       winrt::fire_and_forget startNotifyAsync(GattCharacteristic characteristic, std::function<void(ErrorOr<bool> reply)> result);
       winrt::fire_and_forget stopNotifyAsync(GattCharacteristic characteristic, std::function<void(ErrorOr<bool> reply)> result);
+      void readResolvedCharacteristic(GattCharacteristic characteristic, std::function<void(ErrorOr<std::vector<uint8_t>> reply)> result);
+      void writeResolvedCharacteristic(GattCharacteristic characteristic, const std::vector<uint8_t>& payload, bool with_response, std::function<void(ErrorOr<bool> reply)> result);
+      void startNotifyResolved(GattCharacteristic characteristic, std::function<void(ErrorOr<bool> reply)> result);
+      void stopNotifyResolved(GattCharacteristic characteristic, std::function<void(ErrorOr<bool> reply)> result);
       
       void onCharacteristicValueChanged(GattCharacteristic sender, GattValueChangedEventArgs args);
       void onConnectionStatusChanged(BluetoothLEDevice device, IInspectable args);
+      void onGattServicesChanged(BluetoothLEDevice device, IInspectable args);
+      IAsyncAction discoverGattAsync(BluetoothLEDevice device, BluetoothCacheMode cacheMode, std::shared_ptr<GattDiscovery> discovery);
+      IAsyncOperation<IBuffer> readDatabaseHashAsync(BluetoothLEDevice device);
+      winrt::fire_and_forget refreshGattCacheAsync(BluetoothLEDevice device, GattLayout layout, GattRefresh refresh);
+      winrt::fire_and_forget discoverServicesAsync(BluetoothLEDevice device, std::function<void(ErrorOr<flutter::EncodableList> reply)> result);
+      winrt::fire_and_forget discoverServiceAsync(
+        BluetoothLEDevice device,
+        Uuid128 serviceUuid,
+        Uuid128 characteristicUuid,
+        std::function<void(GattCharacteristic characteristic)> callback
+      );
+      void withCharacteristic(
+        const std::string& service_uuid,
+        const std::string& characteristic_uuid,
+        std::function<void(GattCharacteristic characteristic)> callback
+      );
+      void indexService(const BleService& service);
+      void reindexServices();
+      flutter::EncodableList encodeServices() const;
       void setupWatcher();
-      void handleScanResult(DeviceInformation device);
+      void stopLeWatcher();
+      void handleScanResult(const DeviceIdentity &identity);
       void handleBleScanResult(BleScanResult &result);
+      void handleBleAdvertisements(const std::vector<AdvertisementView> &batch);
+      void queueScanResult(const BleScanResult &device);
+      void emitScanResult(const BleScanResult &device);
+      void flushScanResults(bool force = false);
+      void logScanQueueStats();
+      void postScanEvent(ScanEvent &&event);
+      void startScanFlushTimer();
+      void stopScanFlushTimer();
+      void onDeviceEvicted(const BleScanResult &device);
+      static int64_t monotonicNowUs();
+#ifdef NTDDI_WIN11_GE
+      static uint8_t toAdvertisingPhy(BluetoothLEAdvertisementPhyType phy);
+#endif
+      static bool parseAddressList(const flutter::EncodableList& list, std::vector<uint64_t>& addresses);
+      static BtDevice toBtDevice(const BleScanResult &device);
+      static BtDeviceDelta toBtDeviceDelta(const BleScanResult &device, uint32_t fields);
+      static flutter::EncodableList encodeManufacturerData(const AdvPacketType &manufacturerData);
+      static flutter::EncodableList encodeServiceData(const ServiceDataType &serviceData);
       std::string castBtScannerStatus(DeviceWatcherStatus status);
       std::string castLeScannerStatus(BluetoothLEAdvertisementWatcherStatus status);
       std::string standarizeServiceUuid(std::string uuid);
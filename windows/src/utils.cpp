@@ -1,8 +1,5 @@
 #include "utils.h"
 
-#define MAC_ADDRESS_STR_LENGTH (size_t)17
-
-
 namespace layrz_ble {
   void Log(const char* format, ...) {
     // Append to the 
@@ -35,33 +32,6 @@ namespace layrz_ble {
     return str;
   } // HStringToString
 
-  std::string formatBluetoothAddress(uint64_t mac_address) {
-    uint8_t *mac_ptr = (uint8_t *)&mac_address;
-    char mac_str[MAC_ADDRESS_STR_LENGTH + 1] = {0};
-    snprintf(mac_str, MAC_ADDRESS_STR_LENGTH + 1, "%02x:%02x:%02x:%02x:%02x:%02x", mac_ptr[5], mac_ptr[4], mac_ptr[3], mac_ptr[2], mac_ptr[1], mac_ptr[0]);
-    return std::string(mac_str);
-  } // formatBluetoothAddress
-
-  std::string toLowercase(const std::string &str) {
-    std::string lower = str;
-    std::transform(
-      lower.begin(), 
-      lower.end(), 
-      lower.begin(),
-      [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-    return lower;
-  } // toLowercase
-
-  std::string toUppercase(const std::string &str) {
-    std::string upper = str;
-    std::transform(
-      upper.begin(), 
-      upper.end(), 
-      upper.begin(),
-      [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
-    return upper;
-  } // toUppercase
-
   std::string GuidToString(const winrt::guid &guid) {
     std::ostringstream oss;
     oss << std::hex << std::uppercase << std::setfill('0')
@@ -79,19 +49,21 @@ namespace layrz_ble {
   }
 
   winrt::guid StringToGuid(const std::string &str) {
+    Uuid128 uuid;
+    if (!Uuid128::parse(str, uuid)) {
+      return winrt::guid{};
+    }
+    return UuidToGuid(uuid);
+  }
+
+  winrt::guid UuidToGuid(const Uuid128 &uuid) {
     winrt::guid guid;
-    std::istringstream iss(str);
-    iss >> std::hex >> guid.Data1;
-    iss.ignore(1); // Skip '-'
-    iss >> std::hex >> guid.Data2;
-    iss.ignore(1); // Skip '-'
-    iss >> std::hex >> guid.Data3;
-    iss.ignore(1); // Skip '-'
-    iss >> std::hex >> guid.Data4[0];
-    iss >> std::hex >> guid.Data4[1];
-    iss.ignore(1); // Skip '-'
-    for (int i = 2; i < 8; ++i) {
-        iss >> std::hex >> guid.Data4[i];
+    guid.Data1 = static_cast<uint32_t>(uuid.msb >> 32);
+    guid.Data2 = static_cast<uint16_t>(uuid.msb >> 16);
+    guid.Data3 = static_cast<uint16_t>(uuid.msb);
+    // Data4 holds the last 8 bytes in order, big endian like the text
+    for (int i = 0; i < 8; ++i) {
+      guid.Data4[i] = static_cast<uint8_t>(uuid.lsb >> (56 - 8 * i));
     }
     return guid;
   }
@@ -108,8 +80,4 @@ namespace layrz_ble {
     reader.ReadBytes(winrt::array_view<uint8_t>(data));
     return data;
   }
-
-  std::string BooleanToString(bool value) {
-    return value ? "true" : "false";
-  } // BooleanToString
 }
\ No newline at end of file
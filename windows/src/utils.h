@@ -16,6 +16,9 @@
 #include <winrt/Windows.Foundation.Collections.h>
 #include <winrt/Windows.Storage.Streams.h>
 
+#include "string_utils.h"
+#include "uuid.h"
+
 namespace layrz_ble {
   using namespace winrt;
   using namespace Windows::Storage::Streams;
@@ -36,21 +39,6 @@ namespace layrz_ble {
   /// @return std::string
   std::string HStringToString(const winrt::hstring& hstr);
 
-  /// @brief Format a Bluetooth MAC address
-  /// @param mac_address
-  /// @return std::string
-  std::string formatBluetoothAddress(uint64_t mac_address);
-
-  /// @brief Convert a string to lowercase
-  /// @param str
-  /// @return std::string
-  std::string toLowercase(const std::string &str);
-
-  /// @brief Convert a string to uppercase
-  /// @param str
-  /// @return std::string
-  std::string toUppercase(const std::string &str);
-
   /// @brief Convert a GUID to a string
   /// @param guid
   /// @return std::string
@@ -58,9 +46,14 @@ namespace layrz_ble {
 
   /// @brief Convert a string to a GUID
   /// @param str
-  /// @return winrt::guid
+  /// @return winrt::guid all zero if the string is not a UUID
   winrt::guid StringToGuid(const std::string &str);
 
+  /// @brief Convert a parsed UUID to a GUID
+  /// @param uuid
+  /// @return winrt::guid
+  winrt::guid UuidToGuid(const Uuid128 &uuid);
+
   /// @brief Convert a vector of bytes to an IBuffer
   /// @param data
   /// @return Windows::Storage::Streams::IBuffer
@@ -70,11 +63,6 @@ namespace layrz_ble {
   /// @param buffer
   /// @return std::vector<uint8_t>
   std::vector<uint8_t> IBufferToVector(const IBuffer &buffer);
-
-  /// @brief Convert a boolean to a string
-  /// @param value
-  /// @return std::string
-  std::string BooleanToString(bool value);
 }
 
 #endif // __LAYRZ_BLE_PLUGIN_UTILS_H__
\ No newline at end of file